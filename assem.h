@@ -265,7 +265,7 @@ struct SToken {
     uint32_t stringLength;        // Length of token as string
     uint16_t priority;            // Priority if operator
     uint16_t vartype;             // 0: value not known, 3: int64, 5: double, 8: string
-    uint32_t unused;
+    uint32_t nameId;              // Index into interned names if token is a name. 0 if not a name
     union {                       // value if constant or assemble-time variable
         uint64_t u;
         int64_t  i;
@@ -340,6 +340,43 @@ struct SCode : public SExpression {
     uint8_t  category;            // instruction category
 };
 
+// struct SRelax is used in pass 4 for remembering the input to the last fitCode of each code record
+struct SRelax {
+    uint32_t label;               // index into symbols of label at this code record. 0 if none
+    uint32_t fitNum;              // code.fitNum before last fitCode
+    uint32_t fitAddr;             // code.fitAddr before last fitCode
+    uint32_t etype;               // code.etype before last fitCode
+    uint64_t value;               // code.value before last fitCode
+    uint32_t sizeUnknown;         // code.sizeUnknown before last fitCode
+};
+
+// struct SFitKey contains everything in an SCode record that determines which instruction variant and format fitCode chooses
+struct SFitKey {
+    uint64_t value;               // immediate value if floating point type. 0 otherwise
+    int64_t  offset;              // offset for memory operand or jump
+    uint32_t instruction;         // instruction id
+    uint32_t dtype;               // data type
+    uint32_t etype;               // expression type flags
+    uint32_t fitNum;              // sizes that the immediate constant fits into
+    uint32_t fitAddr;             // sizes that the address or jump offset fits into
+    uint8_t  dest;                // destination register
+    uint8_t  reg1;                // first register operand
+    uint8_t  reg2;                // second register operand
+    uint8_t  fallback;            // fallback register
+    uint8_t  base;                // base register
+    int8_t   scale;               // scale factor for index register
+    uint8_t  immByte;             // lower 8 bits of immediate value if findFormat depends on it
+    uint8_t  flags;               // 1: optionbits nonzero, 2: sym1 nonzero, 4: value0 fits 32 bits
+    uint32_t unused;              // filler to make all bytes defined
+};
+
+// entry in cache of instruction formats found by fitCode
+struct SFitCacheEntry {
+    SFitKey key;                  // instruction details
+    SFormat const * formatp;      // best format found. 0 if vacant
+    uint32_t instr1;              // index into instructionlistId of best instruction variant
+};
+
 
 // struct SBlock is used for tracking {} code blocks
 struct SBlock  {
@@ -373,6 +410,9 @@ static inline SCode operator | (SCode const & code1, SExpression const & exp2) {
 // find the smallest representation that the floating point operand fits into
 int fitFloat(double x);
 
+// find format details in formatList from entry in instructionlist
+uint32_t findFormat(SInstruction const & listentry, uint32_t imm);
+
 // insert memory operand into code structure
 void insertMem(SCode & code, SExpression & expr);
 
@@ -408,6 +448,22 @@ static inline bool operator == (ElfFWC_Sym2 const & a, ElfFWC_Sym2 const & b) {
     return strcmp((char*)symbolNameBuffer.buf()+a.st_name, (char*)symbolNameBuffer.buf()+b.st_name) == 0;
 }
 
+// entry in table of interned names. Each different name gets a name ID, which is an index into this table
+struct SNameEntry {
+    uint32_t hash;                               // hash value of name
+    uint32_t name;                               // offset of name in nameStrings
+    uint32_t length;                             // length of name
+    uint32_t symi;                               // index into symbols of symbol with this name. 0 if none
+};
+
+// entry in hash table for recognizing register names, keywords, and instruction names
+struct SNameClass {
+    uint32_t hash;                               // case-insensitive hash value of name
+    uint32_t reg;                                // index+1 into registerNames if name is a register prefix, otherwise 0
+    uint32_t keyword;                            // index+1 into keywords if name is a keyword, otherwise 0
+    uint32_t instruction;                        // index+1 to first record with this name in instructionlist, otherwise 0
+};
+
 // structure in list of assembly errors
 struct SAssemError {
     uint32_t pos;                                // position in input file
@@ -430,10 +486,19 @@ public:
     uint32_t numErrors();                        // Return number of errors
     bool tooMany();                              // true if too many errors
     void outputErrors();                         // Write all errors to stderr
+    void flushDiagnostics();                     // Write pending errors when -diag=json
 protected:
     CAssembler * owner;
     CDynamicArray<SAssemError>list;              // List of errors
     uint32_t maxErrors;                          // Maximum number of errors to report
+    uint32_t numStreamed;                        // Number of errors written to diagBuffer
+    uint32_t cacheLine;                          // Line of last column computation
+    uint32_t cachePos;                           // Position of last column computation
+    int32_t  cacheExtra;                         // Column adjustment for UTF-8 and tabs up to cachePos
+    CMemoryBuffer diagBuffer;                    // Chunk of formatted diagnostics not yet written
+    void findLineColumn(uint32_t pos, uint32_t & line, uint32_t & column); // Find line and column of position
+    const char * errorText(SAssemError const & e, char * text2); // Get text for error message
+    void streamDiagnostics();                    // Format new errors as JSON lines
 };
 
 
@@ -472,7 +537,11 @@ protected:
     CDynamicArray<SInstruction3> instructionlistId; // List of instruction set, sorted by id
     CDynamicArray<SOperator> operators;          // List of operators
     CDynamicArray<SKeyword> keywords;            // List of keywords
-    CDynamicArray<ElfFWC_Sym2> symbols;          // List of symbols
+    CDynamicArray<SNameClass> nameClassTable;    // Hash table for recognizing register names, keywords, and instructions
+    CDynamicArray<ElfFWC_Sym2> symbols;          // List of symbols. Not sorted until pass 5
+    CDynamicArray<SNameEntry> internedNames;     // Interned names, indexed by name ID
+    CDynamicArray<uint32_t> nameHashTable;       // Hash table of name IDs for finding interned names
+    CMemoryBuffer nameStrings;                   // Text of interned names
     CDynamicArray<ElfFWC_Rela2> relocations;     // List of relocations
     CDynamicArray<uint8_t> brackets;             // Stack of nested brackets during evaluation of expression
     CDynamicArray<SCode> codeBuffer;             // Coded instructions
@@ -480,12 +549,21 @@ protected:
     CDynamicArray<Elf64_Shdr> sectionHeaders;    // Section headers
     CDynamicArray<SFormat> formatList3;          // Subset of formatList for multiformat instruction formats
     CDynamicArray<SFormat> formatList4;          // Subset of formatList for jump instruction formats
+    CDynamicArray<uint32_t> formatCandidates;    // Indexes into formatList3 or formatList4 of the formats supported by each multi-format or jump instruction, smallest first
+    CDynamicArray<uint32_t> formatCandidatesStart; // Index into formatCandidates of the first candidate for each entry in instructionlistId
+    CDynamicArray<SFitCacheEntry> fitCache;      // Cache of instruction formats found by fitCode
+    CDynamicArray<uint8_t> immFormat;            // 1 for each entry in instructionlistId where the format depends on the immediate operand
     CDynamicArray<SBlock>  hllBlocks;            // Tracking of {} blocks    
     CDynamicArray<SExpression> expressions;      // Expressions saved as assemble-time symbols    
     CTextFileBuffer stringBuffer;                // Buffer for assemble-time string variables
     CMetaBuffer<CMemoryBuffer> dataBuffers;      // databuffer for each section
     CAssemErrors errors;                         // Error reporting
     void initializeWordLists();                  // Initialize and sort instruction list, operator list, and keyword list
+    void makeNameClassTable();                   // Make hash table for classifying names
+    const char * nameClassName(SNameClass const & e); // Get name of entry in nameClassTable
+    SNameClass * findNameClass(const char * name, uint32_t len); // Find name in nameClassTable
+    SNameClass * insertNameClass(const char * name); // Find or make entry in nameClassTable
+    void classifyName(SToken & token);           // Classify name as register, keyword, instruction or other name
     void pass1();                                // Split input file into lines and tokens. Handle preprocessing directives. Find symbol definitions
     void interpretSectionDirective();            // Interpret section directive during pass 2 or 3
     void interpretFunctionDirective();           // Interpret function directive during pass 2 or 3
@@ -493,6 +571,10 @@ protected:
     uint32_t addSymbol(ElfFWC_Sym2 & sym);       // Add a symbol to symbols list
     uint32_t findSymbol(uint32_t name);          // Find symbol by index into symbolNameBuffer
     uint32_t findSymbol(const char * name, uint32_t len); // Find symbol by name with specified length
+    uint32_t findSymbol(SToken const & token);   // Find symbol by name token
+    uint32_t internName(const char * name, uint32_t len, bool insert); // Find name ID, or make a new one if insert
+    void rehashNames();                          // Rebuild nameHashTable when it is too full
+    void updateNameSymbols();                    // Update symbol index of each name after sorting symbols
     void pass2();                                // A. Handle metaprogramming directives
                                                  // B. Classify lines
                                                  // C. Identify symbol names, sections, labels, functions 
@@ -523,6 +605,7 @@ protected:
     int  fitCode(SCode & code);                  // find an instruction variant that fits the code
     bool instructionFits(SCode const & code, SCode & codeTemp, uint32_t ii); // check if instruction fits into specified format
     bool jumpInstructionFits(SCode const & code, SCode & codeTemp, uint32_t ii); // check if jump instruction fits into specified format
+    bool makeFitKey(SCode const & code, SFitKey & key, uint32_t firstInstr, uint32_t numInstr); // make key for fitCache
     int  fitConstant(SCode & code);              // check how many bits are needed to contain immediate constant in an instruction.
     int  fitAddress(SCode & code);               // check how many bits are needed to contain relative address in an instruction.
     void checkCode1(SCode & code);               // eheck code for correctness before fitting a format, and fix some code details
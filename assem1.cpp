@@ -182,9 +182,13 @@ void CAssembler::go() {
     if (cmd.dataSizeOption == 0) cmd.dataSizeOption = 1 << 24;
 
     do {  // This loop is repeated only once. Just convenient to break out of in case of errors
+        // Positions in the source file are 32-bit
+        if (dataSize() >= 0xFFFFFFFF) {err.submit(ERR_FILE_SIZE, fileName);  break;}
+
         pass = 1;
         // Split input file into lines and tokens. Find symbol definitions
         pass1();
+        errors.flushDiagnostics();
         if (errors.tooMany()) {err.submit(ERR_TOO_MANY_ERRORS);  break;}
 
         pass = 2;
@@ -192,6 +196,7 @@ void CAssembler::go() {
         // B. Classify lines
         // C. Identify symbol names, sections, labels, functions 
         pass2();
+        errors.flushDiagnostics();
         if (errors.tooMany()) {err.submit(ERR_TOO_MANY_ERRORS);  break;}
 
         //showTokens(); //!! for debugging only
@@ -200,14 +205,17 @@ void CAssembler::go() {
         pass = 3;
         // Interpret lines. Generate code and data
         pass3();
+        errors.flushDiagnostics();
         if (errors.tooMany()) {err.submit(ERR_TOO_MANY_ERRORS);  break;}
         pass = 4;
         // Resolve internal cross references, optimize forward references
         pass4();
+        errors.flushDiagnostics();
         if (errors.tooMany()) {err.submit(ERR_TOO_MANY_ERRORS);  break;}
         pass = 5;
         // Make binary file
         pass5();
+        errors.flushDiagnostics();
         if (errors.tooMany()) {err.submit(ERR_TOO_MANY_ERRORS);  break;}
 
     } while (false);
@@ -220,14 +228,109 @@ void CAssembler::go() {
     outFile.write();
 }
 
+// Character classes used by pass 1. Made by makeCharClassTable
+static uint8_t charClass[256];
+const int CC_NAME1        = 1;         // character can be the start of a symbol name
+const int CC_NAME2        = 2;         // character can be part of a symbol name
+const int CC_COMMENTSTOP  = 4;         // character has a meaning inside a comment: control character, quote, '/' or '*'
+
+// Make table of character classes
+static void makeCharClassTable() {
+    for (int i = 0; i < 256; i++) {
+        char c = (char)i;
+        uint8_t cc = 0;
+        if (((c | 0x20) >= 'a' && (c | 0x20) <= 'z') || ((c & 0x80) && allowUTF8) || strchr(allowedInNames, c)) {
+            cc |= CC_NAME1 | CC_NAME2;
+        }
+        if (c >= '0' && c <= '9') cc |= CC_NAME2;
+        if ((i < 0x20 && c != '\t') || c == '\'' || c == '"' || c == '/' || c == '*') cc |= CC_COMMENTSTOP;
+        charClass[i] = cc;
+    }
+}
+
 // Character can be the start of a symbol name
-inline bool nameChar1(char c) {
-    return ((c | 0x20) >= 'a' && (c | 0x20) <= 'z') || ((c & 0x80) && allowUTF8) || strchr(allowedInNames, c);
+static inline bool nameChar1(char c) {
+    return (charClass[(uint8_t)c] & CC_NAME1) != 0;
 }
 
 // Character can be the part of a symbol name
-inline bool nameChar2(char c) {
-    return nameChar1(c) || (c >= '0' && c <= '9');
+static inline bool nameChar2(char c) {
+    return (charClass[(uint8_t)c] & CC_NAME2) != 0;
+}
+
+// Index of lowest set bit in a nonzero mask
+static inline uint32_t lowestBit(uint32_t x) {
+#if defined(__GNUC__)
+    return __builtin_ctz(x);
+#else
+    return bitScanForward(x);
+#endif
+}
+
+// The following functions scan the input file 16 bytes at a time if SSE2 is available. 
+// s = input buffer, n = start position, end = end of data. Returns the position of the first 
+// character not in the class, or end
+
+// Skip spaces and tabs
+static uint32_t skipSpaces(const char * s, uint32_t n, uint32_t end) {
+#ifdef FWC_SSE2
+    const __m128i space = _mm_set1_epi8(' '), tab = _mm_set1_epi8('\t');
+    while (n + 16 <= end) {
+        __m128i v = _mm_loadu_si128((__m128i const*)(s + n));
+        uint32_t mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab))) ^ 0xFFFF;
+        if (mask) return n + lowestBit(mask);
+        n += 16;
+    }
+#endif
+    while (n < end && (s[n] == ' ' || s[n] == '\t')) n++;
+    return n;
+}
+
+// Find end of symbol name
+static uint32_t scanName(const char * s, uint32_t n, uint32_t end) {
+#ifdef FWC_SSE2
+    // the vector test finds letters, digits, and UTF-8 bytes. Other characters are checked in charClass
+    const __m128i lcase = _mm_set1_epi8(0x20), zero = _mm_setzero_si128();
+    const __m128i a1 = _mm_set1_epi8('a' - 1), z1 = _mm_set1_epi8('z' + 1);
+    const __m128i d0 = _mm_set1_epi8('0' - 1), d9 = _mm_set1_epi8('9' + 1);
+    while (n + 16 <= end) {
+        __m128i v = _mm_loadu_si128((__m128i const*)(s + n));
+        __m128i low = _mm_or_si128(v, lcase);
+        __m128i ok = _mm_and_si128(_mm_cmpgt_epi8(low, a1), _mm_cmplt_epi8(low, z1));      // letters
+        ok = _mm_or_si128(ok, _mm_and_si128(_mm_cmpgt_epi8(v, d0), _mm_cmplt_epi8(v, d9))); // digits
+        if (allowUTF8) ok = _mm_or_si128(ok, _mm_cmplt_epi8(v, zero));                      // bytes >= 0x80
+        uint32_t mask = _mm_movemask_epi8(ok) ^ 0xFFFF;
+        if (mask == 0) {
+            n += 16;  continue;
+        }
+        n += lowestBit(mask);
+        if (!nameChar2(s[n])) return n;                // end of name
+        n++;                                           // other character allowed in names
+    }
+#endif
+    while (n < end && nameChar2(s[n])) n++;
+    return n;
+}
+
+// Skip characters that have no meaning inside a comment
+static uint32_t skipComment(const char * s, uint32_t n, uint32_t end) {
+#ifdef FWC_SSE2
+    const __m128i zero = _mm_setzero_si128(), c20 = _mm_set1_epi8(0x20), tab = _mm_set1_epi8('\t');
+    const __m128i quote1 = _mm_set1_epi8('\''), quote2 = _mm_set1_epi8('"');
+    const __m128i slash = _mm_set1_epi8('/'), star = _mm_set1_epi8('*');
+    while (n + 16 <= end) {
+        __m128i v = _mm_loadu_si128((__m128i const*)(s + n));
+        // control characters except tab. Signed compare, so exclude bytes >= 0x80
+        __m128i stop = _mm_andnot_si128(_mm_or_si128(_mm_cmplt_epi8(v, zero), _mm_cmpeq_epi8(v, tab)), _mm_cmplt_epi8(v, c20));
+        stop = _mm_or_si128(stop, _mm_or_si128(_mm_cmpeq_epi8(v, quote1), _mm_cmpeq_epi8(v, quote2)));
+        stop = _mm_or_si128(stop, _mm_or_si128(_mm_cmpeq_epi8(v, slash), _mm_cmpeq_epi8(v, star)));
+        uint32_t mask = _mm_movemask_epi8(stop);
+        if (mask) return n + lowestBit(mask);
+        n += 16;
+    }
+#endif
+    while (n < end && !(charClass[(uint8_t)s[n]] & CC_COMMENTSTOP)) n++;
+    return n;
 }
 
 // check if string is a number. Can be decimal, binary, octal, hexadecimal, or floating point
@@ -269,28 +372,6 @@ uint32_t isNumber(const char * s, int maxlen, bool * isFloat) {
     return i;                               // return length
 }
 
-// Check if string is a register name
-uint32_t isRegister(const char * s, uint32_t len) {
-    uint32_t i, j, nl, num;
-    for (i = 0; i < TableSize(registerNames); i++) {
-        if ((s[0] | 0x20) == registerNames[i].name[0]) {  // first character match, lower case
-            nl = (uint32_t)strlen(registerNames[i].name);           // length of register name prefix
-            if (len < nl + 1 || len > nl + 2) continue;   // continue search if length wrong
-            for (j = 0; j < nl; j++) {                    // check if each character matches
-                if ((s[j] | 0x20) != registerNames[i].name[j]) continue;    // lower case compare
-            }
-            if (s[j] < '0' || s[j] > '9') continue;  // not a number
-            num = s[j] - '0';                        // get number, first digit
-            if (len == nl + 2) {                     // two digit number
-                if (s[j+1] < '0' || s[j+1] > '9') continue;  // second digit not a number            
-                num = num * 10 + (s[j+1] - '0');
-            }
-            if (num >= 32) continue;     // number too high
-            return num + registerNames[i].id;  // everyting matches
-        }
-    }
-    return 0;       // not found. return 0
-} 
 
 
 // Split input file into lines and tokens. Handle preprocessing directives. Find symbol definitions
@@ -298,14 +379,14 @@ void CAssembler::pass1() {
     uint32_t n = 0;                // offset into assembly file
     uint32_t m;                    // end of current token
     int32_t  i, f;                 // temporary
+    int64_t  fx;                   // result of search
     int32_t  comment = 0;          // 0: normal, 1: inside comment to end of line, 2: inside /* */ comment
     uint32_t commentStart;         // start position of multiline comment
     uint32_t commentStartColumn;   // start column of multiline comment
     char c;                        // current character or byte
     SToken token = {0};            // current token
-    SKeyword keywSearch;           // record to search for keyword
     SOperator opSearch;            // record to search for operator
-    SInstruction instructSearch;   // record to search for instruction
+    const char * s = (char*)buf(); // input file
     SLine line = {0,0,0,0,0,0,0};  // line record
     lines.push(line);              // empty records for line 0
     linei = 1;                     // start at line 1
@@ -322,12 +403,18 @@ void CAssembler::pass1() {
 
     // loop through file
     while (n < dataSize()) {
-        c = get<char>(n);              // get character
+        c = s[n];                      // get character
+
+        // inside a comment. skip all characters that have no meaning here
+        if (comment && !(charClass[(uint8_t)c] & CC_COMMENTSTOP)) {
+            n = skipComment(s, n + 1, dataSize());
+            continue;
+        }
 
         // is it space or a control character?
         if (uint8_t(c) <= 0x20) {                
             if (c == ' ' || c == '\t') {   // skip space and tab
-                n++;
+                n = skipSpaces(s, n + 1, dataSize());
                 continue;
             }
             if (c == '\r' || c == '\n') {  // newline
@@ -360,45 +447,22 @@ void CAssembler::pass1() {
         token.pos  = n;
         token.stringLength = 1;
         token.id   = 0;
+        token.nameId = 0;
         //token.column = n - line.beginPos;
 
         // is it a name?
         if (!comment && nameChar1(c)) {
             // start of a name
-            m = n+1;
-            while (m < dataSize() && nameChar2(get<char>(m))) m++;
+            m = scanName(s, n + 1, dataSize());
             // name goes from position n to m-1. make token
             token.type = TOK_NAM;
             token.pos = n;
             token.stringLength = m - n;
 
-            // is it a register name
-            f = isRegister((char*)buf()+n, token.stringLength);
-            if (f) {
-                token.type = TOK_REG;
-                token.id = f;
-            }
-            // is it a keyword?
-            if (token.type == TOK_NAM && m-n < sizeof(keywSearch.name)) {
-                memcpy(keywSearch.name, buf()+n, m-n);
-                keywSearch.name[m-n] = 0;
-                f = keywords.findFirst(keywSearch);
-                if (f >= 0) {  // keyword found
-                    token.id = keywords[f].id;
-                    token.type = keywords[f].id >> 24;
-                    if (token.id == HLL_SWITCH) numSwitch++;
-                }
-            }
-            // is it an instruction?
-            if (token.type == TOK_NAM && m-n < sizeof(instructSearch.name)) {
-                memcpy(instructSearch.name, buf()+n, m-n);
-                instructSearch.name[m-n] = 0;
-                f = instructionlist.findFirst(instructSearch);
-                if (f >= 0) {  // instruction name found
-                    token.type = TOK_INS;
-                    token.id = instructionlist[f].id;
-                }
-            }
+            // is it a register name, keyword, or instruction?
+            classifyName(token);
+            if (token.type == TOK_NAM) token.nameId = internName(s + n, m - n, true);
+            if (token.type == (HLL_SWITCH >> 24) && token.id == HLL_SWITCH) numSwitch++;
             n = m;
             tokens.push(token);     // save token
             continue;
@@ -421,7 +485,8 @@ void CAssembler::pass1() {
         // is it an operator?
         opSearch.name[0] = c;
         opSearch.name[1] = 0;
-        f = operators.findFirst(opSearch);
+        fx = operators.findFirst(opSearch);
+        f = fx < 0 ? -1 : (int32_t)fx;
         if (f >= 0) {
             // found single-character operator
             // make a greedy search for multi-character operators
@@ -644,7 +709,7 @@ void CAssembler::interpretSectionDirective() {
         }
     }
     // find or define symbol with section name
-    sectionsym = findSymbol((char*)buf() + tokens[tokenB].pos, tokens[tokenB].stringLength);
+    sectionsym = findSymbol(tokens[tokenB]);
     if (sectionsym <= 0) {
         // symbol not previously defined. Define it now
         sym.st_type = STT_SECTION;
@@ -705,7 +770,7 @@ void CAssembler::interpretFunctionDirective() {
     memset(&sym, 0, sizeof(ElfFWC_Sym2)); // reset symbol
     int32_t symi;
 
-    symi = findSymbol((char*)buf() + tokens[tokenB].pos, tokens[tokenB].stringLength);
+    symi = findSymbol(tokens[tokenB]);
     if (symi > 0) {
         if (pass == 2) errors.report(tokens[tokenB].pos, tokens[tokenB].stringLength, ERR_SYMBOL_DEFINED);  // symbol already defined
     }
@@ -744,7 +809,7 @@ void CAssembler::interpretEndDirective() {
     int32_t symi;
     CTextFileBuffer tempBuffer;       // temporary storage of names
 
-    symi = findSymbol((char*)buf() + tokens[tokenB].pos, tokens[tokenB].stringLength);
+    symi = findSymbol(tokens[tokenB]);
     if (symi <= 0) {
         errors.reportLine(ERR_UNMATCHED_END);
     }
@@ -768,34 +833,106 @@ void CAssembler::interpretEndDirective() {
     lines[linei].type = LINE_ENDDIR;        // line is end directive
 }
 
+// Calculate hash value of name for nameHashTable (FNV-1a)
+static inline uint32_t symbolNameHash(const char * name, uint32_t len) {
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < len; i++) {
+        hash = (hash ^ (uint8_t)name[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Find the name ID of a name. Each different name gets a unique name ID. All name tokens get 
+// a name ID in pass 1 so that they can be looked up without searching.
+// Returns 0 if the name is not found and insert is false
+uint32_t CAssembler::internName(const char * name, uint32_t len, bool insert) {
+    if (nameHashTable.numEntries() == 0) rehashNames();   // first time
+    uint32_t mask = (uint32_t)nameHashTable.numEntries() - 1; // table size is a power of 2
+    uint32_t * table = (uint32_t*)nameHashTable.buf();
+    SNameEntry * entries = (SNameEntry*)internedNames.buf();
+    uint32_t hash = symbolNameHash(name, len);
+    uint32_t h = hash & mask;
+    uint32_t id;                                           // name ID
+    while ((id = table[h]) != 0) {                         // linear probing until vacant entry
+        if (entries[id].hash == hash && entries[id].length == len 
+        && memcmp(nameStrings.buf() + entries[id].name, name, len) == 0) {
+            return id;                                     // found
+        }
+        h = (h + 1) & mask;
+    }
+    if (!insert) return 0;                                 // not found
+    SNameEntry entry = {hash, (uint32_t)nameStrings.push(name, len), len, 0};
+    id = (uint32_t)internedNames.push(entry);
+    table[h] = id;
+    if (internedNames.numEntries() * 2 > nameHashTable.numEntries()) {
+        rehashNames();                                     // grow hash table to keep it less than half full
+    }
+    return id;
+}
+
+// Rebuild nameHashTable. Called when the table is too full
+void CAssembler::rehashNames() {
+    if (internedNames.numEntries() == 0) {
+        SNameEntry entry = {0, 0, 0, 0};
+        internedNames.push(entry);                         // name ID 0 is unused
+    }
+    uint32_t tableSize = 256;
+    while (tableSize < internedNames.numEntries() * 4) tableSize <<= 1;
+    nameHashTable.clear();
+    nameHashTable.setNum(tableSize);                       // all entries are vacant
+    uint32_t * table = (uint32_t*)nameHashTable.buf();
+    for (uint32_t id = 1; id < internedNames.numEntries(); id++) {
+        uint32_t h = internedNames[id].hash & (tableSize - 1);
+        while (table[h]) h = (h + 1) & (tableSize - 1);   // find vacant entry
+        table[h] = id;
+    }
+}
+
+// Update the symbol index of each name. Called when the symbols have been sorted
+void CAssembler::updateNameSymbols() {
+    for (uint32_t id = 1; id < internedNames.numEntries(); id++) {
+        internedNames[id].symi = 0;
+    }
+    for (uint32_t symi = 1; symi < symbols.numEntries(); symi++) {
+        const char * name = (char*)symbolNameBuffer.buf() + symbols[symi].st_name;
+        uint32_t id = internName(name, (uint32_t)strlen(name), true);
+        if (internedNames[id].symi == 0) internedNames[id].symi = symi;
+    }
+}
+
 // Find symbol by index into symbolNameBuffer. The return value is an index into symbols. 
-// Symbol indexes may change when new symbols are added to the symbols list, which is sorted by name
+// Symbol indexes are stable until the symbols list is sorted by name in pass 5
 uint32_t CAssembler::findSymbol(uint32_t namei) {
-    ElfFWC_Sym2 sym;                                       // temporary symbol record used for searching
-    sym.st_name = namei;
-    return symbols.findFirst(sym);                         // find symbol by name
+    const char * name = (char*)symbolNameBuffer.buf() + namei;
+    return findSymbol(name, (uint32_t)strlen(name));
 } 
 
 // Find symbol by name as string. The return value is an index into symbols. 
-// Symbol indexes may change when new symbols are added to the symbols list, which is sorted by name
+// The return value is negative when interpreted as int32_t if not found
 uint32_t CAssembler::findSymbol(const char * name, uint32_t len) {
-    uint32_t saveSize = symbolNameBuffer.dataSize();       // save symbolNameBuffer size for later reset
-    uint32_t namei = symbolNameBuffer.putStringN(name, len); // put name temporarily into symbolNameBuffer
-    int32_t symi = findSymbol(namei);                      // find symbol by name index
-    symbolNameBuffer.setSize(saveSize);                    // remove temporary name from symbolNameBuffer
-    return symi;                                           // return symbol index
+    uint32_t id = internName(name, len, false);
+    if (id && internedNames[id].symi) return internedNames[id].symi; // found
+    return 0x80000000;                                     // not found
 }
 
-// Add a symbol to symbols list
+// Find symbol by name token. Uses the name ID if the token has one
+uint32_t CAssembler::findSymbol(SToken const & token) {
+    if (token.nameId == 0) return findSymbol((char*)buf() + token.pos, token.stringLength);
+    uint32_t symi = internedNames[token.nameId].symi;
+    return symi ? symi : 0x80000000;
+}
+
+// Add a symbol to symbols list. Returns 0 if a symbol with the same name already exists
 uint32_t CAssembler::addSymbol(ElfFWC_Sym2 & sym) {
-    int32_t f = symbols.findFirst(sym);
-    if (f >= 0) {
+    const char * name = (char*)symbolNameBuffer.buf() + sym.st_name;
+    uint32_t id = internName(name, (uint32_t)strlen(name), true);
+    if (internedNames[id].symi) {
         // error: symbol already defined
         return 0;
     }
-    else {
-        return symbols.addUnique(sym);
-    }
+    uint32_t symi = (uint32_t)symbols.push(sym);
+    internedNames[id].symi = symi;
+    return symi;
 }
 
 // interpret   name: options {, name: options}
@@ -998,7 +1135,8 @@ void CAssembler::interpretVariableDefinition1() {
             if (tokens[tok].type == TOK_NAM) { // name. make symbol
                 sym.st_name = symbolNameBuffer.putStringN((char*)buf()+tokens[tok].pos, tokens[tok].stringLength);
                 sym.st_type = STT_OBJECT;
-                symi = symbols.addUnique(sym);
+                symi = findSymbol(tokens[tok]);
+                if ((int32_t)symi < 1) symi = addSymbol(sym);
                 tokens[tok].type = TOK_SYM;      // change token type
                 tokens[tok].id = symbols[symi].st_name;  // use name offset as unique identifier because symbol index can change
                 state = 1;
@@ -1706,17 +1844,143 @@ void CAssembler::initializeWordLists() {
     // Keywords list
     keywords.pushBig(keywordsList,sizeof(keywordsList));
     keywords.sort();
-    // Read instruction list from file
-    CCSVFile instructionListFile(cmd.instructionListFile);  // Filename of list of instructions
-    instructionListFile.parse();                            // Read and interpret instruction list file
-    instructionlist << instructionListFile.instructionlist; // Transfer instruction list to my own container
-    instructionlistId.copy(instructionlist);                // copy instruction list
-    // sort lists by different criteria, defined by the different operators:
-    // operator < (SInstruction const & a, SInstruction const & b)
-    // operator < (SInstruction3 const & a, SInstruction3 const & b)
-    SInstruction3 nullInstruction;                          // empty record
-    memset(&nullInstruction, 0, sizeof(nullInstruction));
-    instructionlistId.push(nullInstruction);                // Empty record will go to position 0 to avoid an instruction with index 0
-    instructionlist.sort();                                 // Sort instructionlist by name
-    instructionlistId.sort();                               // Sort instructionlistId by id
+    if (cmd.instructionListFile == 0) {
+        // No instruction list file specified. Use built-in lists, which are already sorted
+        instructionlist.pushBig(builtinInstructionsByName, builtinInstructionsNum * (uint32_t)sizeof(SInstruction));
+        instructionlistId.pushBig((SInstruction3 const*)builtinInstructionsById, (builtinInstructionsNum + 1) * (uint32_t)sizeof(SInstruction3));
+    }
+    else {
+        // Read instruction list from file
+        CCSVFile instructionListFile(cmd.instructionListFile);  // Filename of list of instructions
+        instructionListFile.parse();                            // Read and interpret instruction list file
+        instructionlist << instructionListFile.instructionlist; // Transfer instruction list to my own container
+        instructionlistId.copy(instructionlist);                // copy instruction list
+        // sort lists by different criteria, defined by the different operators:
+        // operator < (SInstruction const & a, SInstruction const & b)
+        // operator < (SInstruction3 const & a, SInstruction3 const & b)
+        SInstruction3 nullInstruction;                          // empty record
+        memset(&nullInstruction, 0, sizeof(nullInstruction));
+        instructionlistId.push(nullInstruction);                // Empty record will go to position 0 to avoid an instruction with index 0
+        instructionlist.sort();                                 // Sort instructionlist by name
+        instructionlistId.sort();                               // Sort instructionlistId by id
+    }
+    // Make tables for recognizing characters, register names, keywords, and instruction names in pass 1
+    makeCharClassTable();
+    makeNameClassTable();
+}
+
+// Calculate case-insensitive hash value of name for nameClassTable
+static inline uint32_t nameClassHash(const char * name, uint32_t len) {
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < len; i++) {
+        hash = (hash ^ (uint8_t)(name[i] | 0x20)) * 16777619u;
+    }
+    return hash;
+}
+
+// Case-insensitive compare of name with specified length against zero-terminated string s
+static inline bool nameEqualsNoCase(const char * name, uint32_t len, const char * s) {
+#if defined (_MSC_VER)
+    return _strnicmp(name, s, len) == 0 && s[len] == 0;    // microsoft
+#else
+    return strncasecmp(name, s, len) == 0 && s[len] == 0;  // unix
+#endif
+}
+
+// Make hash table for classifying names as register, keyword, or instruction
+void CAssembler::makeNameClassTable() {
+    uint32_t i;                                   // loop counter
+    SNameClass * e;                               // table entry
+    uint32_t tableSize = 64;
+    uint32_t numNames = keywords.numEntries() + instructionlist.numEntries() + TableSize(registerNames);
+    while (tableSize < numNames * 4) tableSize <<= 1; // table is at most 1/4 full
+    nameClassTable.setNum(tableSize);             // all entries are vacant
+    // register names without number
+    for (i = 0; i < TableSize(registerNames); i++) {
+        e = insertNameClass(registerNames[i].name);
+        if (e->reg == 0) e->reg = i + 1;
+    }
+    // keywords
+    for (i = 0; i < keywords.numEntries(); i++) {
+        e = insertNameClass(keywords[i].name);
+        if (e->keyword == 0) e->keyword = i + 1;
+    }
+    // instruction names. Save index to the first record with each name
+    for (i = 0; i < instructionlist.numEntries(); i++) {
+        e = insertNameClass(instructionlist[i].name);
+        if (e->instruction == 0) e->instruction = i + 1;
+    }
+}
+
+// Get name of entry in nameClassTable
+const char * CAssembler::nameClassName(SNameClass const & e) {
+    if (e.keyword) return keywords[e.keyword - 1].name;
+    if (e.instruction) return instructionlist[e.instruction - 1].name;
+    return registerNames[e.reg - 1].name;
+}
+
+// Find name in nameClassTable. Case insensitive. Returns 0 if not found
+SNameClass * CAssembler::findNameClass(const char * name, uint32_t len) {
+    uint32_t mask = nameClassTable.numEntries() - 1;       // table size is a power of 2
+    SNameClass * table = (SNameClass*)nameClassTable.buf();
+    uint32_t hash = nameClassHash(name, len);
+    uint32_t h = hash & mask;
+    while (table[h].reg | table[h].keyword | table[h].instruction) { // linear probing until vacant entry
+        if (table[h].hash == hash && nameEqualsNoCase(name, len, nameClassName(table[h]))) {
+            return table + h;                              // found
+        }
+        h = (h + 1) & mask;
+    }
+    return 0;                                              // not found
+}
+
+// Find entry for name in nameClassTable, or make a new entry if not found
+SNameClass * CAssembler::insertNameClass(const char * name) {
+    uint32_t len = (uint32_t)strlen(name);
+    SNameClass * e = findNameClass(name, len);
+    if (e) return e;                                       // name already in table
+    uint32_t mask = nameClassTable.numEntries() - 1;
+    SNameClass * table = (SNameClass*)nameClassTable.buf();
+    uint32_t hash = nameClassHash(name, len);
+    uint32_t h = hash & mask;
+    while (table[h].reg | table[h].keyword | table[h].instruction) h = (h + 1) & mask; // find vacant entry
+    table[h].hash = hash;
+    return table + h;                                      // caller must set reg, keyword, or instruction
+}
+
+// Classify name token as register, keyword, instruction, or other name. 
+// token.type must be TOK_NAM. token.type and token.id are changed if the name is recognized
+void CAssembler::classifyName(SToken & token) {
+    const char * s = (char*)buf() + token.pos;             // name string
+    uint32_t len = token.stringLength;                     // length of name
+    uint32_t d = 0;                                        // number of digits at the end of name
+    uint32_t num;                                          // register number
+    SNameClass * e;                                        // entry in nameClassTable
+
+    // is it a register name? A register name is a prefix followed by a number of 1 or 2 digits below 32
+    while (d < 3 && d < len && s[len - 1 - d] >= '0' && s[len - 1 - d] <= '9') d++;
+    if ((d == 1 || d == 2) && d < len) {
+        e = findNameClass(s, len - d);
+        if (e && e->reg) {
+            num = s[len - d] - '0';                        // first digit
+            if (d == 2) num = num * 10 + (s[len - 1] - '0'); // two digit number
+            if (num < 32) {
+                token.type = TOK_REG;
+                token.id = num + registerNames[e->reg - 1].id;
+                return;
+            }
+        }
+    }
+    e = findNameClass(s, len);
+    if (e == 0) return;                                    // not a reserved name
+    // is it a keyword? Keywords are case insensitive
+    if (e->keyword) {
+        token.id = keywords[e->keyword - 1].id;
+        token.type = token.id >> 24;
+    }
+    // is it an instruction? Instruction names are case sensitive
+    if (token.type == TOK_NAM && e->instruction && strncmp(instructionlist[e->instruction - 1].name, s, len) == 0) {
+        token.type = TOK_INS;
+        token.id = instructionlist[e->instruction - 1].id;
+    }
 }
@@ -1392,7 +1392,7 @@ SExpression CAssembler::op2String(uint32_t op, SExpression const & exp1, SExpres
         sprintf((char*)stringBuffer.buf()+stringpos1, "%g", exp1.value.d);
     }
     else {
-        stringBuffer.put(wrongType);
+        stringBuffer.putStringN(wrongType, (uint32_t)strlen(wrongType));
     }
     len = (uint32_t)strlen((char*)stringBuffer.buf()+stringpos1);
     stringpos2 = stringpos1 + len;
@@ -1423,7 +1423,7 @@ SExpression CAssembler::op2String(uint32_t op, SExpression const & exp1, SExpres
         stringBuffer.setSize(stringpos2 + len + 1);
     }
     else {
-        stringBuffer.put(wrongType);
+        stringBuffer.putStringN(wrongType, (uint32_t)strlen(wrongType));
     }
     SExpression exp3;
     exp3.etype = XPR_STRING;
@@ -23,7 +23,7 @@ void CAssembler::replaceKnownNames() {
         if (lineError) break; 
         if (tokens[tok].type == TOK_NAM) {
             // name found. search for it in symbol table
-            symi = findSymbol((char*)buf() + tokens[tok].pos, tokens[tok].stringLength);
+            symi = findSymbol(tokens[tok]);
             if (symi > 0) {  // symbol found. replace token by reference to symbol                
                 tokens[tok].id = symbols[symi].st_name;  // use name offset as unique identifier because symbol index can change
                 if (symbols[symi].st_type == STT_EXPRESSION) {
@@ -166,7 +166,8 @@ void CAssembler::interpretMetaDefinition() {
             if (state == 0) break;
             if (state >= 3) { errors.report(tokens[tok]);  break; }
             sym.st_name = symbolNameBuffer.putStringN((char*)buf() + tokens[tok].pos, tokens[tok].stringLength);
-            symi = symbols.addUnique(sym);
+            symi = findSymbol(tokens[tok]);
+            if ((int32_t)symi < 1) symi = addSymbol(sym);
             symbols[symi].st_type = 0;  // remember that symbol has no value yet
             symbols[symi].st_shndx = SHN_ABS;  // remember symbol is not external
             symbols[symi].st_unitsize = 8;
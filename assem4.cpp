@@ -53,13 +53,55 @@ void CAssembler::pass3() {
     }
 }
 
+// size of instruction in a multi-format or jump instruction format, as calculated by instructionFits and jumpInstructionFits
+static inline uint32_t formatSize(SFormat const & format) {
+    uint32_t size = (format.format2 >> 8) & 3;
+    if (size == 0 && format.cat != 4) size = 1;
+    return size;
+}
+
 // extract subsets of formatList (in disasm1.cpp) for multiformat instructions and jump instructions
 void CAssembler::makeFormatLists() {
-    uint32_t i;
+    uint32_t i, j, k;
     for (i = 0; i < formatListSize; i++) {
         if (formatList[i].cat == 3) formatList3.push(formatList[i]);
         if (formatList[i].cat == 4) formatList4.push(formatList[i]);
     }
+    // make list of candidate formats for each multi-format and jump instruction.
+    // The candidates are sorted by size so that fitCode can stop at the first format that fits.
+    // Formats of the same size remain in the order of formatList
+    formatCandidatesStart.setNum(instructionlistId.numEntries() + 1);
+    for (i = 0; i < instructionlistId.numEntries(); i++) {
+        formatCandidatesStart[i] = formatCandidates.numEntries();
+        uint32_t category = instructionlistId[i].category;
+        if (category != 3 && category != 4) continue;
+        CDynamicArray<SFormat> & list = category == 3 ? formatList3 : formatList4;
+        uint32_t first = formatCandidates.numEntries();
+        for (j = 0; j < list.numEntries(); j++) {
+            if (((uint64_t)1 << list[j].formatIndex) & instructionlistId[i].format) {
+                // insert j sorted by size, after candidates of the same size
+                uint32_t size = formatSize(list[j]);
+                formatCandidates.push(j);
+                for (k = formatCandidates.numEntries() - 1; k > first && formatSize(list[formatCandidates[k-1]]) > size; k--) {
+                    formatCandidates[k] = formatCandidates[k-1];
+                }
+                formatCandidates[k] = j;
+            }
+        }
+    }
+    formatCandidatesStart[i] = formatCandidates.numEntries();
+    // find single-format instructions where findFormat depends on the immediate operand
+    immFormat.setNum(instructionlistId.numEntries());
+    for (i = 0; i < instructionlistId.numEntries(); i++) {
+        if (instructionlistId[i].category == 1 || instructionlistId[i].category == 2) {
+            uint32_t format0 = findFormat(instructionlistId[i], 0);
+            for (uint32_t imm = 1; imm < 0x100; imm++) {
+                if (findFormat(instructionlistId[i], imm) != format0) {
+                    immFormat[i] = 1;  break;
+                }
+            }
+        }
+    }
 }
 
 // Interpret a line defining code. This covers both assembly style and high level style code
@@ -868,6 +910,46 @@ int fitFloat(double x) {
     return fit;
 }
 
+// number of entries in fitCache. Must be a power of 2
+const uint32_t fitCacheSize = 0x1000;
+
+// Make key for looking up code in fitCache. 
+// The key contains everything that instructionFits and jumpInstructionFits read from code.
+// Returns false if the code cannot be cached
+bool CAssembler::makeFitKey(SCode const & code, SFitKey & key, uint32_t firstInstr, uint32_t numInstr) {
+    if (code.etype & XPR_MASK) return false;     // jumpInstructionFits depends on fInstr
+    memset(&key, 0, sizeof(key));
+    if (code.dtype & TYP_FLOAT) key.value = code.value.u; // floating point value may be converted to integer
+    key.offset      = code.offset;
+    key.instruction = code.instruction;
+    key.dtype       = code.dtype;
+    key.etype       = code.etype;
+    key.fitNum      = code.fitNum;
+    key.fitAddr     = code.fitAddr;
+    key.dest        = code.dest;
+    key.reg1        = code.reg1;
+    key.reg2        = code.reg2;
+    key.fallback    = code.fallback;
+    key.base        = code.base;
+    key.scale       = code.scale;
+    for (uint32_t ii = firstInstr; ii < firstInstr + numInstr; ii++) {
+        if (immFormat[ii]) key.immByte = uint8_t(code.value.w);
+    }
+    key.flags       = (code.optionbits != 0) | (code.sym1 != 0) << 1 
+        | (value0 < 0x100000000 && value0 > -(int64_t)0x80000000U) << 2;
+    return true;
+}
+
+// Calculate hash value of key for fitCache
+static inline uint32_t fitKeyHash(SFitKey const & key) {
+    uint64_t const * p = (uint64_t const *)&key;
+    uint64_t hash = 0;
+    for (uint32_t i = 0; i < sizeof(key) / 8; i++) {
+        hash = (hash ^ p[i]) * 0x9E3779B97F4A7C15u;
+    }
+    return uint32_t(hash >> 32);
+}
+
 // find an instruction variant that fits the code
 int CAssembler::fitCode(SCode & code) {
     // return value:
@@ -877,8 +959,9 @@ int CAssembler::fitCode(SCode & code) {
     uint32_t bestSize  = 99;                     // size of best fitting instruction variant
     SCode    codeTemp;                           // fitted code
     SCode    codeBest;                           // best fitted code
-    uint32_t instrIndex = 0, ii;                 // index into instructionlistId
+    uint64_t instrIndex = 0, ii;                 // index into instructionlistId
     uint32_t formatIx = 0;                       // index into formatList
+    uint32_t k;                                  // index into formatCandidates
     uint32_t isize;                              // il bits
 
     // find instruction by id    
@@ -900,6 +983,35 @@ int CAssembler::fitCode(SCode & code) {
     }
     if (lineError) return 0;
 
+    // search for the same kind of code in fitCache
+    SFitKey key;                                 // key for fitCache
+    SFitCacheEntry * cacheEntry = 0;             // entry in fitCache
+    if (makeFitKey(code, key, (uint32_t)instrIndex, nInstr)) {
+        if (fitCache.numEntries() == 0) fitCache.setNum(fitCacheSize);
+        cacheEntry = &fitCache[fitKeyHash(key) & (fitCacheSize - 1)];
+        cmd.fitCacheLookups++;
+        if (cacheEntry->formatp && memcmp(&cacheEntry->key, &key, sizeof(key)) == 0) {
+            // found. fit only the instruction variant and format that was found last time
+            bestInstr = cacheEntry->instr1;
+            code.instr1 = bestInstr;
+            code.category = instructionlistId[bestInstr].category;
+            code.formatp = cacheEntry->formatp;
+            variant = interpretTemplateVariants(instructionlistId[bestInstr].template_variant);
+            bool fits = code.category == 4 ? jumpInstructionFits(code, codeBest, bestInstr) : instructionFits(code, codeBest, bestInstr);
+            if (fits) {
+                cmd.fitCacheHits++;
+                nInstr = 0;                      // skip search
+                bestSize = codeBest.size;
+            }
+            else {
+                // the key does not contain everything that the fit depends on. Treat it as a miss:
+                // make a full search, which replaces the cache entry
+                cacheEntry->formatp = 0;
+                bestInstr = 0;
+            }
+        }
+    }
+
     // loop through all instruction definitions with same id
     for (ii = instrIndex; ii < instrIndex + nInstr; ii++) {
         // category
@@ -923,36 +1035,33 @@ int CAssembler::fitCode(SCode & code) {
             }
             break;
 
-        case 3:  // multi-format instructions. search all formats for the best one
-            for (formatIx = 0; formatIx < formatList3.numEntries(); formatIx++) {
-                code.formatp = &formatList3[formatIx];
-                if (((uint64_t)1 << code.formatp->formatIndex) & instructionlistId[ii].format) {
-                    if (instructionFits(code, codeTemp, ii)) {
-                        // check if smaller than previously found. category 3 = multiformat preferred
-                        isize = codeTemp.size;
-                        if (isize < bestSize || (isize == bestSize && codeBest.category != 3)) {
-                            bestSize = isize;
-                            bestInstr = ii;
-                            codeBest = codeTemp;
-                        }
-                    }                    
+        case 3:  // multi-format instructions. search the candidate formats for the smallest one
+            for (k = formatCandidatesStart[ii]; k < formatCandidatesStart[ii+1]; k++) {
+                code.formatp = &formatList3[formatCandidates[k]];
+                if (instructionFits(code, codeTemp, ii)) {
+                    // check if smaller than previously found. category 3 = multiformat preferred
+                    isize = codeTemp.size;
+                    if (isize < bestSize || (isize == bestSize && codeBest.category != 3)) {
+                        bestSize = isize;
+                        bestInstr = ii;
+                        codeBest = codeTemp;
+                    }
+                    break;       // the remaining candidates are not smaller
                 }
             }
             break;
 
-        case 4:  // jump instructions. search all formats for the best one
-            for (formatIx = 0; formatIx < formatList4.numEntries(); formatIx++) {
-                code.formatp = &formatList4[formatIx];
-                if (((uint64_t)1 << code.formatp->formatIndex) & instructionlistId[ii].format) {
-                    if (jumpInstructionFits(code, codeTemp, ii)) {
-                        // check if smaller than previously found. category 3 = multiformat preferred
-                        isize = codeTemp.size;
-                        if (isize < bestSize) {
-                            bestSize = isize;
-                            bestInstr = ii;
-                            codeBest = codeTemp;
-                        }
-                    }                    
+        case 4:  // jump instructions. search the candidate formats for the smallest one
+            for (k = formatCandidatesStart[ii]; k < formatCandidatesStart[ii+1]; k++) {
+                code.formatp = &formatList4[formatCandidates[k]];
+                if (jumpInstructionFits(code, codeTemp, ii)) {
+                    isize = codeTemp.size;
+                    if (isize < bestSize) {
+                        bestSize = isize;
+                        bestInstr = ii;
+                        codeBest = codeTemp;
+                    }
+                    break;       // the remaining candidates are not smaller
                 }
             }
             break;
@@ -966,6 +1075,12 @@ int CAssembler::fitCode(SCode & code) {
         errors.reportLine(checkCodeE(code));         // find reason why no format fits, and report error
         return 0;
     }
+    if (cacheEntry && nInstr) {
+        // save search result in fitCache
+        cacheEntry->key = key;
+        cacheEntry->formatp = codeBest.formatp;
+        cacheEntry->instr1 = bestInstr;
+    }
 
     code = codeBest;          // get the best fitting code
     variant = interpretTemplateVariants(instructionlistId[bestInstr].template_variant);  // instruction-specific variants
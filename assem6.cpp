@@ -27,6 +27,16 @@ void CAssembler::pass4() {
     uint32_t optiPass = 0;             // count optimization passes
     uint32_t nSections = sectionHeaders.numEntries(); // number of sections
     uint32_t const maxOptiPass = 10;   // maximum number of optimization passes
+    CDynamicArray<SRelax> relax;       // input to last fitCode and label symbol of each code record
+
+    // find label symbols. Symbol indexes do not change in pass 4
+    relax.setNum(codeBuffer.numEntries());
+    for (i = 0; i < codeBuffer.numEntries(); i++) {
+        if (codeBuffer[i].label) {
+            symi = findSymbol(codeBuffer[i].label);
+            if (symi > 0 && symi < symbols.numEntries()) relax[i].label = symi;
+        }
+    }
 
     // multiple optimization passes until size is certain or no changes
     for (optiPass = 1; optiPass <= maxOptiPass; optiPass++) {
@@ -56,14 +66,12 @@ void CAssembler::pass4() {
                 numUncertain = sectionHeaders[section].sh_link;
             }
             codeBuffer[i].address = addr;
-            if (codeBuffer[i].label) {
+            symi = relax[i].label;
+            if (symi) {
                 // there is a label here. put the address into the symbol record
-                symi = findSymbol(codeBuffer[i].label);
-                if (symi > 0 && symi < symbols.numEntries()) {
-                    // the upper half of st_value is temporarily used for indicating if address is not yet precise
-                    symbols[symi].st_value = addr | (uint64_t)numUncertain << 32;
-                    symbols[symi].st_unitsize = 1;     // set an arbitrary size to indicate that a value has been assigned
-                }
+                // the upper half of st_value is temporarily used for indicating if address is not yet precise
+                symbols[symi].st_value = addr | (uint64_t)numUncertain << 32;
+                symbols[symi].st_unitsize = 1;     // set an arbitrary size to indicate that a value has been assigned
             }
             if (codeBuffer[i].sizeUnknown) {
                 // update the size of this instruction
@@ -76,7 +84,18 @@ void CAssembler::pass4() {
                     sectionHeaders[section].sh_link = numUncertain;
                     fitConstant(codeBuffer[i]);                     // recalculate necessary size of immediate constant
                     fitAddress(codeBuffer[i]);                      // recalculate necessary size of address
-                    fitCode(codeBuffer[i]);                         // fit instruction to new size
+                    // fitCode is slow. It gives the same result as last time if the required sizes of constant 
+                    // and address are unchanged. Everything is fitted in the first pass and after an error.
+                    // fitCode does not depend on sizeUnknown, except for memory operands with symbol difference
+                    SCode & code = codeBuffer[i];
+                    SRelax & r = relax[i];
+                    if (optiPass == 1 || lineError || code.fitNum != r.fitNum || code.fitAddr != r.fitAddr 
+                    || code.etype != r.etype || code.value.u != r.value 
+                    || (code.sizeUnknown != r.sizeUnknown && (code.etype & XPR_SYM2))) {
+                        r.fitNum = code.fitNum;  r.fitAddr = code.fitAddr;  r.etype = code.etype;
+                        r.value = code.value.u;  r.sizeUnknown = code.sizeUnknown;
+                        fitCode(code);                              // fit instruction to new size
+                    }
                     if (codeBuffer[i].size != lastSize) changes++;  // count changes if size changed
                 }
                 else {  // not an instruction
@@ -165,7 +184,7 @@ void CAssembler::interpretPublicDirective() {
             }
             else if (token.type == TOK_NAM) {
                 // name found. find symbol
-                symi = findSymbol((char*)buf() + tokens[tok].pos, tokens[tok].stringLength);
+                symi = findSymbol(tokens[tok]);
                 if ((int32_t)symi < 1) {
                     errors.report(token.pos, token.stringLength, ERR_SYMBOL_UNDEFINED);  return;
                 }
@@ -253,6 +272,10 @@ void CAssembler::interpretPublicDirective() {
 void CAssembler::pass5() {
     uint32_t i;                // loop counter
 
+    // sort symbols by name for the output file. Symbol indexes change here
+    symbols.sortUnstable();            // symbol names are unique
+    updateNameSymbols();
+
     // make a databuffer for each section
     uint32_t nSections = sectionHeaders.numEntries();
     dataBuffers.setSize(nSections);
@@ -703,7 +726,7 @@ int64_t CAssembler::calculateMemoryOffset(SCode & code) {
                     else {
                         // local symbol in different IP section. needs relocation
                         code.base = 30;
-                        relocation.r_type = R_FORW_SELFREL;
+                        relocation.r_type = R_FORW_SELFREL | scale;  // scale 2 (x4) for jumps, operand size for 8-bit data offsets, otherwise 0
                         relocation.r_addend = fieldPos - code.size * 4;  // position of relocated field relative to instruction end
                         relocation.r_sym = code.sym1;          // temporary symbol index. resolve when symbol table created
                         relocation.r_refsym = 0;
@@ -733,7 +756,7 @@ int64_t CAssembler::calculateMemoryOffset(SCode & code) {
                 if (symbols[symi1].st_other & (STV_IP | STV_EXEC)) {
                     // relative to IP
                     code.base = (uint8_t)REG_IP;
-                    relocation.r_type = R_FORW_SELFREL;
+                    relocation.r_type = R_FORW_SELFREL | scale;  // scale 2 (x4) for jumps, operand size for 8-bit data offsets, otherwise 0
                     relocation.r_addend = fieldPos - code.size * 4;  // position of relocated field relative to instruction end
                 }
                 else if (symbols[symi1].st_other & STV_THREADP) {
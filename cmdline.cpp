@@ -22,7 +22,8 @@ CCommandLineInterpreter::CCommandLineInterpreter() {
     verbose   = CMDL_VERBOSE_YES;                          // How much diagnostics to print on screen
     optiLevel = 2;                                         // Optimization level
     maxErrors = 50;                                        // Maximum number of errors before assembler aborts
-    instructionListFile = "instruction_list.csv";          // Filename of list of instructions (default name)
+    threads   = 1;                                         // Number of threads for disassembly and linking
+    floatFormat = FLOAT_FORMAT_G;                          // Floating point numbers in text output as printf %G
 }
 
 
@@ -38,14 +39,22 @@ void CCommandLineInterpreter::readCommandLine(int argc, char * argv[]) {
         help();
         return;
     }
+    if (outputFile && strcmp(outputFile, "-") == 0) {
+        // Output to stdout. Don't mix it with messages
+        verbose = CMDL_VERBOSE_NO;
+    }
     // Check file options
     fileOptions = CMDL_FILE_INPUT;
     if (libraryOptions == CMDL_LIBRARY_ADDMEMBER) {
         // Adding object files to library. Library may not exist
         fileOptions = CMDL_FILE_IN_IF_EXISTS;
     } 
-    if (job == CMDL_JOB_DUMP) {
-        // Dumping or extracting. Output file not used
+    if (job == CMDL_JOB_LIB) {
+        // The library is modified in place unless another output file is specified
+        fileOptions |= CMDL_FILE_IN_OUT_SAME;
+    }
+    if (job == CMDL_JOB_DUMP || job == CMDL_JOB_EMU) {
+        // Dumping, extracting, or emulating. Output file not used
         if (outputFile) err.submit(ERR_OUTFILE_IGNORED); // Output file name ignored
         outputFile = 0;
     }
@@ -79,7 +88,11 @@ void CCommandLineInterpreter::readCommandItem(char * string) {
     const char optionPrefix2 = '-';
 #endif
     const char responseFilePrefix = '@';  // Response file name prefixed by '@'
-    if (*string == optionPrefix1 || *string == optionPrefix2) {
+    if (outputFileNext || (string[0] == '-' && string[1] == 0)) {
+        // Filename after -o option, or "-" for stdout
+        interpretFileName(string);
+    }
+    else if (*string == optionPrefix1 || *string == optionPrefix2) {
         // Option prefix found. This is a command line option
         interpretCommandOption(string+1);
     }
@@ -169,12 +182,35 @@ void CCommandLineInterpreter::interpretFileName(char * string) {
         libmode = 2;
         return;
 
-    case 2:            // Second or later filename after -lib = object file to add to library
-       // addObjectToLibrary(string, string);
+    case 2:            // Second or later filename after -lib = object file to add, delete, or extract
+        if (outputFileNext) break;               // Output file name after -o
+        SLibraryCommand command;
+        command.name = string;
+        command.command = libraryCommand ? libraryCommand : CMDL_LIBRARY_ADDMEMBER;
+        libraryOptions |= command.command;
+        libraryCommands.push(command);
         return;
     }
     // libmode = 0: Ordinary input or output file
-    if (!inputFile) {
+    if (job == CMDL_JOB_LINK && !outputFileNext) {
+        // Linking: first filename = executable file, unless specified with -o.
+        // The rest are object files. The first object file is read as the input file
+        if (!outputFile) {
+            outputFile = string;
+        }
+        else {
+            if (!inputFile) inputFile = string;
+            linkFiles.push(string);
+        }
+        return;
+    }
+    if (outputFileNext) {
+        // Filename after -o option
+        if (outputFile) err.submit(ERR_MULTIPLE_IO_FILES);
+        outputFile = string;
+        outputFileNext = 0;
+    }
+    else if (!inputFile) {
         // Input file not specified yet
         inputFile = string;
     }
@@ -201,6 +237,9 @@ void CCommandLineInterpreter::interpretCommandOption(char * string) {
         if (string[i] == 0) break;
     }
 
+    // Library commands after -lib
+    if (libmode && interpretLibraryCommand(stringlow)) return;
+
     // Detect option type
     switch(stringlow[0]) {
     case 'a':   // assemble option
@@ -220,7 +259,10 @@ void CCommandLineInterpreter::interpretCommandOption(char * string) {
         break;
 
 
-    case 'd':   // datasize, disassemble or dump option
+    case 'd':   // datasize, diag, disassemble or dump option
+        if (strncmp(stringlow, "diag=", 5) == 0) {
+            interpretDiagOption(stringlow+5);  break;
+        }
         if (strncmp(stringlow, "dis", 3) == 0) {
             if (job) err.submit(ERR_MULTIPLE_COMMANDS, string);     // More than one job specified
             job = CMDL_JOB_DIS;
@@ -249,6 +291,13 @@ void CCommandLineInterpreter::interpretCommandOption(char * string) {
         }
         break;
 
+    case 'f':   // Float format option
+        if (strncmp(stringlow, "float=", 6) == 0) {
+            interpretFloatOption(stringlow+6);  break;
+        }
+        err.submit(ERR_UNKNOWN_OPTION, string);     // Unknown option
+        break;
+
     case 'h': case '?':  // Help
         job = CMDL_JOB_HELP;
         break;
@@ -257,6 +306,10 @@ void CCommandLineInterpreter::interpretCommandOption(char * string) {
         if (strncmp(stringlow, "ilist=", 6) == 0) {
         interpretIlistOption(string+6);
         }
+        else if (strcmp(stringlow, "ilist-compile") == 0) {
+            if (job) err.submit(ERR_MULTIPLE_COMMANDS, string);     // More than one job specified
+            job = CMDL_JOB_ILIST;
+        }
         else {        
             err.submit(ERR_UNKNOWN_OPTION, string);     // Unknown option
         }
@@ -286,11 +339,24 @@ void CCommandLineInterpreter::interpretCommandOption(char * string) {
         err.submit(ERR_UNKNOWN_OPTION, string);     // Unknown option
         break;
 
-    case 'o':    // Optimization option
+    case 'o':    // Output file or optimization option
+        if (stringlow[1] == 0) {
+            outputFileNext = 1;  break;          // Output file name follows
+        }
         interpretOptimizationOption(string+1);
         break;
         //
 
+    case 't':    // Threads option
+        if (strncmp(stringlow, "threads", 7) == 0) {
+            interpretThreadsOption(string+7);  break;
+        }
+        err.submit(ERR_UNKNOWN_OPTION, string);     // Unknown option
+        break;
+
+    case 'v':    // Verbose option
+        interpretVerboseOption(string+1);  break;
+
     case 'w':    // Warning option
         interpretErrorOption(string);  break;
 
@@ -340,60 +406,62 @@ void CCommandLineInterpreter::interpretDumpOption(char * string) {
 
 void CCommandLineInterpreter::interpretLinkOption(char * string) {
     // Interpret linker options
+    outputType = FILETYPE_FWC_EXE;
 }
 
 void CCommandLineInterpreter::interpretEmulateOption(char * string) {
     // Interpret emulate options
+    char * s1 = string;
+    while (*s1) {
+        switch (*(s1++)) {
+        case 's': case 'S':  // scalar loops for vector instructions
+            emulateOptions |= CMDL_EMU_SCALAR;  break;
+        case 'n': case 'N':  // no combined micro-operations
+            emulateOptions |= CMDL_EMU_NOFUSE;  break;
+        case '-': case '_':  // '-' may separate options
+            break;
+        default:
+            err.submit(ERR_UNKNOWN_OPTION, string-3);  // Unknown option
+            return;
+        }
+    }
 }
 
 void CCommandLineInterpreter::interpretLibraryOption(char * string) {
     // Interpret options for manipulating library/archive files
 
     // Check for -lib command
-    if (/*stricmp(string, "lib") == 0*/ true) {  // Found -lib command
-        if (inputFile) {
-            libmode = 2;                  // Input file already specified. Remaining file names are object files to add
-        }
-        else {
-            libmode = 1;                  // The rest of the command line must be interpreted as library name and object file names
-        }
-        return;
+    if (*string) {
+        err.submit(ERR_UNKNOWN_OPTION, string-3);  return;
     }
-    /*
-    switch (string[1]) {
-    case 'a':      // Add input file to library
-        if (name1) {
-            AddObjectToLibrary(name1, name2);
-        }
-        else err.submit(ERR_UNKNOWN_OPTION, string);
-        break;
-
-    case 'x':      // Extract member(s) from library
-        if (name1) {
-            // Extract specified member
-            cmd.libraryOptions = CMDL_LIBRARY_EXTRACTMEM;
-            sym.Action  = SYMA_EXTRACT_MEMBER;
-            SymbolList.Push(&sym, sizeof(sym));
-        }
-        else {
-            // Extract all members
-            cmd.libraryOptions = CMDL_LIBRARY_EXTRACTALL;
-        }
-        break;
-
-    case 'd':   // Delete member from library
-        if (name1) {
-            // Delete specified member
-            cmd.libraryOptions = CMDL_LIBRARY_CONVERT;
-            sym.Action  = SYMA_DELETE_MEMBER;
-            SymbolList.Push(&sym, sizeof(sym));
-        }
-        else err.submit(ERR_UNKNOWN_OPTION, string);
-        break;
+    if (inputFile) {
+        libmode = 2;                  // Input file already specified. Remaining file names are object files to add
+    }
+    else {
+        libmode = 1;                  // The rest of the command line must be interpreted as library name and object file names
+    }
+    outputType = FILETYPE_FWC_LIB;
+}
 
-    default:
-        err.submit(ERR_UNKNOWN_OPTION, string);  // Unknown option
-    } */
+bool CCommandLineInterpreter::interpretLibraryCommand(char * string) {
+    // Interpret library commands after -lib. They apply to the following file names
+    if (strcmp(string, "a") == 0) {            // Add object files to library
+        libraryCommand = CMDL_LIBRARY_ADDMEMBER;
+    }
+    else if (strcmp(string, "d") == 0) {       // Delete members from library
+        libraryCommand = CMDL_LIBRARY_DELETEMEM;
+    }
+    else if (strcmp(string, "x") == 0) {       // Extract members from library
+        libraryCommand = CMDL_LIBRARY_EXTRACTMEM;
+    }
+    else if (strcmp(string, "xall") == 0) {    // Extract all members
+        libraryOptions |= CMDL_LIBRARY_EXTRACTALL;
+    }
+    else if (strcmp(string, "l") == 0) {       // List members
+        libraryOptions |= CMDL_LIBRARY_LIST;
+    }
+    else return false;
+    return true;
 }
 
 void CCommandLineInterpreter::interpretIlistOption(char * string) {
@@ -406,6 +474,20 @@ void CCommandLineInterpreter::interpretListOption(char * string) {
     outputListFile = string;
 }
 
+void CCommandLineInterpreter::interpretDiagOption(char * string) {
+    // Interpret diagnostics format option
+    if (strcmp(string, "json") == 0) diagFormat = CMDL_DIAG_JSON;
+    else if (strcmp(string, "text") == 0) diagFormat = CMDL_DIAG_TEXT;
+    else err.submit(ERR_UNKNOWN_OPTION, string);
+}
+
+void CCommandLineInterpreter::interpretFloatOption(char * string) {
+    // Interpret floating point output format option
+    if (strcmp(string, "short") == 0) floatFormat = FLOAT_FORMAT_SHORTEST;
+    else if (strcmp(string, "g") == 0) floatFormat = FLOAT_FORMAT_G;
+    else err.submit(ERR_UNKNOWN_OPTION, string);
+}
+
 void CCommandLineInterpreter::interpretOptimizationOption(char * string) {
     if (string[0] < '0' || string[0] > '9' || strlen(string) != 1) {
         err.submit(ERR_UNKNOWN_OPTION, string); return; // Unknown option
@@ -413,6 +495,14 @@ void CCommandLineInterpreter::interpretOptimizationOption(char * string) {
     optiLevel = string[0] - '0';
 }
 
+void CCommandLineInterpreter::interpretVerboseOption(char * string) {
+    // Interpret verbose option from command line
+    if (string[0] < '0' || string[0] > '2' || string[1] != 0) {
+        err.submit(ERR_UNKNOWN_OPTION, string); return; // Unknown option
+    }
+    verbose = string[0] - '0';
+}
+
 void CCommandLineInterpreter::interpretMaxErrorsOption(char * string) {
     // Interpret maxerrors option from command line
     if (string[0] == '=') string++;
@@ -435,6 +525,20 @@ void CCommandLineInterpreter::interpretDataSizeOption(char * string) {
     if (error) err.submit(ERR_UNKNOWN_OPTION, string);
 }
 
+void CCommandLineInterpreter::interpretThreadsOption(char * string) {
+    // Interpret threads option from command line
+    if (string[0] != '=') {
+        err.submit(ERR_UNKNOWN_OPTION, string); return; // Unknown option
+    }
+    uint32_t error = 0;
+    threads = (uint32_t)interpretNumber(string+1, 99, &error);
+    if (error) err.submit(ERR_UNKNOWN_OPTION, string);
+    if (threads == 0) {                                    // Use all processors
+        threads = std::thread::hardware_concurrency();
+        if (threads == 0) threads = 1;
+    }
+}
+
 void CCommandLineInterpreter::interpretErrorOption(char * string) {
     // Interpret warning/error option from command line
     if (strlen(string) < 3) {
@@ -480,7 +584,14 @@ void CCommandLineInterpreter::interpretErrorOption(char * string) {
 
 
 void CCommandLineInterpreter::reportStatistics() {
-    // Report statistics about name changes etc.
+    // Report statistics about memory use etc.
+    if (verbose < CMDL_VERBOSE_DIAGNOSTICS) return;
+    printf("\nMemory buffers: %u allocations, %.2f MB allocated, %.2f MB filled with zeroes",
+        (uint32_t)CMemoryBuffer::numAllocations, CMemoryBuffer::bytesAllocated / 1048576., CMemoryBuffer::bytesZeroed / 1048576.);
+    if (fitCacheLookups) {
+        printf("\nInstruction fit cache: %llu lookups, %llu hits (%.1f%%)", 
+            (unsigned long long)fitCacheLookups, (unsigned long long)fitCacheHits, fitCacheHits * 100. / fitCacheLookups);
+    }
 }
 
 
@@ -489,24 +600,42 @@ void CCommandLineInterpreter::help() {
     printf("\nBinary tools version %.2f beta for ForwardCom instruction set.", FORWARDCOM_VERSION);
     printf("\nCopyright (c) 2017 by Agner Fog. Gnu General Public License.");
     printf("\n\nUsage: forw command [options] inputfile [outputfile]");
+    printf("\n       outputfile can be given as -o filename. - means stdout.");
     printf("\n\nCommand:");
     printf("\n-ass       Assemble\n");
     printf("\n-dis       Disassemble object or executable file\n");
-    printf("\n-link      Link object files into executable file\n");
-    printf("\n-lib       Build or manage library file\n");
-    printf("\n-emu       Emulate and debug executable file\n");
+    printf("\n-link      Link object files into executable file:");
+    printf("\n           forw -link outputfile.ex inputfile1.ob inputfile2.ob ...\n");
+    printf("\n-lib       Build or manage library file:");
+    printf("\n           forw -lib library.li [-a] file1.ob file2.ob ...  Add or replace members.");
+    printf("\n           -d member.ob: Delete. -x member.ob: Extract. -xall: Extract all. -l: List.\n");
+    printf("\n-emu       Emulate and debug executable file");
+    printf("\n-emu-s     Emulate with scalar loops instead of SIMD for vector instructions");
+    printf("\n-emu-n     Emulate without combining micro-operations\n");
     printf("\n-dump-XXX  Dump file contents to console.");
     printf("\n           Values of XXX (can be combined):");
     printf("\n           f: File header, h: section Headers, s: Symbol table,");
     printf("\n           r: Relocation table, n: string table.\n");
+    printf("\n-ilist-compile  Make C++ source for built-in instruction list from csv file.\n");
     printf("\n-help      Print this help screen.");
 
     printf("\n\nAssemble options:");
     printf("\n-list=filename Specify file for output listing.");
     printf("\n-ON        Optimization level. N = 0-2.");
+    printf("\n-diag=json Write error messages to stderr as JSON lines.");
+
+    printf("\n\nLink options:");
+    printf("\n-threads=N Number of threads for copying and relocating sections. N = 0: all processors.");
+    printf("\n           Default = 1: sections are copied by one thread.");
+
+    printf("\n\nDisassemble options:");
+    printf("\n-threads=N Number of threads to use. N = 0: all processors. Default = 1.");
+    printf("\n-float=short Write floating point numbers in the shortest form that gives the exact value.");
+    printf("\n           Default: -float=g, printf %%G format, which may not give the exact value.");
 
     printf("\n\nGeneral options:");
-    printf("\n-ilist=filename Specify instruction list file.");
+    printf("\n-ilist=filename Specify instruction list file. Default: built-in list.");
+    printf("\n-vN       Verbose. N = 0: silent, 1: normal, 2: show statistics.");
     printf("\n-wdNNN     Disable Warning NNN.");
     printf("\n-weNNN     treat Warning NNN as Error. -wex: treat all warnings as errors.");
     printf("\n-edNNN     Disable Error number NNN.");
@@ -28,6 +28,7 @@ const int CMDL_JOB_DUMP =               3;       // Dump
 const int CMDL_JOB_LINK =               4;       // Link
 const int CMDL_JOB_LIB =                5;       // Library
 const int CMDL_JOB_EMU =                8;       // Emulate/Debug
+const int CMDL_JOB_ILIST =              9;       // Compile instruction list to built-in table
 const int CMDL_JOB_HELP =          0x1000;       // Show help
 
 // Constants for verbose or silent console output
@@ -35,6 +36,10 @@ const int CMDL_VERBOSE_NO =             0;     // Silent. No console output if n
 const int CMDL_VERBOSE_YES =            1;     // Output messages about file names and types
 const int CMDL_VERBOSE_DIAGNOSTICS =    2;     // Output more messages
 
+// Constants for diagnostics output format (assem)
+const int CMDL_DIAG_TEXT =              0;     // Error messages as text
+const int CMDL_DIAG_JSON =              1;     // Error messages as JSON lines
+
 // Constants for dump options
 const int DUMP_NONE =              0x0000;     // Dump nothing
 const int DUMP_FILEHDR =           0x0001;     // Dump file header
@@ -44,6 +49,10 @@ const int DUMP_RELTAB =            0x0020;     // Dump relocation table
 const int DUMP_STRINGTB =          0x0040;     // Dump string table
 const int DUMP_COMMENT =           0x0080;     // Dump comment records
 
+// Constants for emulate options
+const int CMDL_EMU_SCALAR =        0x0001;     // Execute vector instructions one element at a time
+const int CMDL_EMU_NOFUSE =        0x0002;     // Do not combine micro-operations
+
 // Constants for file input/output options
 const int CMDL_FILE_INPUT =             1;     // Input file required
 const int CMDL_FILE_IN_IF_EXISTS =      2;     // Read input file if it exists
@@ -54,8 +63,16 @@ const int CMDL_FILE_IN_OUT_SAME =    0x20;     // Input and output files may hav
 const int CMDL_LIBRARY_DEFAULT =        0;     // No option specified
 const int CMDL_LIBRARY_CONVERT =        1;     // Convert or modify library
 const int CMDL_LIBRARY_ADDMEMBER =      2;     // Add object file to library
+const int CMDL_LIBRARY_DELETEMEM =      4;     // Delete object file from library
 const int CMDL_LIBRARY_EXTRACTMEM = 0x100;     // Extract specified object file(s) from library
 const int CMDL_LIBRARY_EXTRACTALL = 0x110;     // Extract all object files from library
+const int CMDL_LIBRARY_LIST =       0x200;     // List library members and public symbols
+
+// Library command for one file name
+struct SLibraryCommand {
+    const char * name;                         // File name or member name
+    uint32_t command;                          // CMDL_LIBRARY_ADDMEMBER, CMDL_LIBRARY_DELETEMEM, or CMDL_LIBRARY_EXTRACTMEM
+};
 
 
 // Class for interpreting command line
@@ -63,10 +80,10 @@ class CCommandLineInterpreter {
 public:
     CCommandLineInterpreter();                // Default constructor
     void readCommandLine(int argc, char * argv[]);     // Read and interpret command line
-    void reportStatistics();                  // Report statistics about name changes etc.
+    void reportStatistics();                  // Report statistics about memory use etc.
     char const * inputFile;                   // Input file name
     char const * outputFile;                  // Output file name
-    char const * instructionListFile;         // File name of instruction list
+    char const * instructionListFile;         // File name of instruction list. 0 = use built-in list
     char const * outputListFile;              // File name of output list file (ass)
     int  job;                                 // Job to do: ass, dis, dump, link, lib, emu
     int  inputType;                           // Input file type (detected from file)
@@ -74,16 +91,26 @@ public:
     int  optiLevel;                           // Optimization level (asm)
     uint32_t maxErrors;                       // Maximum number of errors before assembler aborts
     uint32_t verbose;                         // How much diagnostics to print on screen
+    uint32_t diagFormat;                      // Format of error messages from assembler
+    int  floatFormat;                         // Format of floating point numbers in text output
     uint32_t dumpOptions;                     // Options for dumping file
+    uint32_t emulateOptions;                  // Options for emulation
     uint32_t fileOptions;                     // Options for input and output files
     uint32_t libraryOptions;                  // Options for library operations
     uint32_t linkOptions;                     // Options for linking
     uint32_t debugOptions;                    // Options for debug info in assembly. not supported yet
+    uint32_t threads;                         // Number of threads for disassembly and linking. 0 = all processors
     uint64_t codeSizeOption;                  // Option specifying max code size
     uint64_t dataSizeOption;                  // Option specifying max data size
+    CDynamicArray<const char *> linkFiles;    // Object files to link
+    CDynamicArray<SLibraryCommand> libraryCommands; // Library members to add, delete, or extract
     const char * programName;                 // Path and name of this program
+    uint64_t fitCacheLookups;                 // Statistics: number of lookups in instruction fit cache (assem)
+    uint64_t fitCacheHits;                    // Statistics: number of instructions found in fit cache (assem)
 protected:
     int  libmode;                             // -lib option has been encountered
+    uint32_t libraryCommand;                  // Library command for following file names
+    int  outputFileNext;                      // -o option has been encountered. Next item is output file name
     void readCommandItem(char *);             // Read one option from command line
     void readCommandFile(char *);             // Read commands from file
     void interpretFileName(char *);           // Interpret input or output filename from command line
@@ -91,14 +118,19 @@ protected:
     void interpretAssembleOption(char *);     // Interpret assemble option from command line
     void interpretDisassembleOption(char *);  // Interpret disassemble option from command line
     void interpretLibraryOption(char* string);// Interpret library option from command line
+    bool interpretLibraryCommand(char * string); // Interpret command after -lib. Return false if not a library command
     void interpretLinkOption(char * string);  // Interpret linking option from command line
     void interpretMaxErrorsOption(char * string); // Interpret maxerrors option from command line    
+    void interpretVerboseOption(char * string);   // Interpret verbose option from command line
     void interpretCodeSizeOption(char * string);  // Interpret codesize option from command line
     void interpretDataSizeOption(char * string);  // Interpret datasize option from command line
+    void interpretThreadsOption(char * string);   // Interpret threads option from command line
     void interpretEmulateOption(char *);      // Interpret emulate option from command line
     void help();                              // Print help message
     void interpretIlistOption(char *);        // Interpret instruction list file option
     void interpretListOption(char *);         // Interpret output list file option (assem)
+    void interpretDiagOption(char *);         // Interpret diagnostics format option (assem)
+    void interpretFloatOption(char *);        // Interpret floating point output format option
     void interpretOptimizationOption(char *); // Interpret optimization option (assem)
     void interpretDumpOption(char *);         // Interpret dump option from command line
     void interpretErrorOption(char *);        // Interpret error option from command line
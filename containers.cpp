@@ -26,10 +26,16 @@ SIntTxt FileFormatNames[] = {
 
 // Members of class CMemoryBuffer
 
+// Statistics
+std::atomic<uint32_t> CMemoryBuffer::numAllocations(0);
+std::atomic<uint64_t> CMemoryBuffer::bytesAllocated(0);
+std::atomic<uint64_t> CMemoryBuffer::bytesZeroed(0);
+
 // Constructor
 CMemoryBuffer::CMemoryBuffer() {  
     buffer = 0;
-    num_entries = data_size = buffer_size = 0;
+    num_entries = data_size = buffer_size = map_size = 0;
+    shared = false;
 }
 
 // Destructor
@@ -39,90 +45,136 @@ CMemoryBuffer::~CMemoryBuffer() {
 
 // De-allocate buffer
 void CMemoryBuffer::clear() {
-    if (buffer) delete[] buffer;
+    releaseBuffer();
     buffer = 0;
     num_entries = data_size = buffer_size = 0;
 }
 
-void CMemoryBuffer::setSize(uint32_t size) {
+// De-allocate buffer, or unmap it if it is a memory mapped file. A shared buffer is left to its owner
+void CMemoryBuffer::releaseBuffer() {
+    if (buffer && !shared) {
+#ifdef FWC_MMAP
+        if (map_size) munmap(buffer, map_size);
+        else
+#endif
+        free(buffer);
+    }
+    map_size = 0;
+    shared = false;
+}
+
+// Change size of allocated buffer. The data below data_size are preserved. The rest of the 
+// buffer is not initialized, except when a memory mapped file or shared buffer is copied. 
+// Large buffers are moved by realloc, which can remap the pages rather than copying them
+bool CMemoryBuffer::reallocate(uint64_t size) {
+    int8_t * buffer2;                            // New buffer
+    if (map_size || shared) {
+        // Memory mapped file or shared buffer. Copy the data into allocated memory
+        buffer2 = (int8_t*)malloc(size);
+        if (buffer2) {
+            uint64_t copySize = data_size < size ? data_size : size;
+            memcpy(buffer2, buffer, copySize);
+            // Fill the rest with zeroes. The tokenizer reads beyond the end of the data and relies 
+            // on the zero padding that a memory mapped file has
+            memset(buffer2 + copySize, 0, size - copySize);
+            bytesZeroed += size - copySize;
+            releaseBuffer();
+        }
+    }
+    else {
+        buffer2 = (int8_t*)realloc(buffer, size);
+    }
+    if (buffer2 == 0) {err.submit(ERR_MEMORY_ALLOCATION); return false;} // Error can't allocate
+    buffer = buffer2;                            // Save pointer to buffer
+    buffer_size = size;                          // Save size
+    numAllocations++;
+    bytesAllocated += size;
+    return true;
+}
+
+// Use the buffer of b without taking ownership. b must not be resized or deallocated while this
+// object is using its buffer. The shared data may be read or modified in place, but not truncated
+void CMemoryBuffer::share(CMemoryBuffer & b) {
+    clear();
+    buffer = b.buffer;
+    data_size = b.data_size;
+    buffer_size = b.data_size;
+    num_entries = b.num_entries;
+    shared = buffer != 0;
+}
+
+// Use the part of the buffer of b that begins at offset, e.g. a library member. 
+// The same restrictions apply as above
+void CMemoryBuffer::share(CMemoryBuffer & b, uint64_t offset, uint64_t size) {
+    clear();
+    if (offset > b.data_size || size > b.data_size - offset) {
+        err.submit(ERR_CONTAINER_INDEX);  return;
+    }
+    buffer = b.buffer + offset;
+    data_size = buffer_size = size;
+    shared = buffer != 0;
+}
+
+// Use memory mapped file as buffer. size = size of the mapping including zero padding
+void CMemoryBuffer::setMappedBuffer(int8_t * p, uint64_t size) {
+    releaseBuffer();
+    buffer = p;
+    buffer_size = map_size = size;
+}
+
+void CMemoryBuffer::setSize(uint64_t size) {
     // Allocate, reallocate or deallocate buffer of specified size.
     // DataSize is initially zero. It is increased by push or pushString.
-    // Setting size > dataSize will allocate more buffer and fill it with zeroes but not increase dataSize.
+    // Setting size > dataSize will allocate more buffer and fill it with zeroes up to size but not increase dataSize.
     // Setting size < dataSize will decrease dataSize so that some of the data are discarded.
+    // Space beyond size is not initialized.
     if (size < data_size) {
         // Request to delete some data
         data_size = size;
         return;
     }
-    if (size <= buffer_size) {
-        // Request to reduce size but not delete it
-        return;                                  // Ignore
+    if (size > buffer_size) {
+        // Double size and round up to value divisible by 16
+        if (!reallocate((size + buffer_size + 15) & uint64_t(-16))) return;
     }
-    size = (size + buffer_size + 15) & uint32_t(-16);   // Double size and round up to value divisible by 16
-    int8_t * buffer2 = 0;                        // New buffer
-    buffer2 = new int8_t[size];                  // Allocate new buffer
-    if (buffer2 == 0) {err.submit(ERR_MEMORY_ALLOCATION); return;} // Error can't allocate
-    memset (buffer2, 0, size);                   // Initialize to all zeroes
-    if (buffer) {
-        // A smaller buffer is previously allocated
-        memcpy (buffer2, buffer, buffer_size);   // Copy contents of old buffer into new
-        delete[] buffer;                         // De-allocate old buffer
+    if (size > data_size) {
+        memset (buffer + data_size, 0, size - data_size); // Initialize new space to zeroes
+        bytesZeroed += size - data_size;
     }
-    buffer = buffer2;                            // Save pointer to buffer
-    buffer_size = size;                          // Save size
 }
 
-uint32_t CMemoryBuffer::push(void const * obj, uint32_t size) {
+uint64_t CMemoryBuffer::push(void const * obj, uint64_t size) {
     // Add object to buffer, return offset
     // Parameters: 
     // obj = pointer to object, 0 if fill with zeroes
     // size = size of object to push
 
     // Old offset will be offset to new object
-    uint32_t OldOffset = data_size;
+    uint64_t OldOffset = data_size;
 
     // New data size will be old data size plus size of new object
-    uint32_t NewOffset = data_size + size;
+    uint64_t NewOffset = data_size + size;
 
     if (NewOffset > buffer_size) {
         // Buffer too small, allocate more space.
-        // We can use SetSize for this only if it is certain that obj is not 
-        // pointing to an object previously allocated in the old buffer
-        // because it would be deallocated before copied into the new buffer:
-        // SetSize (NewOffset + NewOffset / 2 + 1024);
+        // obj may point to an object in the old buffer. Find its offset so that it can be
+        // found in the new buffer
+        uint64_t objOffset = (int8_t const*)obj - buffer;
+        bool objInBuffer = buffer && obj && objOffset < buffer_size;
 
-        // Allocate more space without using SetSize:
         // Double the size + 1 kB, and round up size to value divisible by 16
-        uint32_t NewSize = (NewOffset * 2 + 1024 + 15) & uint32_t(-16);
-        int8_t * buffer2 = 0;                    // New buffer
-        // Allocate new buffer
-        buffer2 = new int8_t[NewSize];
-        if (buffer2 == 0) {
-            // Error can't allocate
-            err.submit(ERR_MEMORY_ALLOCATION);  return 0;
-        }
-        // Initialize to all zeroes
-        memset (buffer2, 0, NewSize);
-        if (buffer) {
-            // A smaller buffer is previously allocated
-            // Copy contents of old buffer into new
-            memcpy (buffer2, buffer, buffer_size);
-        }
-        buffer_size = NewSize;                   // Save size
-        if (obj && size) {                         
-            // Copy object to new buffer
-            memcpy (buffer2 + OldOffset, obj, size);
-            obj = 0;                             // Prevent copying once more
-        }
-        // Delete old buffer after copying object
-        if (buffer) delete[] buffer;
-
-        // Save pointer to new buffer
-        buffer = buffer2;
+        uint64_t NewSize = (NewOffset * 2 + 1024 + 15) & uint64_t(-16);
+        if (!reallocate(NewSize)) return 0;
+        if (objInBuffer) obj = buffer + objOffset;
+    }
+    if (obj) {
+        // Copy object to buffer
+        if (size) memcpy (buffer + OldOffset, obj, size);
     }
-    // Copy object to buffer if nonzero
-    if (obj && size) {
-        memcpy (buffer + OldOffset, obj, size);
+    else if (size) {
+        // No object. Fill with zeroes
+        memset (buffer + OldOffset, 0, size);
+        bytesZeroed += size;
     }
     if (size) {
         // Adjust new offset
@@ -134,24 +186,27 @@ uint32_t CMemoryBuffer::push(void const * obj, uint32_t size) {
     return OldOffset;
 }
 
-uint32_t CMemoryBuffer::pushString(char const * s) {
+uint64_t CMemoryBuffer::pushString(char const * s) {
     // Add ASCIIZ string to buffer, return offset
-    return push (s, uint32_t(strlen(s))+1);
+    return push (s, strlen(s)+1);
 }
 
-uint32_t CMemoryBuffer::getLastIndex() const {
+uint64_t CMemoryBuffer::getLastIndex() const {
     // Index of last object pushed (zero-based)
     return num_entries - 1;
 }
 
-void CMemoryBuffer::align(uint32_t a) {
+void CMemoryBuffer::align(uint64_t a) {
     // Align next entry to address divisible by a. must be a power of 2
-    // uint32_t NewOffset = (data_size + a - 1) / a * a;   // use this if a is not a power of 2
-    uint32_t NewOffset = (data_size + a - 1) & (-(int32_t)a);
+    // uint64_t NewOffset = (data_size + a - 1) / a * a;   // use this if a is not a power of 2
+    uint64_t NewOffset = (data_size + a - 1) & (0 - a);
     if (NewOffset > buffer_size) {
         // Allocate more space
         setSize (NewOffset + 2048);
     }
+    // Fill alignment space with zeroes
+    memset (buffer + data_size, 0, NewOffset - data_size);
+    bytesZeroed += NewOffset - data_size;
     // Set DataSize to after alignment space
     data_size = NewOffset;
 }
@@ -182,7 +237,7 @@ CFileBuffer::CFileBuffer(char const * filename) : CMemoryBuffer() {
 void CFileBuffer::read(int ignoreError) {                   
     // Read file into buffer
     // InoreError: 0: abort on error, 1: ignore error, 2: search for file also in exe directory
-    uint32_t status;                             // Error status
+    uint64_t status;                             // Error status
 
     const int MAXPATHL = 1024;                   // Buffer for constructing file path
     char name[MAXPATHL];
@@ -215,12 +270,18 @@ void CFileBuffer::read(int ignoreError) {
             setSize(0); return;                  // Make empty file buffer
         }
     }
-    data_size = _filelength(fh);                 // Get file size
-    if (data_size <= 0) {
+    int64_t fsize = _filelengthi64(fh);          // Get file size
+    if (fsize <= 0) {
         if (ignoreError != 1) err.submit(ERR_FILE_SIZE, fileName); // Wrong size
-        return;}
+        _close(fh);  return;}
+    data_size = (uint64_t)fsize;
     setSize(data_size + 2048);                   // Allocate buffer, 2k extra
-    status = _read(fh, buf(), data_size);        // Read from file
+    // Read from file. _read can read less than 4 GB at a time
+    for (status = 0; status < data_size; ) {
+        int n = _read(fh, buf() + status, (unsigned int)(data_size - status < 0x40000000 ? data_size - status : 0x40000000));
+        if (n <= 0) break;
+        status += n;
+    }
     if (status != data_size) err.submit(ERR_INPUT_FILE, fileName);
     status = _close(fh);                         // Close file
     if (status != 0) err.submit(ERR_INPUT_FILE, fileName);
@@ -249,18 +310,37 @@ void CFileBuffer::read(int ignoreError) {
         }
     }
     // Find file size
-    fseek(fh, 0, SEEK_END);
+    if (fseek(fh, 0, SEEK_END) != 0) {
+        // File is not seekable, e.g. a pipe. Read it in blocks
+        const uint64_t blockSize = 0x10000;
+        data_size = 0;
+        do {
+            setSize(data_size + blockSize + 2048);   // Allocate buffer, 2k extra
+            status = fread(buf() + data_size, 1, blockSize, fh);
+            data_size += status;
+        } while (status == blockSize);
+        if (ferror(fh)) err.submit(ERR_INPUT_FILE, fileName);
+        else if (data_size == 0) err.submit(ERR_FILE_SIZE, fileName);
+        fclose(fh);
+        return;
+    }
     long int fsize = ftell(fh);
-    if (fsize <= 0 || (unsigned long)fsize >= 0xFFFFFFFF) {
-        // File too big or zero size
+    if (fsize <= 0) {
+        // Zero size or too big for long int
         err.submit(ERR_FILE_SIZE, fileName); fclose(fh); return;
     }
-    data_size = (uint32_t)fsize;
+    data_size = (uint64_t)fsize;
+#ifdef FWC_MMAP
+    // Map file into memory instead of reading it if possible
+    if (mapFile(fileno(fh))) {
+        fclose(fh);  return;
+    }
+#endif
     rewind(fh);
     // Allocate buffer
     setSize(data_size + 2048);                    // Allocate buffer, 2k extra
     // Read entire file
-    status = (uint32_t)fread(buf(), 1, data_size, fh);
+    status = fread(buf(), 1, data_size, fh);
     if (status != data_size) err.submit(ERR_INPUT_FILE, fileName);
     status = fclose(fh);
     if (status != 0) err.submit(ERR_INPUT_FILE, fileName);
@@ -275,24 +355,36 @@ void CFileBuffer::write() {
         err.submit(ERR_OUTPUT_FILE);
         return;
     }
+    if (strcmp(fileName, "-") == 0) {
+        // Write to stdout
+#ifdef _MSC_VER
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        if (fwrite(buf(), 1, (size_t)data_size, stdout) != data_size || fflush(stdout)) {
+            err.submit(ERR_OUTPUT_FILE, fileName);
+        }
+        return;
+    }
     // Two alternative ways to write a file:
 
 #ifdef _MSC_VER    // Microsoft compiler prefers this:
 
     int fh;                                      // File handle
-    uint32_t status;                             // Error status
+    uint64_t status;                             // Error status
     // Open file in binary mode
     fh = _open(fileName, O_RDWR | O_BINARY | O_CREAT | O_TRUNC, _S_IREAD | _S_IWRITE); 
     // Check if error
     if (fh == -1) {err.submit(ERR_OUTPUT_FILE, fileName);  return;}
-    // Write file
-    status = _write(fh, buf(), data_size);
+    // Write file. _write can write less than 4 GB at a time
+    for (status = 0; status < data_size; ) {
+        int n = _write(fh, buf() + status, (unsigned int)(data_size - status < 0x40000000 ? data_size - status : 0x40000000));
+        if (n <= 0) break;
+        status += n;
+    }
     // Check if error
     if (status != data_size) err.submit(ERR_OUTPUT_FILE, fileName);
-    // Close file
-    status = _close(fh);
-    // Check if error
-    if (status != 0) err.submit(ERR_OUTPUT_FILE, fileName);
+    // Close file and check if error
+    if (_close(fh) != 0) err.submit(ERR_OUTPUT_FILE, fileName);
 
 #else              // Works with most compilers:
 
@@ -301,7 +393,7 @@ void CFileBuffer::write() {
     // Check if error
     if (!ff) {err.submit(ERR_OUTPUT_FILE, fileName);  return;}
     // Write file
-    uint32_t n = (uint32_t)fwrite(buf(), 1, data_size, ff);
+    uint64_t n = fwrite(buf(), 1, data_size, ff);
     // Check if error
     if (n != data_size) err.submit(ERR_OUTPUT_FILE, fileName);
     // Close file
@@ -333,6 +425,10 @@ int CFileBuffer::getFileType() {
         }
         machineType = get<Elf64_Ehdr>(0).e_machine;   // Copy file header.e_machine;
     }
+    else if (data_size >= sizeof(LIBRARY_SIGNATURE) && memcmp(buf(), LIBRARY_SIGNATURE, sizeof(LIBRARY_SIGNATURE)) == 0) {
+        // ForwardCom library
+        fileType = FILETYPE_FWC_LIB;
+    }
     else {
         // Unknown file type
         int utype = get<uint32_t>(0);        
@@ -392,6 +488,28 @@ char * CFileBuffer::setFileNameExtension(const char * f) {
     return name;
 }
 
+#ifdef FWC_MMAP
+bool CFileBuffer::mapFile(int fd) {
+    // Map input file into memory. Returns false if the file cannot be mapped, e.g. if it is a pipe.
+    // The mapping is private so that the buffer can be modified without changing the file.
+    // The 2k extra space after the file is covered by an anonymous mapping filled with zeroes,
+    // so that the buffer has the same zero padding as when the file is read
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || (uint64_t)st.st_size != data_size) return false;
+    uint64_t pageSize = (uint64_t)sysconf(_SC_PAGESIZE);
+    uint64_t mapSize = ((uint64_t)data_size + 2048 + pageSize - 1) & ~(pageSize - 1);
+    // Reserve address space for file and padding
+    void * p = mmap(0, (size_t)mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) return false;
+    // Map file over the first part
+    if (mmap(p, data_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        munmap(p, (size_t)mapSize);  return false;
+    }
+    setMappedBuffer((int8_t*)p, mapSize);
+    return true;
+}
+#endif
+
 void CFileBuffer::checkOutputFileName() {
     // Make output file name or check that requested name is valid
     if (!(cmd.fileOptions & CMDL_FILE_OUTPUT)) return;
@@ -409,26 +527,30 @@ void CFileBuffer::checkOutputFileName() {
 
 void operator >> (CMemoryBuffer & a, CMemoryBuffer & b) {
     // Transfer ownership of buffer and other properties from a to b
-    b.setSize(0);                                // De-allocate old buffer from target if it has one
+    b.clear();                                   // De-allocate old buffer from target if it has one
     b.buffer = a.buffer;                         // Transfer buffer
     a.buffer = 0;                                // Remove buffer from source, so that buffer has only one owner
 
     // Copy properties
     b.data_size   = a.dataSize();                // Size of data, offset to vacant space
     b.buffer_size = a.bufferSize();              // Size of allocated buffer
+    b.map_size    = a.map_size;                  // Buffer is memory mapped
+    b.shared      = a.shared;                    // Buffer is owned by another container
     b.num_entries = a.numEntries();              // Number of objects pushed
-    a.setSize(0);                                // Reset a's properties
+    a.clear();                                   // Reset a's properties
 }
 
 void operator >> (CFileBuffer & a, CFileBuffer & b) {
     // Transfer ownership of buffer and other properties from a to b
-    b.setSize(0);                                // De-allocate old buffer from target if it has one
+    b.clear();                                   // De-allocate old buffer from target if it has one
     b.buffer = a.buffer;                         // Transfer buffer
     a.buffer = 0;                                // Remove buffer from source, so that buffer has only one owner
 
     // Copy properties
     b.data_size   = a.dataSize();                // Size of data, offset to vacant space
     b.buffer_size = a.bufferSize();              // Size of allocated buffer
+    b.map_size    = a.map_size;                  // Buffer is memory mapped
+    b.shared      = a.shared;                    // Buffer is owned by another container
     b.num_entries = a.numEntries();              // Number of objects pushed
     b.executable = a.executable;                 // File is executable
     b.machineType = a.machineType;               // Machine type
@@ -436,7 +558,7 @@ void operator >> (CFileBuffer & a, CFileBuffer & b) {
     if (a.fileName) b.fileName = a.fileName;     // Name of input file
     if (a.outputFileName) b.outputFileName = a.outputFileName;// Name of output file
     if (a.getFileType())  b.fileType = a.getFileType();       // Object file type
-    a.setSize(0);                                // Reset a's properties
+    a.clear();                                   // Reset a's properties
 }
 
 
@@ -444,6 +566,8 @@ void operator >> (CFileBuffer & a, CFileBuffer & b) {
 // Constructor
 CTextFileBuffer::CTextFileBuffer() {
     column = 0;
+    stream = 0;
+    floatFormat = cmd.floatFormat;               // printf %G or shortest round-trip
 #ifdef _WIN32
     lineType = 0;                                // DOS/Windows type linefeed
 #else
@@ -451,10 +575,10 @@ CTextFileBuffer::CTextFileBuffer() {
 #endif
 }
 
-uint32_t CTextFileBuffer::put(const char * text) {
+uint64_t CTextFileBuffer::put(const char * text) {
     // Write text string to buffer
     uint32_t len = (uint32_t)strlen(text);       // Length of text
-    uint32_t ret = push(text, len);              // Add to buffer without terminating zero
+    uint64_t ret = push(text, len);              // Add to buffer without terminating zero
     column += len;                               // Update column
     return ret;                                  // Return index
 }
@@ -465,10 +589,10 @@ void CTextFileBuffer::put(const char character) {
     column ++;                                   // Update column
 }
 
-uint32_t CTextFileBuffer::putStringN(const char * s, uint32_t len) {
+uint64_t CTextFileBuffer::putStringN(const char * s, uint64_t len) {
     // Write string to buffer, add terminating zero
     static const int8_t nul = 0;
-    uint32_t retval = push(s, len);  
+    uint64_t retval = push(s, len);  
     push(&nul, 1);
     num_entries--;                               // compensate for pushing twice
     column += len + 1;
@@ -484,76 +608,429 @@ void CTextFileBuffer::newLine() {
         push("\n", 1);                           // UNIX style linefeed
     }
     column = 0;                                  // Reset column
+    checkStream();                               // Write chunk if streaming
+}
+
+void CTextFileBuffer::setStream(const char * filename) {
+    // Write text to file in chunks while it is being generated instead of keeping it all in memory.
+    // filename "-" means stdout. write() must be called at the end
+    fileName = outputFileName = filename;
+    if (filename == 0) {
+        err.submit(ERR_OUTPUT_FILE);  return;
+    }
+    if (strcmp(filename, "-") == 0) {
+        stream = stdout;
+    }
+    else {
+        stream = fopen(filename, "wb");
+        if (!stream) err.submit(ERR_OUTPUT_FILE, filename);
+    }
+}
+
+void CTextFileBuffer::flushStream() {
+    // Write buffered text to stream and empty the buffer. The column is unchanged
+    if (fwrite(buf(), 1, (size_t)dataSize(), stream) != dataSize()) {
+        err.submit(ERR_OUTPUT_FILE, fileName);
+    }
+    setSize(0);
+}
+
+void CTextFileBuffer::write() {
+    // Write buffer to file, or write the rest of the text if streaming
+    if (stream == 0) {
+        CFileBuffer::write();  return;
+    }
+    flushStream();
+    if (stream == stdout) {
+        if (fflush(stdout)) err.submit(ERR_OUTPUT_FILE, fileName);
+    }
+    else if (fclose(stream)) err.submit(ERR_OUTPUT_FILE, fileName);
+    stream = 0;
 }
 
 void CTextFileBuffer::tabulate(uint32_t i) {
     // Insert spaces until column i
-    uint32_t j;
+    static const char spaces[] = "                                ";  // 32 spaces
     if (i > column) {                            // Only insert spaces if we are not already past i
-        for (j = column; j < i; j++) push(" ", 1); // Insert i - column spaces
+        uint32_t n = i - column;                 // Insert i - column spaces
+        while (n > 32) {
+            push(spaces, 32);  n -= 32;
+        }
+        push(spaces, n);
         column = i;                              // Update column
     }
 }
 
+// Digits used by putHex and putDecimal
+static const char hexDigits[] = "0123456789ABCDEF";
+static const char decimalPairs[] =               // two-digit decimal numbers 00 - 99
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
 void CTextFileBuffer::putDecimal(int32_t x, int IsSigned) {
     // Write decimal number to buffer, unsigned or signed
     char text[16];
-    sprintf(text, IsSigned ? "%i" : "%u", x);
-    put(text);
+    char * p = text + sizeof(text);              // digits are generated backwards
+    uint32_t u = x;
+    if (IsSigned && x < 0) u = 0 - u;
+    while (u >= 100) {
+        uint32_t i = (u % 100) * 2;
+        u /= 100;
+        p -= 2;  p[0] = decimalPairs[i];  p[1] = decimalPairs[i+1];
+    }
+    if (u >= 10) {
+        p -= 2;  p[0] = decimalPairs[u*2];  p[1] = decimalPairs[u*2+1];
+    }
+    else *--p = char('0' + u);
+    if (IsSigned && x < 0) *--p = '-';
+    uint32_t len = uint32_t(text + sizeof(text) - p);
+    push(p, len);
+    column += len;
+}
+
+void CTextFileBuffer::putHexDigits(uint64_t x, uint32_t minDigits, int ox) {
+    // Write hexadecimal number with at least minDigits digits
+    // ox & 1: put 0x prefix
+    char text[24];
+    char * p = text + sizeof(text);              // digits are generated backwards
+    char * stop = p - minDigits;
+    do {
+        *--p = hexDigits[x & 0xF];
+        x >>= 4;
+    } while (x || p > stop);
+    if (ox & 1) {
+        p -= 2;  p[0] = '0';  p[1] = 'x';
+    }
+    uint32_t len = uint32_t(text + sizeof(text) - p);
+    push(p, len);
+    column += len;
 }
 
 void CTextFileBuffer::putHex(uint8_t x, int ox) {
     // Write hexadecimal 8 bit number to buffer
     // ox meaning: 1 = put 0x prefix, 2 = prefix zeroes to fixed length
-    char text[16];
-    sprintf(text, ox & 2 ? "%s%02X" : "%s%X", ox & 1 ? "0x" : "", x);
-    put(text);
+    putHexDigits(x, ox & 2 ? 2 : 1, ox);
 }
 
 void CTextFileBuffer::putHex(uint16_t x, int ox) {
     // Write hexadecimal 16 bit number to buffer
     // ox meaning: 1 = put 0x prefix, 2 = prefix zeroes to fixed length
-    char text[16];
-    sprintf(text, ox & 2 ? "%s%04X" : "%s%X", ox & 1 ? "0x" : "", x);
-    put(text);
+    putHexDigits(x, ox & 2 ? 4 : 1, ox);
 }
 
 void CTextFileBuffer::putHex(uint32_t x, int ox) {
     // Write hexadecimal 32 bit number to buffer
     // ox meaning: 1 = put 0x prefix, 2 = prefix zeroes to fixed length
-    char text[16];
-    sprintf(text, ox & 2 ? "%s%08X" : "%s%X", ox & 1 ? "0x" : "", x);
-    put(text);
+    putHexDigits(x, ox & 2 ? 8 : 1, ox);
 }
 
 void CTextFileBuffer::putHex(uint64_t x, int ox) {
     // Write unsigned hexadecimal 64 bit number to buffer
     // ox meaning: 1 = put 0x prefix, 2 = prefix zeroes to fixed length
-    char text[32];
-    if (ox & 2) {  // Print all digits
-        sprintf(text, "%s%08X%08X", ox & 1 ? "0x" : "", highDWord(x), uint32_t(x));
+    putHexDigits(x, ox & 2 ? 16 : 1, ox);
+}
+
+/* Shortest round-trip conversion of floating point numbers to decimal.
+This uses the Grisu2 algorithm by Florian Loitsch: "Printing Floating-Point
+Numbers Quickly and Accurately with Integers", PLDI 2010.
+The number is represented as a 64-bit significand f and a binary exponent e,
+value = f * 2^e. The boundaries between this number and its neighbors are
+scaled by a cached power of 10 so that the digits can be generated with
+integer arithmetic. The result always converts back to the same number, and 
+it is the shortest such decimal string in almost all cases. Grisu2 narrows the
+boundaries to allow for rounding errors, so it can miss a shorter string close
+to a boundary. shortenDigits finds the shortest string in these cases. */
+
+struct SDiyFp {                                  // floating point number with 64-bit significand
+    uint64_t f;                                  // significand
+    int32_t  e;                                  // binary exponent
+};
+
+// Multiply two numbers, keeping the upper 64 bits of the significand, rounded
+static inline SDiyFp diyMultiply(SDiyFp a, SDiyFp b) {
+    const uint64_t m32 = 0xFFFFFFFF;
+    uint64_t ah = a.f >> 32, al = a.f & m32, bh = b.f >> 32, bl = b.f & m32;
+    uint64_t hh = ah * bh, lh = al * bh, hl = ah * bl, ll = al * bl;
+    uint64_t mid = (ll >> 32) + (hl & m32) + (lh & m32) + ((uint64_t)1 << 31);  // round
+    SDiyFp r = {hh + (hl >> 32) + (lh >> 32) + (mid >> 32), a.e + b.e + 64};
+    return r;
+}
+
+// Shift significand left until the most significant bit is set
+static inline SDiyFp diyNormalize(SDiyFp a) {
+    while (!(a.f & ((uint64_t)1 << 63))) {
+        a.f <<= 1;  a.e--;
     }
-    else { // Skip leading zeroes
-        if (highDWord(x)) {
-            sprintf(text, "%s%X%08X", ox & 1 ? "0x" : "", highDWord(x), uint32_t(x));
+    return a;
+}
+
+// Normalized powers of 10: 10^k for k = -348, -340, ..., 340
+static const SDiyFp cachedPowers[] = {
+    {0xFA8FD5A0081C0288ULL,-1220}, {0xBAAEE17FA23EBF76ULL,-1193}, {0x8B16FB203055AC76ULL,-1166},
+    {0xCF42894A5DCE35EAULL,-1140}, {0x9A6BB0AA55653B2DULL,-1113}, {0xE61ACF033D1A45DFULL,-1087},
+    {0xAB70FE17C79AC6CAULL,-1060}, {0xFF77B1FCBEBCDC4FULL,-1034}, {0xBE5691EF416BD60CULL,-1007},
+    {0x8DD01FAD907FFC3CULL, -980}, {0xD3515C2831559A83ULL, -954}, {0x9D71AC8FADA6C9B5ULL, -927},
+    {0xEA9C227723EE8BCBULL, -901}, {0xAECC49914078536DULL, -874}, {0x823C12795DB6CE57ULL, -847},
+    {0xC21094364DFB5637ULL, -821}, {0x9096EA6F3848984FULL, -794}, {0xD77485CB25823AC7ULL, -768},
+    {0xA086CFCD97BF97F4ULL, -741}, {0xEF340A98172AACE5ULL, -715}, {0xB23867FB2A35B28EULL, -688},
+    {0x84C8D4DFD2C63F3BULL, -661}, {0xC5DD44271AD3CDBAULL, -635}, {0x936B9FCEBB25C996ULL, -608},
+    {0xDBAC6C247D62A584ULL, -582}, {0xA3AB66580D5FDAF6ULL, -555}, {0xF3E2F893DEC3F126ULL, -529},
+    {0xB5B5ADA8AAFF80B8ULL, -502}, {0x87625F056C7C4A8BULL, -475}, {0xC9BCFF6034C13053ULL, -449},
+    {0x964E858C91BA2655ULL, -422}, {0xDFF9772470297EBDULL, -396}, {0xA6DFBD9FB8E5B88FULL, -369},
+    {0xF8A95FCF88747D94ULL, -343}, {0xB94470938FA89BCFULL, -316}, {0x8A08F0F8BF0F156BULL, -289},
+    {0xCDB02555653131B6ULL, -263}, {0x993FE2C6D07B7FACULL, -236}, {0xE45C10C42A2B3B06ULL, -210},
+    {0xAA242499697392D3ULL, -183}, {0xFD87B5F28300CA0EULL, -157}, {0xBCE5086492111AEBULL, -130},
+    {0x8CBCCC096F5088CCULL, -103}, {0xD1B71758E219652CULL,  -77}, {0x9C40000000000000ULL,  -50},
+    {0xE8D4A51000000000ULL,  -24}, {0xAD78EBC5AC620000ULL,    3}, {0x813F3978F8940984ULL,   30},
+    {0xC097CE7BC90715B3ULL,   56}, {0x8F7E32CE7BEA5C70ULL,   83}, {0xD5D238A4ABE98068ULL,  109},
+    {0x9F4F2726179A2245ULL,  136}, {0xED63A231D4C4FB27ULL,  162}, {0xB0DE65388CC8ADA8ULL,  189},
+    {0x83C7088E1AAB65DBULL,  216}, {0xC45D1DF942711D9AULL,  242}, {0x924D692CA61BE758ULL,  269},
+    {0xDA01EE641A708DEAULL,  295}, {0xA26DA3999AEF774AULL,  322}, {0xF209787BB47D6B85ULL,  348},
+    {0xB454E4A179DD1877ULL,  375}, {0x865B86925B9BC5C2ULL,  402}, {0xC83553C5C8965D3DULL,  428},
+    {0x952AB45CFA97A0B3ULL,  455}, {0xDE469FBD99A05FE3ULL,  481}, {0xA59BC234DB398C25ULL,  508},
+    {0xF6C69A72A3989F5CULL,  534}, {0xB7DCBF5354E9BECEULL,  561}, {0x88FCF317F22241E2ULL,  588},
+    {0xCC20CE9BD35C78A5ULL,  614}, {0x98165AF37B2153DFULL,  641}, {0xE2A0B5DC971F303AULL,  667},
+    {0xA8D9D1535CE3B396ULL,  694}, {0xFB9B7CD9A4A7443CULL,  720}, {0xBB764C4CA7A44410ULL,  747},
+    {0x8BAB8EEFB6409C1AULL,  774}, {0xD01FEF10A657842CULL,  800}, {0x9B10A4E5E9913129ULL,  827},
+    {0xE7109BFBA19C0C9DULL,  853}, {0xAC2820D9623BF429ULL,  880}, {0x80444B5E7AA7CF85ULL,  907},
+    {0xBF21E44003ACDD2DULL,  933}, {0x8E679C2F5E44FF8FULL,  960}, {0xD433179D9C8CB841ULL,  986},
+    {0x9E19DB92B4E31BA9ULL, 1013}, {0xEB96BF6EBADF77D9ULL, 1039}, {0xAF87023B9BF0EE6BULL, 1066},
+};
+
+// Generate decimal digits for the number w with upper boundary mp. delta is the
+// distance between the boundaries. The result is digits * 10^K
+static void grisuDigits(SDiyFp w, SDiyFp mp, uint64_t delta, char * buffer, int & len, int & K) {
+    static const uint64_t pow10[20] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 
+        1000000000, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL, 
+        1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL};
+    const int shift = -mp.e;
+    const uint64_t one = (uint64_t)1 << shift;
+    const uint64_t wpw = mp.f - w.f;            // distance from w to upper boundary
+    uint32_t p1 = uint32_t(mp.f >> shift);       // integer part
+    uint64_t p2 = mp.f & (one - 1);              // fraction part
+    int kappa = 1;                               // number of digits in integer part
+    while (kappa < 10 && p1 >= pow10[kappa]) kappa++;
+    len = 0;
+    uint64_t rest, tenKappa;
+    for (;;) {
+        if (kappa > 0) {
+            // digits of integer part
+            uint32_t d = uint32_t(p1 / pow10[kappa-1]);
+            p1 = uint32_t(p1 % pow10[kappa-1]);
+            if (d || len) buffer[len++] = char('0' + d);
+            kappa--;
+            rest = ((uint64_t)p1 << shift) + p2;
+            if (rest > delta) continue;
+            tenKappa = pow10[kappa] << shift;
         }
         else {
-            sprintf(text, "%s%X", ox & 1 ? "0x" : "", uint32_t(x));
+            // digits of fraction part
+            p2 *= 10;  delta *= 10;
+            uint32_t d = uint32_t(p2 >> shift);
+            if (d || len) buffer[len++] = char('0' + d);
+            p2 &= one - 1;
+            kappa--;
+            rest = p2;
+            if (rest >= delta) continue;
+            tenKappa = one;
         }
+        break;
     }
-    put(text);
+    K += kappa;
+    // round last digit towards w
+    uint64_t wpwk = kappa >= 0 ? wpw : (-kappa < 20 ? wpw * pow10[-kappa] : 0);
+    while (rest < wpwk && delta - rest >= tenKappa 
+        && (rest + tenKappa < wpwk || wpwk - rest > rest + tenKappa - wpwk)) {
+        buffer[len-1]--;
+        rest += tenKappa;
+    }
+}
+
+// Find shortest digits for positive number f * 2^e, including any implicit leading bit.
+// lowerCloser is true if f is a power of 2 so that the lower neighbor is closer.
+// The result is digits * 10^K
+// Check if digits * 10^K converts back to the floating point number with the given bits
+static bool decimalRoundTrips(const char * digits, int len, int K, uint64_t bits, bool isFloat) {
+    char text[48];
+    char * p = text + len;
+    memcpy(text, digits, len);
+    *p++ = 'e';
+    if (K < 0) {*p++ = '-';  K = -K;}
+    if (K >= 100) {*p++ = char('0' + K / 100);  K %= 100;}
+    *p++ = char('0' + K / 10);  *p++ = char('0' + K % 10);  *p = 0;
+    if (isFloat) {
+        float f = strtof(text, 0);  uint32_t b;
+        memcpy(&b, &f, 4);
+        return b == (uint32_t)bits;
+    }
+    double d = strtod(text, 0);  uint64_t b;
+    memcpy(&b, &d, 8);
+    return b == bits;
+}
+
+// Remove digits from the result of grisu2 as long as the number converts back to the same
+// value. bits is the positive floating point number. The numbers that convert back to the 
+// same value form an interval that contains digits * 10^K. If a shorter number is in this 
+// interval, then digits rounded down or rounded up to the same length is in it too
+static void shortenDigits(char * digits, int & len, int & K, uint64_t bits, bool isFloat) {
+    char down[32], up[32];                       // digits rounded down and up
+    while (len > 1) {
+        int n = len - 1;                         // try one digit less
+        int downLen = n, upLen = n, upK = K + 1;
+        memcpy(down, digits, n);
+        memcpy(up, digits, n);
+        int i = n - 1;
+        while (i >= 0 && up[i] == '9') up[i--] = '0';
+        if (i >= 0) up[i]++;
+        else {                                   // 999 + 1 = 1000
+            up[0] = '1';  upLen = 1;  upK = K + 1 + n;
+        }
+        while (downLen > 1 && down[downLen-1] == '0') downLen--;  // remove trailing zeroes
+        while (upLen > 1 && up[upLen-1] == '0') {upLen--;  upK++;}
+        int downK = K + 1 + (n - downLen);
+        bool upFirst = digits[n] >= '5';         // try the nearest first
+        int c;
+        for (c = 0; c < 2; c++) {
+            if ((c == 0) == upFirst) {
+                if (decimalRoundTrips(up, upLen, upK, bits, isFloat)) {
+                    memcpy(digits, up, upLen);  len = upLen;  K = upK;
+                    break;
+                }
+            }
+            else if (decimalRoundTrips(down, downLen, downK, bits, isFloat)) {
+                memcpy(digits, down, downLen);  len = downLen;  K = downK;
+                break;
+            }
+        }
+        if (c == 2) return;                      // neither fits. digits is the shortest
+    }
+}
+
+static void grisu2(uint64_t f, int32_t e, bool lowerCloser, char * buffer, int & len, int & K) {
+    SDiyFp v = {f, e};
+    // boundaries halfway to the neighbor numbers
+    SDiyFp mp = {(f << 1) + 1, e - 1};
+    mp = diyNormalize(mp);
+    SDiyFp mm;
+    if (lowerCloser) {mm.f = (f << 2) - 1;  mm.e = e - 2;}
+    else {mm.f = (f << 1) - 1;  mm.e = e - 1;}
+    mm.f <<= mm.e - mp.e;  mm.e = mp.e;
+    // find cached power of 10 that brings the exponent into the range -60 to -32
+    double dk = (-61 - mp.e) * 0.30102999566398114 + 347;
+    int k = int(dk);
+    if (dk - k > 0.0) k++;
+    uint32_t index = (k >> 3) + 1;
+    K = -(-348 + int(index << 3));
+    SDiyFp c = cachedPowers[index];
+    SDiyFp w = diyMultiply(diyNormalize(v), c);
+    SDiyFp wp = diyMultiply(mp, c);
+    SDiyFp wm = diyMultiply(mm, c);
+    wm.f++;  wp.f--;
+    grisuDigits(w, wp, wp.f - wm.f, buffer, len, K);
+}
+
+void CTextFileBuffer::putFloatDigits(const char * digits, int len, int K, int precision, bool negative) {
+    // Write decimal number digits * 10^K in the same style as printf %G.
+    // Exponential notation is used if the exponent is < -4 or >= precision
+    char text[64];
+    char * p = text;
+    while (len > 1 && digits[len-1] == '0') {    // remove trailing zeroes
+        len--;  K++;
+    }
+    int x = K + len - 1;                         // decimal exponent of first digit
+    if (negative) *p++ = '-';
+    if (x < -4 || x >= precision) {
+        // exponential notation
+        *p++ = digits[0];
+        if (len > 1) {
+            *p++ = '.';
+            memcpy(p, digits + 1, len - 1);  p += len - 1;
+        }
+        *p++ = 'E';
+        *p++ = x < 0 ? '-' : '+';
+        if (x < 0) x = -x;
+        if (x >= 100) {*p++ = char('0' + x / 100);  x %= 100;}
+        *p++ = decimalPairs[x*2];  *p++ = decimalPairs[x*2+1];
+    }
+    else if (x < 0) {
+        // 0.000ddd
+        *p++ = '0';  *p++ = '.';
+        for (int i = -1; i > x; i--) *p++ = '0';
+        memcpy(p, digits, len);  p += len;
+    }
+    else if (len <= x + 1) {
+        // ddd000
+        memcpy(p, digits, len);  p += len;
+        for (int i = len; i <= x; i++) *p++ = '0';
+    }
+    else {
+        // ddd.ddd
+        memcpy(p, digits, x + 1);  p += x + 1;
+        *p++ = '.';
+        memcpy(p, digits + x + 1, len - x - 1);  p += len - x - 1;
+    }
+    uint32_t n = uint32_t(p - text);
+    push(text, n);
+    column += n;
 }
 
 void CTextFileBuffer::putFloat(float x) {
     // Write floating point number to buffer
-    char text[64];
-    sprintf(text, "%.7G", x);
-    put(text);
+    if (floatFormat == FLOAT_FORMAT_G) {
+        // same as printf. May not give the exact value
+        char text[64];
+        sprintf(text, "%.7G", x);
+        put(text);
+        return;
+    }
+    union {float f; uint32_t i;} u;
+    u.f = x;
+    bool negative = (u.i >> 31) != 0;
+    uint32_t expo = (u.i >> 23) & 0xFF;
+    uint32_t mant = u.i & 0x7FFFFF;
+    if (expo == 0xFF) {                          // INF or NAN
+        if (negative) put('-');
+        put(mant ? "NAN" : "INF");
+        return;
+    }
+    if (expo == 0 && mant == 0) {                // zero
+        put(negative ? "-0" : "0");
+        return;
+    }
+    char digits[32];  int len, K;
+    if (expo) grisu2(mant | 0x800000, int32_t(expo) - 150, mant == 0 && expo > 1, digits, len, K);
+    else grisu2(mant, -149, false, digits, len, K);
+    shortenDigits(digits, len, K, u.i & 0x7FFFFFFF, true);
+    putFloatDigits(digits, len, K, 7, negative);
 }
 
 void CTextFileBuffer::putFloat(double x) {
     // Write floating point number to buffer
-    char text[64];
-    sprintf(text, "%.16G", x);
-    put(text);
+    if (floatFormat == FLOAT_FORMAT_G) {
+        // same as printf. May not give the exact value
+        char text[64];
+        sprintf(text, "%.16G", x);
+        put(text);
+        return;
+    }
+    union {double f; uint64_t i;} u;
+    u.f = x;
+    bool negative = (u.i >> 63) != 0;
+    uint32_t expo = uint32_t(u.i >> 52) & 0x7FF;
+    uint64_t mant = u.i & (((uint64_t)1 << 52) - 1);
+    if (expo == 0x7FF) {                         // INF or NAN
+        if (negative) put('-');
+        put(mant ? "NAN" : "INF");
+        return;
+    }
+    if (expo == 0 && mant == 0) {                // zero
+        put(negative ? "-0" : "0");
+        return;
+    }
+    char digits[32];  int len, K;
+    if (expo) grisu2(mant | ((uint64_t)1 << 52), int32_t(expo) - 1075, mant == 0 && expo > 1, digits, len, K);
+    else grisu2(mant, -1074, false, digits, len, K);
+    shortenDigits(digits, len, K, u.i & ~((uint64_t)1 << 63), false);
+    putFloatDigits(digits, len, K, 16, negative);
 }
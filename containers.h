@@ -77,6 +77,8 @@ or offset relative to the buffer.
 
 #pragma once
 
+const uint64_t FIND_NOT_FOUND = (uint64_t)1 << 63; // Bit set in return value from findFirst if not found
+
 class CMemoryBuffer;                             // Declared below
 class CFileBuffer;                               // Declared below
 
@@ -88,30 +90,41 @@ class CMemoryBuffer {
 public:
    CMemoryBuffer();                              // Constructor
    ~CMemoryBuffer();                             // Destructor
-   void setSize(uint32_t size);                  // Allocate buffer of specified size
+   void setSize(uint64_t size);                  // Allocate buffer of specified size
    void clear();                                 // De-allocate buffer
-   uint32_t dataSize() const {return data_size;};// Get file data size
-   uint32_t bufferSize() const {return buffer_size;};// Get buffer size
-   uint32_t numEntries() const {return num_entries;};// Get number of entries
-   uint32_t push(void const* obj, uint32_t size);// Add object to buffer, return offset
-   uint32_t pushString(char const * s);          // Add ASCIIZ string to buffer, return offset
-   uint32_t getLastIndex() const;                // Index of last object pushed (zero-based)
-   void align(uint32_t a);                       // Align next entry to address divisible by a. must be a power of 2
+   uint64_t dataSize() const {return data_size;};// Get file data size
+   uint64_t bufferSize() const {return buffer_size;};// Get buffer size
+   uint64_t numEntries() const {return num_entries;};// Get number of entries
+   uint64_t push(void const* obj, uint64_t size);// Add object to buffer, return offset
+   uint64_t pushString(char const * s);          // Add ASCIIZ string to buffer, return offset
+   uint64_t getLastIndex() const;                // Index of last object pushed (zero-based)
+   void align(uint64_t a);                       // Align next entry to address divisible by a. must be a power of 2
    int8_t * buf() {return buffer;};              // Access to buffer
    int8_t const * buf() const {return buffer;};  // Access to buffer, const
-   template <class TX> TX & get(uint32_t offset) { // Get object of arbitrary type from buffer
+   template <class TX> TX & get(uint64_t offset) { // Get object of arbitrary type from buffer
       if (offset >= data_size) {
           err.submit(ERR_CONTAINER_INDEX); offset = 0;} // Offset out of range
       return *(TX*)(buffer + offset);}
    void copy(CMemoryBuffer const & b);           // Make a copy of whole buffer
+   bool isMapped() const {return map_size != 0;};// Buffer is a memory mapped file
+   void share(CMemoryBuffer & b);                // Use the buffer of b without taking ownership
+   void share(CMemoryBuffer & b, uint64_t offset, uint64_t size); // Use part of the buffer of b without taking ownership
+   static std::atomic<uint32_t> numAllocations;  // Statistics: number of buffer allocations and reallocations
+   static std::atomic<uint64_t> bytesAllocated;  // Statistics: total size of allocated buffers
+   static std::atomic<uint64_t> bytesZeroed;     // Statistics: number of bytes filled with zeroes
 private:
    CMemoryBuffer(CMemoryBuffer&);                // Make private copy constructor to prevent simple copying
    CMemoryBuffer & operator = (CMemoryBuffer const&);// Make assignment operator to prevent simple copying
    int8_t * buffer;                              // Buffer containing binary data. To be modified only by SetSize and operator >>
-   uint32_t buffer_size;                         // Size of allocated buffer ( > DataSize)
+   uint64_t buffer_size;                         // Size of allocated buffer ( > DataSize)
+   uint64_t map_size;                            // Size of memory mapping if buffer is a mapped file, 0 if allocated with malloc
+   bool shared;                                  // Buffer is owned by another container. Set by share()
+   void releaseBuffer();                         // De-allocate or unmap buffer
+   bool reallocate(uint64_t size);               // Change size of allocated buffer without initializing new space
 protected:
-   uint32_t num_entries;                         // Number of objects pushed
-   uint32_t data_size;                           // Size of data, offset to vacant space
+   void setMappedBuffer(int8_t * p, uint64_t size); // Use memory mapped file as buffer
+   uint64_t num_entries;                         // Number of objects pushed
+   uint64_t data_size;                           // Size of data, offset to vacant space
    friend void operator >> (CMemoryBuffer & a, CMemoryBuffer & b); // Transfer ownership of buffer
    friend void operator >> (CFileBuffer & a, CFileBuffer & b);     // Transfer ownership of buffer
 };
@@ -139,17 +152,22 @@ public:
    char * setFileNameExtension(const char * f);  // Set file name extension according to FileType
 protected:
    void checkOutputFileName();                   // Make output file name or check that requested name is valid
+   bool mapFile(int fd);                         // Map input file into memory
 };
 
 
+// Constants for floating point output format in CTextFileBuffer
+const int FLOAT_FORMAT_SHORTEST =       0;       // Shortest representation that converts back to the same value
+const int FLOAT_FORMAT_G =              1;       // printf %.7G for float and %.16G for double
+
 // Class CTextFileBuffer is used for building text files
 class CTextFileBuffer : public CFileBuffer {
 public:
    CTextFileBuffer();                            // Constructor
-   uint32_t put(const char * text);              // Write text string to buffer
+   uint64_t put(const char * text);              // Write text string to buffer
    void put(const char character);               // Write single character to buffer
-   uint32_t putStringN(const char * s, uint32_t len);// Write string to buffer, add terminating zero
-   uint32_t pushString(char const * s){return put(s);};// Use put instead
+   uint64_t putStringN(const char * s, uint64_t len);// Write string to buffer, add terminating zero
+   uint64_t pushString(char const * s){return put(s);};// Use put instead
    void newLine();                               // Add linefeed
    void tabulate(uint32_t i);                    // Insert spaces until column i
    int  lineType;                                // 0 = DOS/Windows linefeeds, 1 = UNIX linefeeds
@@ -161,8 +179,18 @@ public:
    void putFloat(float x);                       // Write floating point number to buffer
    void putFloat(double x);                      // Write floating point number to buffer
    uint32_t getColumn() {return column;}         // Get column number
+   int  floatFormat;                             // FLOAT_FORMAT_SHORTEST or FLOAT_FORMAT_G
+   void setStream(const char * filename);        // Write text to file in chunks as it is generated
+   void checkStream() {                          // Write chunk to stream if buffer is full
+      if (stream && dataSize() >= streamChunkSize) flushStream();}
+   void write();                                 // Write buffer to file, or finish streaming
 protected:
+   static const uint32_t streamChunkSize = 0x100000; // Size of chunks written when streaming
+   FILE * stream;                                // Output file when streaming, 0 otherwise
+   void flushStream();                           // Write buffered text to stream
    uint32_t column;                              // Current column
+   void putHexDigits(uint64_t x, uint32_t minDigits, int ox); // Write hexadecimal number with at least minDigits digits
+   void putFloatDigits(const char * digits, int len, int K, int precision, bool negative); // Write digits * 10^K
 };
 
 
@@ -172,31 +200,31 @@ protected:
 template <class TX>
 class CDynamicArray : public CMemoryBuffer {
 public:
-    // Allocate space for n of entries. Elements will be zero only if the array was empty before
-    void setNum(uint32_t n) {
-        setSize(n * (uint32_t)sizeof(TX));
-        num_entries = n; data_size = n * (uint32_t)sizeof(TX);}
+    // Allocate space for n of entries. New elements are set to zero
+    void setNum(uint64_t n) {
+        setSize(n * sizeof(TX));
+        num_entries = n; data_size = n * sizeof(TX);}
 
     // Add object to buffer. Return index
-    uint32_t push(TX const& obj) {
-        CMemoryBuffer::push(&obj, (uint32_t)sizeof(TX));
+    uint64_t push(TX const& obj) {
+        CMemoryBuffer::push(&obj, sizeof(TX));
         return num_entries - 1;
     }
 
     // Add multiple objects. Return total number
-    uint32_t pushBig(TX const * obj, uint32_t sizeInBytes) {
+    uint64_t pushBig(TX const * obj, uint64_t sizeInBytes) {
         CMemoryBuffer::push(obj, sizeInBytes);
         num_entries += sizeInBytes / sizeof(TX) - 1;
         return num_entries;
     }
 
     // Read or write existing elements. Cannot be used for adding new elements
-    TX & operator [] (uint32_t i) {
-        uint64_t ii = (uint64_t)i * sizeof(TX);
+    TX & operator [] (uint64_t i) {
+        uint64_t ii = i * sizeof(TX);
         if (ii >= dataSize()) {
             err.submit(ERR_CONTAINER_INDEX); ii = 0;
         }
-        return get<TX>((uint32_t)ii);}
+        return get<TX>(ii);}
 
     // Remove latest added object when buffer is used as stack
     TX pop() {
@@ -213,33 +241,53 @@ public:
     }
 
     // Sort list in ascending order. Operator < must be defined for record type TX
+    // Merge sort. The sort is stable: records that compare equal keep their relative order
     void sort() {
-        // Bubble sort:
-        TX temp, *p1, *p2;
-        int32_t j, n;
-        bool swapped;
-        n = num_entries - 1;
-        do {
-            swapped = false;
-            for (j = 0; j < n; j++) {
-                p1 = (TX*)(buf() + j * sizeof(TX));
-                p2 = (TX*)(buf() + j * sizeof(TX) + sizeof(TX));
-                if (*p2 < *p1) {                           // Swap adjacent records
-                    temp = *p1;  *p1 = *p2;  *p2 = temp;  swapped = true;
+        uint64_t n = num_entries;                          // Number of records
+        uint64_t i, width, lo, mid, hi, a, b, k;           // Indexes
+        const uint64_t runLength = 16;                     // Length of runs sorted by insertion sort
+        TX * list = (TX*)buf();
+        for (i = 0; i < n; i += runLength) {               // Sort short runs
+            insertionSort(list + i, n - i < runLength ? n - i : runLength);
+        }
+        if (n <= runLength) return;
+        TX * temp = (TX*)(new int8_t[n * sizeof(TX)]);     // Temporary buffer for merging
+        if (temp == 0) {err.submit(ERR_MEMORY_ALLOCATION); return;}
+        TX * src = list, * dst = temp, * p;
+        for (width = runLength; width < n; width *= 2) {   // Merge pairs of runs, doubling the run length each time
+            for (lo = 0; lo < n; lo += 2 * width) {
+                mid = lo + width < n ? lo + width : n;
+                hi = mid + width < n ? mid + width : n;
+                a = lo;  b = mid;  k = lo;
+                while (a < mid && b < hi) {
+                    if (src[b] < src[a]) dst[k++] = src[b++];  // Take from first run when equal to keep the sort stable
+                    else dst[k++] = src[a++];
                 }
+                while (a < mid) dst[k++] = src[a++];
+                while (b < hi) dst[k++] = src[b++];
             }
-            n--;
-        } while (swapped);                                 // Early out if already mostly sorted
+            p = src;  src = dst;  dst = p;                 // Swap source and destination
+        }
+        if (src != list) memcpy(list, src, n * sizeof(TX));
+        delete[] (int8_t*)temp;
+    }
+
+    // Sort list in ascending order. Operator < must be defined for record type TX
+    // Introsort. Faster than sort() and needs no extra memory, but the order of records 
+    // that compare equal is unpredictable. Use this only when all keys are unique
+    void sortUnstable() {
+        uint32_t depth = 0;                                // Recursion depth limit before heap sort fallback
+        for (uint64_t n = num_entries; n > 1; n >>= 1) depth += 2;
+        introSort((TX*)buf(), num_entries, depth);
     }
 
-    int32_t findFirst(TX const & x) {            
+    int64_t findFirst(TX const & x) {            
         // Finds matching record and returns index to the first matching record
         // Important: The list must be sorted first
-        // Returns a negative value if not found
-        uint32_t a = 0;                                    // Start of search interval
-        uint32_t b = num_entries;                           // End of search interval + 1
-        uint32_t c = 0;                                    // Middle of search interval                                                     
-        if (num_entries > 0x7FFFFFFF) {err.submit(ERR_CONTAINER_OVERFLOW); return 0x80000000;} // Size overflow
+        // Returns a negative value if not found. The lower 63 bits are then the index where x would be inserted
+        uint64_t a = 0;                                    // Start of search interval
+        uint64_t b = num_entries;                          // End of search interval + 1
+        uint64_t c = 0;                                    // Middle of search interval                                                     
                        
         while (a < b) {                                    // Binary search loop:
             c = (a + b) / 2;
@@ -248,46 +296,46 @@ public:
             else {
                 b = c;}
         }
-        if (a == num_entries || x < (*this)[a]) a |= 0x80000000; // Not found
-        return (int32_t)a;
+        if (a == num_entries || x < (*this)[a]) a |= FIND_NOT_FOUND; // Not found
+        return (int64_t)a;
     }
 
-    int32_t findUnsorted(TX const & x) {            
+    int64_t findUnsorted(TX const & x) {            
         // Finds matching record and returns index to the first matching record
         // Use this if the list is not sorted, or sort the list first and use findFirst
         // Returns a negative value if not found
-        uint32_t a = 0;
+        uint64_t a = 0;
         for (a = 0; a < num_entries; a++) {
             if ((*this)[a] == x) return a;
         }
         return -1;
     } 
 
-    uint32_t findAll(uint32_t * firstIndex, TX const & x) {
+    uint64_t findAll(uint64_t * firstIndex, TX const & x) {
         // Returns the number of records that are equal to x.
         // X is regarded as equal to y if !(x < y) && !(y < x)
         // Important: The list must be sorted first.
         // firstIndex (if not null) gets the index to the first matching record
-        int32_t index = findFirst(x);                      // finds first matching record
+        int64_t index = findFirst(x);                      // finds first matching record
         if (index < 0) return 0;                           // None found
-        if (firstIndex) *firstIndex = (uint32_t)index;     // Save index to first matching record
-        uint32_t n = 1;                                    // Count matching records
-        for (uint32_t i = index+1; i < num_entries; i++) {
+        if (firstIndex) *firstIndex = (uint64_t)index;     // Save index to first matching record
+        uint64_t n = 1;                                    // Count matching records
+        for (uint64_t i = index+1; i < num_entries; i++) {
             if (x < (*this)[i]) break;
             n++;
         }
         return n;
     }
 
-    uint32_t addUnique(TX const& x) {
+    uint64_t addUnique(TX const& x) {
         // Add object x to the list only if an object equal to x is not already in the list
         // Important: The list must be sorted first. The list will remain sorted after the addition of x.
         // The return value is the index of the inserted object or a preexisting object equal to x.
         // The indexes of pre-existing objects above the inserted object are incremented.
-        int32_t index = findFirst(x);                      // Find where to insert x
+        int64_t index = findFirst(x);                      // Find where to insert x
         if (index < 0) {
-            index &= 0x7FFFFFFF;                           // Remove "not found" bit to recover index
-            uint32_t recordsToMove = num_entries - (uint32_t)index; // Number of records to move
+            index &= ~FIND_NOT_FOUND;                      // Remove "not found" bit to recover index
+            uint64_t recordsToMove = num_entries - (uint64_t)index; // Number of records to move
             setNum(num_entries + 1);                        // Make space for one more record                                
             if (recordsToMove > 0) {                       // Move subsequent entries up one place
                 memmove(buf() + index * sizeof(TX) + sizeof(TX),
@@ -297,7 +345,76 @@ public:
             // Insert x at index position
             (*this)[index] = x;
         }
-        return (uint32_t)index;                            // Return index to symbol
+        return (uint64_t)index;                            // Return index to symbol
+    }
+protected:
+    static void insertionSort(TX * list, uint64_t n) {
+        // Stable insertion sort of a short list
+        TX temp;
+        uint64_t i, j;
+        for (i = 1; i < n; i++) {
+            if (!(list[i] < list[i-1])) continue;          // Already in place
+            temp = list[i];
+            j = i;
+            do {
+                list[j] = list[j-1];  j--;
+            } while (j > 0 && temp < list[j-1]);
+            list[j] = temp;
+        }
+    }
+
+    static void siftDown(TX * list, uint64_t i, uint64_t n) {
+        // Restore heap property below position i in a heap of n records
+        TX temp = list[i];
+        uint64_t child;
+        while ((child = 2 * i + 1) < n) {
+            if (child + 1 < n && list[child] < list[child+1]) child++;
+            if (!(temp < list[child])) break;
+            list[i] = list[child];  i = child;
+        }
+        list[i] = temp;
+    }
+
+    static void introSort(TX * list, uint64_t n, uint32_t depth) {
+        // Quicksort with median-of-three pivot. Falls back to heap sort if recursion gets too deep
+        TX temp, pivot;
+        uint64_t i, j;
+        while (n > 16) {
+            if (depth == 0) {                              // Heap sort
+                for (i = n / 2; i > 0; i--) siftDown(list, i - 1, n);
+                for (i = n - 1; i > 0; i--) {
+                    temp = list[0];  list[0] = list[i];  list[i] = temp;
+                    siftDown(list, 0, i);
+                }
+                return;
+            }
+            depth--;
+            // Put median of first, middle and last record first, to use as pivot
+            TX * a = list + 1, * b = list + n / 2, * c = list + n - 1, * m;
+            if (*a < *b) m = (*b < *c) ? b : ((*a < *c) ? c : a);
+            else         m = (*a < *c) ? a : ((*b < *c) ? c : b);
+            temp = list[0];  list[0] = *m;  *m = temp;
+            pivot = list[0];
+            // Hoare partition
+            i = 0;  j = n;
+            for (;;) {
+                do i++; while (i < n && list[i] < pivot);
+                do j--; while (pivot < list[j]);
+                if (i >= j) break;
+                temp = list[i];  list[i] = list[j];  list[j] = temp;
+            }
+            temp = list[0];  list[0] = list[j];  list[j] = temp; // Pivot to its final position
+            // Recurse on the smaller part, loop on the bigger part
+            if (j < n - j - 1) {
+                introSort(list, j, depth);
+                list += j + 1;  n -= j + 1;
+            }
+            else {
+                introSort(list + j + 1, n - j - 1, depth);
+                n = j;
+            }
+        }
+        insertionSort(list, n);
     }
 };
 
@@ -50,8 +50,10 @@ protected:
    void dumpELF();                     // Dump x86 ELF file
    void disassemble();                 // Disassemble ForwardCom ELF file
    void assemble();                    // Assemble ForwardCom assembly file
-   void link(){};                      // Link object files into executable file
-   void lib(){};                       // Build or modify function libraries
+   void link();                        // Link object files into executable file
+   void lib();                         // Build or modify function libraries
+   void emulate();                     // Run executable file in emulator
+   void compileInstructionList();      // Make built-in instruction list from csv file
 };
 
 // Class for interpreting and dumping ELF files
@@ -79,10 +81,10 @@ protected:
    uint32_t secStringTableLen;                   // Length of section header string table
    uint32_t nSections;                           // Number of sections
    int sectionHeaderSize;                        // Size of each section header
-   uint32_t symbolTableOffset;                   // Offset to symbol table
+   uint64_t symbolTableOffset;                   // Offset to symbol table
    uint32_t symbolTableEntrySize;                // Entry size of symbol table
    uint32_t symbolTableEntries;                  // Number of symbols
-   uint32_t symbolStringTableOffset;             // Offset to symbol string table
+   uint64_t symbolStringTableOffset;             // Offset to symbol string table
    uint32_t symbolStringTableSize;               // Size of symbol string table
    Elf64_Ehdr fileHeader;                        // Copy of file header
    CDynamicArray<Elf64_Shdr> sectionHeaders;     // Copy of section headers
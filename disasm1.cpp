@@ -574,6 +574,71 @@ void CDisassembler::sortSymbolsAndRelocations() {
 }
 
 
+void CDisassembler::makePositionTables() {
+    // Make tables of the positions of all symbols and relocations. 
+    // These tables are used for fast search and must be remade whenever symbols or relocations are added
+    uint32_t i;                                            // loop counter
+    symbolPositions.setNum(symbols.numEntries());
+    for (i = 0; i < symbols.numEntries(); i++) {
+        symbolPositions[i] = positionKey(symbols[i].st_shndx, symbols[i].st_value);
+    }
+    relocationPositions.setNum(relocations.numEntries());
+    for (i = 0; i < relocations.numEntries(); i++) {
+        relocationPositions[i] = positionKey(relocations[i].r_section, relocations[i].r_offset);
+    }
+    relocationCursor = 0;
+}
+
+
+void CDisassembler::mergeNewRelocations() {
+    // Insert the relocations that were made during pass 1 into the sorted relocations table.
+    // newRelocations is sorted because pass 1 makes them in address order
+    if (newRelocations.numEntries() == 0) return;
+    CDynamicArray<ElfFWC_Rela2> merged;
+    uint64_t numOld = relocations.numEntries(), numNew = newRelocations.numEntries();
+    uint64_t a = 0, b = 0;                                 // Index into relocations and newRelocations
+    merged.setSize((numOld + numNew) * sizeof(ElfFWC_Rela2));
+    while (a < numOld || b < numNew) {
+        if (b == numNew || (a < numOld && !(newRelocations[b] < relocations[a]))) {
+            merged.push(relocations[a++]);
+        }
+        else {
+            merged.push(newRelocations[b++]);
+        }
+    }
+    merged >> relocations;
+    newRelocations.setNum(0);
+    makePositionTables();
+}
+
+
+uint32_t CDisassembler::findRelocations(uint64_t address, uint64_t * first) {
+    // Find relocations at address in current section. Returns the number of relocations found.
+    // first (if not null) gets the index of the first one. It is unchanged if none are found.
+    // The search starts where the previous search ended. This is fast when addresses are increasing
+    uint64_t const * list = (uint64_t const *)relocationPositions.buf();
+    uint64_t num = relocationPositions.numEntries();
+    uint64_t key = positionKey(section, address);
+    uint64_t a = 0, b = num, c;                            // Search interval
+    uint64_t i = relocationCursor;
+    if (i <= num && (i == 0 || list[i-1] < key)) {
+        // Address is not before the cursor. Try the next few positions before searching
+        for (c = 0; c < 8 && i < num && list[i] < key; c++) i++;
+        a = i;
+        if (i == num || list[i] >= key) b = i;             // Found
+    }
+    while (a < b) {                                        // Binary search
+        c = (a + b) / 2;
+        if (list[c] < key) a = c + 1;
+        else b = c;
+    }
+    relocationCursor = a;
+    for (i = a; i < num && list[i] == key; i++) {}         // Count matching relocations
+    if (i > a && first) *first = a;
+    return uint32_t(i - a);
+}
+
+
 // Join the tables: symbols and newSymbols
 void CDisassembler::joinSymbolTables() {
     /* There are two symbol tables: 'symbols' and 'newSymbols'.
@@ -591,12 +656,18 @@ void CDisassembler::joinSymbolTables() {
     This function joins the two tables together, removes any dublets, updates symbol indexes
     in all relocation records, and tranfers data type information from relocation records
     to symbol records.
+    The references to new symbols are sorted by address and merged into 'symbols' in one pass. 
+    A new symbol is added only if there is no symbol at the same address. The first reference 
+    to an address decides which of the new symbols is used.
     */
     uint32_t r;                                            // Relocation index
     uint32_t s;                                            // Symbol index
+    uint32_t i;                                            // Reference index
     uint32_t newsymi;                                      // Symbol index in newSymbols
-    uint32_t newsymi2;                                     // Index of new symbol after transfer to symbols table
-    uint32_t symTempIndex = symbols.numEntries();       // Temporary index of symbol after transfer
+    uint32_t numOld = symbols.numEntries();                // Number of symbols before adding new symbols
+    uint32_t symTempIndex = numOld;                        // Temporary index of symbol after transfer
+    SSymbolReference ref;                                  // Reference to new symbol
+    CDynamicArray<SSymbolReference> references;            // All references to new symbols
 
     // Remember index of each symbol before adding new symbols and reordering
     for (s = 0; s < symbols.numEntries(); s++) {
@@ -607,50 +678,98 @@ void CDisassembler::joinSymbolTables() {
     for (r = 0; r < relocations.numEntries(); r++) {
         if (relocations[r].r_sym & 0x80000000) {           // Refers to newSymbols table
             newsymi = relocations[r].r_sym & ~0x80000000;
-            if (newsymi < newSymbols.numEntries()) {            
-                // Put symbol into old table if no equivalent symbol exists here
-                newsymi2 = symbols.addUnique(newSymbols[newsymi]);
-                // Give it a temporary index if it doesn't have one
-                if (symbols[newsymi2].st_reguse1 == 0) symbols[newsymi2].st_reguse1 = symTempIndex++;
-                // update reference in relocation record to temporary index
-                relocations[r].r_sym = symbols[newsymi2].st_reguse1;
+            if (newsymi < newSymbols.numEntries()) {
+                ref.st_shndx = newSymbols[newsymi].st_shndx;
+                ref.st_value = newSymbols[newsymi].st_value;
+                ref.order = references.numEntries();
+                ref.newsymi = newsymi;
+                references.push(ref);
             }
         }
         // Do the same with any reference point
         if ((relocations[r].r_type & R_FORW_RELTYPEMASK) == R_FORW_REFP && relocations[r].r_refsym & 0x80000000) {
             newsymi = relocations[r].r_refsym & ~0xC0000000;
-            if (newsymi < newSymbols.numEntries()) {            
-                // Put symbol into old table if no equivalent symbol exists here
-                newsymi2 = symbols.addUnique(newSymbols[newsymi]);
-                // Give it a temporary index if it doesn't have one
-                if (symbols[newsymi2].st_reguse1 == 0) symbols[newsymi2].st_reguse1 = symTempIndex++;
-                // update reference in relocation record to temporary index
-                relocations[r].r_refsym = symbols[newsymi2].st_reguse1 | (relocations[r].r_refsym & 0x40000000);
+            if (newsymi < newSymbols.numEntries()) {
+                ref.st_shndx = newSymbols[newsymi].st_shndx;
+                ref.st_value = newSymbols[newsymi].st_value;
+                ref.order = references.numEntries();
+                ref.newsymi = newsymi;
+                references.push(ref);
             }
         }
     }
-    // Make symbol index translation table
-    CDynamicArray<uint32_t> old2newSymbolIndex;
-    old2newSymbolIndex.setNum(symbols.numEntries());
-    for (s = 0; s < symbols.numEntries(); s++) {
-        uint32_t oldsymi = symbols[s].st_reguse1;
-        if (oldsymi < old2newSymbolIndex.numEntries()) {
-            old2newSymbolIndex[oldsymi] = s;
+    uint32_t numReferences = references.numEntries();
+    references.sort();                                     // Sort by address
+
+    // Merge symbols and new symbols
+    CDynamicArray<ElfFWC_Sym> merged;                      // New symbol table
+    CDynamicArray<uint32_t> old2newSymbolIndex;            // Symbol index translation table
+    CDynamicArray<uint32_t> referenceIndex;                // New symbol index for each reference
+    ElfFWC_Sym position;                                   // Address of current reference
+    uint32_t newIndex;                                     // New symbol index of current reference
+    merged.setSize((numOld + numReferences) * sizeof(ElfFWC_Sym));
+    old2newSymbolIndex.setNum(numOld);
+    referenceIndex.setNum(numReferences);
+    s = 0;
+    for (i = 0; i < numReferences; ) {
+        position.st_shndx = references[i].st_shndx;
+        position.st_value = references[i].st_value;
+        // Copy old symbols below this address
+        while (s < numOld && symbols[s] < position) {
+            old2newSymbolIndex[s] = (uint32_t)merged.push(symbols[s]);
+            s++;
+        }
+        if (s < numOld && symbols[s] == position) {
+            newIndex = merged.numEntries();                // Use existing symbol, which comes next
+        }
+        else {                                             // Put symbol into table
+            newIndex = (uint32_t)merged.push(newSymbols[references[i].newsymi]);
         }
+        // All references to this address
+        do {
+            referenceIndex[references[i].order] = newIndex;
+            i++;
+        } while (i < numReferences && references[i].st_shndx == position.st_shndx && references[i].st_value == position.st_value);
+    }
+    while (s < numOld) {                                   // Copy remaining old symbols
+        old2newSymbolIndex[s] = (uint32_t)merged.push(symbols[s]);
+        s++;
     }
+    merged >> symbols;
+
+    // Give temporary indexes to new symbols in the order they are referenced
+    for (i = 0; i < numReferences; i++) {
+        if (symbols[referenceIndex[i]].st_reguse1 == 0) symbols[referenceIndex[i]].st_reguse1 = symTempIndex++;
+    }
+
     // Update indexes in relocation records
+    i = 0;
     for (r = 0; r < relocations.numEntries(); r++) {
-        if (relocations[r].r_sym < old2newSymbolIndex.numEntries()) { // Refers to newSymbols table
+        if (relocations[r].r_sym & 0x80000000) {           // Refers to newSymbols table
+            if ((relocations[r].r_sym & ~0x80000000) < newSymbols.numEntries()) {
+                relocations[r].r_sym = referenceIndex[i++];
+            }
+        }
+        else if (relocations[r].r_sym < numOld) {
             relocations[r].r_sym = old2newSymbolIndex[relocations[r].r_sym];
+        }
+        if (relocations[r].r_sym < symbols.numEntries()) {
             // Give the symbol a data type from relocation record if it doesn't have one
             if (symbols[relocations[r].r_sym].st_reguse2 == 0) {
                 symbols[relocations[r].r_sym].st_reguse2 = relocations[r].r_type >> 8;
             }
         }
         // Do the same with any reference point
-        uint32_t refsym = relocations[r].r_refsym & ~0xC0000000;
-        if ((relocations[r].r_type & R_FORW_RELTYPEMASK) == R_FORW_REFP && refsym < old2newSymbolIndex.numEntries()) {
-            relocations[r].r_refsym = old2newSymbolIndex[refsym] | (relocations[r].r_refsym & 0x40000000);
+        if ((relocations[r].r_type & R_FORW_RELTYPEMASK) == R_FORW_REFP) {
+            uint32_t refsym = relocations[r].r_refsym & ~0xC0000000;
+            if (relocations[r].r_refsym & 0x80000000) {
+                if (refsym < newSymbols.numEntries()) {
+                    relocations[r].r_refsym = referenceIndex[i++] | (relocations[r].r_refsym & 0x40000000);
+                }
+            }
+            else if (refsym < numOld) {
+                relocations[r].r_refsym = old2newSymbolIndex[refsym] | (relocations[r].r_refsym & 0x40000000);
+            }
         }
     }
 }
@@ -717,6 +836,7 @@ Members that relate to file output are in disasm2.cpp
 CDisassembler::CDisassembler() {
     // Constructor. Initialize variables
     pass = 0;
+    relocationCursor = 0;
     nextSymbol = 0;
     currentFunction = 0;
     currentFunctionEnd = 0;
@@ -724,6 +844,11 @@ CDisassembler::CDisassembler() {
 
 void CDisassembler::initializeInstructionList() {
     // Read and initialize instruction list and sort it by category, format, and op1
+    if (cmd.instructionListFile == 0) {
+        // No instruction list file specified. Use built-in list, which is already sorted
+        instructionlist.pushBig((SInstruction2 const*)builtinInstructionsByFormat, builtinInstructionsNum * (uint32_t)sizeof(SInstruction2));
+        return;
+    }
     CCSVFile instructionListFile(cmd.instructionListFile); // Filename of list of instructions
     instructionListFile.parse();                 // Read and interpret instruction list file
     instructionlist << instructionListFile.instructionlist; // Transfer instruction list to my own container
@@ -767,11 +892,23 @@ void CDisassembler::getComponents2(CELF const & assembler, CMemoryBuffer const &
 // Do the disassembly
 void CDisassembler::go() {
 
-    // Begin writing output file
+    // Positions in a section are 32 bits. See positionKey
+    for (section = 1; section < sectionHeaders.numEntries(); section++) {
+        if (sectionHeaders[section].sh_size > 0xFFFFFFFF) {
+            err.submit(ERR_ELF_SECTION_SIZE, sectionHeaders[section].sh_name < stringBuffer.dataSize() ?
+                (char*)stringBuffer.buf() + sectionHeaders[section].sh_name : "?");
+            return;
+        }
+    }
+
+    // Begin writing output file. The text is written in chunks as it is made
+    outFile.setStream(outputFileName);
+    if (err.number()) return;
     writeFileBegin();
 
     // Sort symbols by address
     sortSymbolsAndRelocations();
+    makePositionTables();
 
     // pass 1: Find symbols types and unnamed symbols
     pass = 1;
@@ -788,6 +925,7 @@ void CDisassembler::go() {
 
     // put names on unnamed symbols
     assignSymbolNames();
+    makePositionTables();
 
     // pass 2: Write all sections to output file
     pass = 0x100;
@@ -799,8 +937,7 @@ void CDisassembler::go() {
     // Finish writing output file
     writeFileEnd();
 
-    // write output file
-    outFile.outputFileName = outputFileName;
+    // write the rest of output file
     outFile.write();
 };
 
@@ -864,6 +1001,8 @@ void CDisassembler::pass1() {
             }
         }
     }
+    // Insert the relocations made by updateSymbols
+    mergeNewRelocations();
 }
 
 
@@ -884,63 +1023,228 @@ void CDisassembler::pass2() {
     as comment.
     */
 
-    //uint32_t sectionType;
+    if (cmd.threads > 1) {
+        // Split code sections into chunks and disassemble them in parallel
+        pass2Threads(cmd.threads);
+        return;
+    }
 
     // Loop through sections, pass 2
     for (section = 1; section < sectionHeaders.numEntries(); section++) {
+        writeSection(0, (uint32_t)sectionHeaders[section].sh_size, 3);
+    }
+}
 
-        // Get section type
-        //sectionType = sectionHeaders[section].sh_type;
-        codeMode = (sectionHeaders[section].sh_flags & SHF_EXEC) ? 1 : 4;
 
-        // Initialize code parser
-        sectionBuffer = dataBuffer.buf() + sectionHeaders[section].sh_offset;
-        sectionEnd = (uint32_t)sectionHeaders[section].sh_size;
+void CDisassembler::writeSection(uint32_t begin, uint32_t end, uint32_t parts) {
+    // Write all or part of current section to output file.
+    // begin, end: address range of a code section. Must be at instruction boundaries.
+    // parts: 1 = write section begin, 2 = write section end. Data sections are always written completely
 
-        writeSectionBegin();                               // Write segment directive
+    //uint32_t sectionType;
 
-        if (codeMode < 4) {
-            // This is a code section
-            if (sectionEnd == 0) continue;
-            iInstr = 0;
+    // Get section type
+    //sectionType = sectionHeaders[section].sh_type;
+    codeMode = (sectionHeaders[section].sh_flags & SHF_EXEC) ? 1 : 4;
 
-            // Loop through instructions
-            while (iInstr < sectionEnd) {
+    // Initialize code parser
+    sectionBuffer = dataBuffer.buf() + sectionHeaders[section].sh_offset;
+    sectionEnd = (uint32_t)sectionHeaders[section].sh_size;
 
-                writeLabels();                             // Find any label here
+    if (parts & 1) writeSectionBegin();                // Write segment directive
 
-                // Check if code not dubious
-                if (codeMode == 1) {
-                    
-                    parseInstruction();                    // Parse instruction
+    if (codeMode < 4) {
+        // This is a code section
+        if (sectionEnd == 0) return;
+        iInstr = begin;
 
-                    writeInstruction();                    // Write instruction
+        // Loop through instructions
+        while (iInstr < end) {
 
-                    iInstr += instrLength * 4;             // Next instruction
+            writeLabels();                                 // Find any label here
+
+            // Check if code not dubious
+            if (codeMode == 1) {
+                
+                parseInstruction();                        // Parse instruction
+
+                writeInstruction();                        // Write instruction
+
+                iInstr += instrLength * 4;                 // Next instruction
+
+            }
+            else {
+                // This is data Skip to next label                                            
+            }
+        }
+        if (parts & 2) writeSectionEnd();              // Write segment directive
+    }
+    else {
+        // This is a data section
+        pInstr = 0; iRecord = 0; fInstr = 0;               // Set invalid pointers to zero
+        operandType = 2;                                   // Default data type is int32
+        instrLength = 4;                                   // Default data size is 4 bytes
+        iInstr = 0;                                        // Instruction position
+        nextSymbol = 0;
+        
+        writeDataItems();                                  // Loop through data. Write data
+
+        writeSectionEnd();                                 // Write segment directive
+    }
+}
+
+
+// List of instructionlengths, used in parseInstruction and pass2Threads
+static const uint8_t lengthList[8] = {1,1,1,1,2,2,3,4};
+
+// Size of code chunks disassembled by each thread
+static const uint32_t disasmChunkSize = 0x4000;
+
+void CDisassembler::pass2Threads(uint32_t numThreads) {
+    // Pass 2 with multiple threads. The output is the same as with a single thread.
+    // Code sections are split into chunks at instruction boundaries, preferably at a symbol.
+    // The state of writeLabels at the start of each chunk is found by scanning the instruction
+    // lengths and symbols. Each chunk is written to a separate text buffer by one of the threads,
+    // and the texts are joined in order afterwards. Data sections are written in advance because 
+    // the state after a data section cannot be found without writing it.
+    // The threads share the symbol and relocation tables. Each chunk sets the 'written' flags
+    // of its own symbols and relocations only.
+    CMetaBuffer<CDisassembler> workers;                    // One disassembler for each thread
+    workers.setSize(numThreads);
+    for (uint32_t t = 0; t < numThreads; t++) workers[t].shareComponents(*this);
+    CDisassembler & w0 = workers[0];                       // Worker used by this thread
+    CDynamicArray<SDisasmChunk> chunks;                    // List of chunks
+    CMemoryBuffer dataText;                                // Text of data sections
+    SDisasmChunk chunk;                                    // Current chunk
+    uint64_t const * positions = (uint64_t const *)symbolPositions.buf(); // Symbol positions, for symbol search
+    uint32_t numPositions = (uint32_t)symbolPositions.numEntries();
+    uint64_t currentPosition;                              // positionKey of current position
+    uint32_t k;                                            // Symbol index
+
+    // A function size of zero units means one unit. Set it here, before the threads start,
+    // because writeLabels would otherwise change it while other threads read the symbol table
+    for (k = 0; k < symbols.numEntries(); k++) {
+        if (symbols[k].st_type == STT_FUNC && symbols[k].st_unitsize && symbols[k].st_unitnum == 0) symbols[k].st_unitnum = 1;
+    }
+
+    // Make list of chunks
+    for (section = 1; section < sectionHeaders.numEntries(); section++) {
+        chunk.section = section;
+        chunk.begin = chunk.end = 0;
+        chunk.parts = 3;
+        chunk.nextSymbol = nextSymbol;
+        chunk.currentFunction = currentFunction;
+        chunk.currentFunctionEnd = currentFunctionEnd;
+        chunk.textOffset = chunk.textSize = 0;
+        sectionEnd = (uint32_t)sectionHeaders[section].sh_size;
 
+        if (!(sectionHeaders[section].sh_flags & SHF_EXEC)) {
+            // Data section. Write it now
+            w0.section = section;
+            w0.nextSymbol = nextSymbol;
+            w0.currentFunction = currentFunction;
+            w0.currentFunctionEnd = currentFunctionEnd;
+            w0.writeSection(0, sectionEnd, 3);
+            nextSymbol = w0.nextSymbol;
+            currentFunction = w0.currentFunction;
+            currentFunctionEnd = w0.currentFunctionEnd;
+            chunk.parts |= 4;
+            chunk.textOffset = dataText.push(w0.outFile.buf(), w0.outFile.dataSize());
+            chunk.textSize = w0.outFile.dataSize();
+            w0.outFile.setSize(0);
+            chunks.push(chunk);
+            continue;
+        }
+        // Code section
+        sectionBuffer = dataBuffer.buf() + sectionHeaders[section].sh_offset;
+        chunk.parts = 1;
+        iInstr = 0;
+        while (iInstr < sectionEnd) {
+            if (iInstr - chunk.begin >= disasmChunkSize) {
+                // Split here if there is a symbol or if the chunk is getting too big
+                bool split = iInstr - chunk.begin >= disasmChunkSize * 4;
+                if (!split) {
+                    // nextSymbol is the first symbol after the previous instruction
+                    currentPosition = positionKey(section, iInstr);
+                    for (k = nextSymbol; k < numPositions && positions[k] < currentPosition; k++) {}
+                    split = k < numPositions && positions[k] == currentPosition;
                 }
-                else {
-                    // This is data Skip to next label                                            
+                if (split) {
+                    chunk.end = iInstr;
+                    chunks.push(chunk);
+                    chunk.begin = iInstr;
+                    chunk.parts = 0;
+                    chunk.nextSymbol = nextSymbol;
+                    chunk.currentFunction = currentFunction;
+                    chunk.currentFunctionEnd = currentFunctionEnd;
                 }
             }
-            writeSectionEnd();                             // Write segment directive
+            skipLabels();
+            iInstr += lengthList[*(uint32_t*)(sectionBuffer + iInstr) >> 29] * 4;
+        }
+        chunk.end = sectionEnd;
+        chunk.parts |= 2;
+        chunks.push(chunk);
+    }
+
+    // Write code chunks in parallel
+    uint32_t numChunks = (uint32_t)chunks.numEntries();
+    if (numChunks == 0) return;
+    CMetaBuffer<CTextFileBuffer> texts;                    // Text of each chunk
+    texts.setSize(numChunks);
+    std::atomic<uint32_t> nextChunk(0);                    // Next chunk to write
+    CMetaBuffer<std::thread> threads;
+    threads.setSize(numThreads - 1);
+    for (uint32_t t = 1; t < numThreads; t++) {
+        threads[t-1] = std::thread(&CDisassembler::writeChunks, &workers[t], &chunks[0], numChunks, &nextChunk, &texts);
+    }
+    w0.writeChunks(&chunks[0], numChunks, &nextChunk, &texts);
+    for (uint32_t t = 1; t < numThreads; t++) threads[t-1].join();
+
+    // Join texts in order
+    for (uint32_t c = 0; c < numChunks; c++) {
+        if (chunks[c].parts & 4) {
+            outFile.push(dataText.buf() + chunks[c].textOffset, chunks[c].textSize);
         }
         else {
-            // This is a data section
-            pInstr = 0; iRecord = 0; fInstr = 0;           // Set invalid pointers to zero
-            operandType = 2;                               // Default data type is int32
-            instrLength = 4;                               // Default data size is 4 bytes
-            iInstr = 0;                                    // Instruction position
-            nextSymbol = 0;
-            
-            writeDataItems();                              // Loop through data. Write data
-
-            writeSectionEnd();                             // Write segment directive
+            outFile.push(texts[c].buf(), texts[c].dataSize());
+            texts[c].clear();
         }
+        outFile.checkStream();
     }
 }
 
 
+void CDisassembler::writeChunks(SDisasmChunk const * chunks, uint32_t num, std::atomic<uint32_t> * nextChunk, CMetaBuffer<CTextFileBuffer> * texts) {
+    // Thread function for pass2Threads. Write chunks of code until there are no more
+    uint32_t c;                                            // Chunk index
+    while ((c = (*nextChunk)++) < num) {
+        if (chunks[c].parts & 4) continue;                 // Data section already written
+        section = chunks[c].section;
+        nextSymbol = chunks[c].nextSymbol;
+        currentFunction = chunks[c].currentFunction;
+        currentFunctionEnd = chunks[c].currentFunctionEnd;
+        writeSection(chunks[c].begin, chunks[c].end, chunks[c].parts);
+        outFile >> (*texts)[c];                            // Transfer text to list
+    }
+}
+
+
+void CDisassembler::shareComponents(CDisassembler & master) {
+    // Use tables of master disassembler. The symbol and relocation tables are not copied 
+    // because writeLabels and writeRelocationTarget mark the entries that have been written
+    sectionHeaders.share(master.sectionHeaders);
+    symbols.share(master.symbols);
+    relocations.share(master.relocations);
+    stringBuffer.share(master.stringBuffer);
+    dataBuffer.share(master.dataBuffer);
+    instructionlist.share(master.instructionlist);
+    symbolPositions.share(master.symbolPositions);
+    relocationPositions.share(master.relocationPositions);
+    pass = master.pass;
+}
+
+
 
 /********************  Explanation of tracer:  ***************************
 
@@ -968,7 +1272,7 @@ void CDisassembler::updateSymbols() {
             rel.r_offset = relSource;
             rel.r_section = section;
             rel.r_addend = 0;
-            if (relocations.findFirst(rel) < 0) {
+            if (findRelocations(relSource, 0) == 0) {
                 // There is no relocation. Target must be in the same section. Find target
                 int32_t offset = 0;
                 switch (fInstr->addrSize) {                // Read offset of correct size
@@ -994,7 +1298,7 @@ void CDisassembler::updateSymbols() {
 
                 // Add a symbol at target address if none exists
                 ElfFWC_Sym sym = {0, 0, STB_LOCAL, STV_EXEC, section, uint32_t(target), 0, 0, 0 };
-                int32_t symi = symbols.findFirst(sym);
+                int64_t symi = symbols.findFirst(sym);
                 if (symi < 0) {
                     symi = newSymbols.push(sym);           // Add symbol to new symbols table
                     symi |= 0x80000000;                    // Upper bit means index refers to newSymbols
@@ -1003,7 +1307,7 @@ void CDisassembler::updateSymbols() {
                 // This relocation does not need type, scale, or addend because the only purpose is to identify the symbol.
                 // It does have a size, though, because this is checked later in writeRelocationTarget()
                 rel.r_sym = (uint32_t)symi;
-                relocations.addUnique(rel);
+                newRelocations.push(rel);
             }
         }
     }
@@ -1021,8 +1325,8 @@ void CDisassembler::updateSymbols() {
             rel.r_offset = relpos;
             rel.r_section = section;
             rel.r_type = (operandType | 0x80) << 24;
-            uint32_t nrel, irel = 0;
-            nrel = relocations.findAll(&irel, rel);
+            uint64_t nrel, irel = 0;
+            nrel = findRelocations(relpos, &irel);
             if (nrel > 1) writeWarning("Overlapping relocations here");
             if (nrel) {
                 // Relocation found. Put the data type into the relocation record. 
@@ -1063,7 +1367,7 @@ void CDisassembler::updateSymbols() {
                     break;
                 }
                 ElfFWC_Sym sym = {0, 0, STB_LOCAL, STV_EXEC, section, (uint32_t)target, 0, 0, 0 };
-                int32_t symi = symbols.findFirst(sym);
+                int64_t symi = symbols.findFirst(sym);
                 if (symi < 0) {
                     symi = newSymbols.push(sym);           // Add symbol to new symbols table
                     symi |= 0x80000000;                    // Upper bit means index refers to newSymbols
@@ -1075,7 +1379,7 @@ void CDisassembler::updateSymbols() {
                 rel.r_section = section;
                 rel.r_addend = -4;
                 rel.r_sym = (uint32_t)symi;
-                relocations.addUnique(rel);
+                newRelocations.push(rel);
             }
         }
     }
@@ -1093,10 +1397,6 @@ void CDisassembler::markCodeAsDubious() {
 }
 
 
-// List of instructionlengths, used in parseInstruction
-static const uint8_t lengthList[8] = {1,1,1,1,2,2,3,4};
-
-
 void CDisassembler::parseInstruction() {
     // Parse one opcode at position iInstr
     instructionWarning = 0;
@@ -1133,14 +1433,13 @@ void CDisassembler::parseInstruction() {
     }
     else {
         // Look up format details
-        static SFormat form;
         fInstr = &formatList[lookupFormat(pInstr->q)];
         format = fInstr->format2;                          // Include subformat depending on op1
         if (fInstr->tmpl == 0xE && pInstr->a.op2) {
             // Single format instruction if op2 != 0
-            form = *fInstr;
-            form.cat = 1;
-            fInstr = &form;
+            formCopy = *fInstr;
+            formCopy.cat = 1;
+            fInstr = &formCopy;
         }
     }
 
@@ -1307,6 +1606,86 @@ void CCSVFile::parse() {
     }
 }
 
+// Write one table of instruction records as C++ source code
+static void writeInstructionTable(CTextFileBuffer & out, const char * tableName, SInstruction const * list, uint32_t num) {
+    uint32_t i;                                  // record index
+    const char * s;                              // string to write
+    out.put("const SInstruction ");  out.put(tableName);  out.put("[] = {");  out.newLine();
+    out.put("//  id, category, format, templt, sourceoperands, op1, op2, optypesgp, optypesscalar, optypesvector, opimmediate, template_variant, name");
+    out.newLine();
+    for (i = 0; i < num; i++) {
+        out.put("    {");
+        out.putHex(list[i].id);               out.put(", ");
+        out.putDecimal(list[i].category);     out.put(", ");
+        out.putHex(list[i].format);           out.put(", ");
+        out.putHex(list[i].templt);           out.put(", ");
+        out.putDecimal(list[i].sourceoperands); out.put(", ");
+        out.putHex(list[i].op1);              out.put(", ");
+        out.putDecimal(list[i].op2);          out.put(", ");
+        out.putHex(list[i].optypesgp);        out.put(", ");
+        out.putHex(list[i].optypesscalar);    out.put(", ");
+        out.putHex(list[i].optypesvector);    out.put(", ");
+        out.putHex(list[i].opimmediate);      out.put(", \"");
+        for (s = list[i].template_variant; *s; s++) {
+            if (*s == '"' || *s == '\\') out.put('\\');
+            out.put(*s);
+        }
+        out.put("\", \"");
+        for (s = list[i].name; *s; s++) {
+            if (*s == '"' || *s == '\\') out.put('\\');
+            out.put(*s);
+        }
+        out.put("\"}");
+        if (i + 1 < num) out.put(",");
+        out.newLine();
+    }
+    out.put("};");  out.newLine();  out.newLine();
+}
+
+// Write instruction list as C++ source code for the built-in instruction list.
+// The records are sorted in the three different orders used by the assembler and disassembler,
+// exactly as initializeWordLists() and initializeInstructionList() would sort them
+void CCSVFile::writeTables(char const * filename) {
+    CDynamicArray<SInstruction> listByName;      // sorted by name
+    CDynamicArray<SInstruction3> listById;       // sorted by id
+    CDynamicArray<SInstruction2> listByFormat;   // sorted by category, format, and operation codes
+    listByName.copy(instructionlist);
+    listById.copy(instructionlist);
+    listByFormat.copy(instructionlist);
+    SInstruction3 nullInstruction;               // empty record goes to position 0 in listById
+    memset(&nullInstruction, 0, sizeof(nullInstruction));
+    listById.push(nullInstruction);
+    listByName.sort();
+    listById.sort();
+    listByFormat.sort();
+
+    CTextFileBuffer out;
+    out.lineType = 0;                            // DOS/Windows linefeeds like the other source files
+    out.put("/****************************  instruction_table.cpp  ************************");  out.newLine();
+    out.put("* Project:       Binary tools for ForwardCom instruction set");  out.newLine();
+    out.put("* Module:        instruction_table.cpp");  out.newLine();
+    out.put("* Description:");  out.newLine();
+    out.put("* Built-in instruction list, generated from instruction_list.csv by the command");  out.newLine();
+    out.put("*   forw -ilist-compile instruction_list.csv instruction_table.cpp");  out.newLine();
+    out.put("* Do not edit this file. Run 'make ilist' to remake it after changing instruction_list.csv");  out.newLine();
+    out.put("*");  out.newLine();
+    out.put("* Copyright 2017 GNU General Public License http://www.gnu.org/licenses");  out.newLine();
+    out.put("*****************************************************************************/");  out.newLine();
+    out.put("#include \"stdafx.h\"");  out.newLine();  out.newLine();
+    out.put("// Number of instruction records");  out.newLine();
+    out.put("const uint32_t builtinInstructionsNum = ");  out.putDecimal(instructionlist.numEntries());
+    out.put(";");  out.newLine();  out.newLine();
+    out.put("// Instruction records sorted by name. Used by assembler");  out.newLine();
+    writeInstructionTable(out, "builtinInstructionsByName", &listByName[0], listByName.numEntries());
+    out.put("// Instruction records sorted by id, with an empty record at position 0. Used by assembler");  out.newLine();
+    writeInstructionTable(out, "builtinInstructionsById", &listById[0], listById.numEntries());
+    out.put("// Instruction records sorted by category, format, and operation codes. Used by disassembler");  out.newLine();
+    writeInstructionTable(out, "builtinInstructionsByFormat", &listByFormat[0], listByFormat.numEntries());
+
+    out.outputFileName = filename;
+    out.write();
+}
+
 // Interpret number in instruction list
 uint64_t CCSVFile::interpretNumber(const char * text) {
     uint32_t error = 0;
@@ -53,14 +53,14 @@ void CDisassembler::writeLabels() {
     }
     bool isFunction = false;
 
-    // Make dummy symbol to search for
-    ElfFWC_Sym currentPosition;
-    currentPosition.st_shndx = section;
-    currentPosition.st_value = iInstr;
+    // Position to search for
+    uint64_t currentPosition = positionKey(section, iInstr);
+    uint64_t const * positions = (uint64_t const *)symbolPositions.buf();
+    uint32_t numPositions = (uint32_t)symbolPositions.numEntries();
 
     // Search for any symbol here. Look for any misplaced symbols we might have skipped before last output
     uint32_t numSymbols = 0; // Check if multiple symbols at same place
-    while (nextSymbol < symbols.numEntries() && symbols[nextSymbol] < currentPosition) {
+    while (nextSymbol < numPositions && positions[nextSymbol] < currentPosition) {
         if (symbols[nextSymbol].st_shndx == section) {
             outFile.put(commentSeparator);
             outFile.put(" Warning: Misplaced symbol: ");
@@ -73,7 +73,7 @@ void CDisassembler::writeLabels() {
         nextSymbol++;
     }
     // Write all symbols at current position
-    while (nextSymbol < symbols.numEntries() && symbols[nextSymbol] == currentPosition) {
+    while (nextSymbol < numPositions && positions[nextSymbol] == currentPosition) {
         if (numSymbols++) {
             outFile.put(':'); outFile.newLine();           // Multiple symbols at same position, put on separate lines
         }
@@ -107,11 +107,42 @@ void CDisassembler::writeLabels() {
     }
 }
 
+void CDisassembler::skipLabels() {
+    // Update nextSymbol, currentFunction, and currentFunctionEnd in the same way as writeLabels, 
+    // without writing anything and without marking symbols. Used by pass2Threads
+    if (iInstr == currentFunctionEnd && currentFunction) {
+        currentFunction = 0; currentFunctionEnd = 0;       // Current function is ending here
+    }
+    uint64_t currentPosition = positionKey(section, iInstr);
+    uint64_t const * positions = (uint64_t const *)symbolPositions.buf();
+    uint32_t numPositions = (uint32_t)symbolPositions.numEntries();
+    while (nextSymbol < numPositions && positions[nextSymbol] < currentPosition) {
+        nextSymbol++;                                      // Misplaced symbol
+    }
+    while (nextSymbol < numPositions && positions[nextSymbol] == currentPosition) {
+        if (symbols[nextSymbol].st_type == STT_FUNC && symbols[nextSymbol].st_bind != STB_LOCAL) {
+            // This is a function
+            currentFunction = nextSymbol;
+            if (symbols[nextSymbol].st_unitsize) {         // Calculate end of current function
+                uint32_t unitnum = symbols[nextSymbol].st_unitnum;
+                if (unitnum == 0) unitnum = 1;
+                currentFunctionEnd = iInstr + symbols[nextSymbol].st_unitsize * unitnum;
+            }
+            else currentFunctionEnd = 0;                   // Function size is not known
+        }
+        nextSymbol++;
+    }
+}
+
 
 static const int dataSizeTableMax8[8] = {1, 2, 4, 8, 8, 4, 8, 8}; // Data size for each operant type, max = 8
 
 void CDisassembler::writeDataItems() {
     // Write contents of data section to output file
+    if (sectionHeaders[section].sh_type == SHT_NOBITS) {
+        writeUninitializedItems();                         // There is no data for an uninitialized section
+        return;
+    }
     uint32_t nextLabel = 0;
     uint32_t nextRelocation = 0;
     uint32_t dataSize = 4;
@@ -146,11 +177,8 @@ void CDisassembler::writeDataItems() {
         else nextLabel = sectionEnd;
         
         // Search for relocations
-        ElfFWC_Rela2 rel;
-        rel.r_offset = iInstr;
-        rel.r_section = section;
-        uint32_t irel;  // index to relocation record
-        uint32_t numRel = relocations.findAll(&irel, rel);
+        uint64_t irel;  // index to relocation record
+        uint32_t numRel = findRelocations(iInstr, &irel);
         if (numRel) {
             // Relocation found. Find size
             // Relocation size overrides any symbol size
@@ -337,16 +365,94 @@ void CDisassembler::writeDataItems() {
     }
 }
 
+void CDisassembler::writeUninitializedItems() {
+    // Write declarations for uninitialized (BSS) section. The section has a size, but no data in dataBuffer.
+    // Each symbol is written as the name of an array that extends to the next symbol. 
+    // Space without a symbol gets a name made from the section name and offset
+    uint64_t const * positions = (uint64_t const *)symbolPositions.buf();
+    uint32_t numPositions = (uint32_t)symbolPositions.numEntries();
+    uint32_t dataSize = 4;
+    uint32_t symi;                                         // Symbol written as array name
+    uint32_t sequenceEnd;
+
+    // Loop through section
+    while (iInstr < sectionEnd) {
+        uint64_t currentPosition = positionKey(section, iInstr);
+        // Look for any misplaced symbols, as in writeLabels
+        while (nextSymbol < numPositions && positions[nextSymbol] < currentPosition) {
+            if (symbols[nextSymbol].st_shndx == section) {
+                outFile.put(commentSeparator);
+                outFile.put(" Warning: Misplaced symbol: ");
+                writeSymbolName(nextSymbol);
+                outFile.put(" at offset ");
+                outFile.putHex(symbols[nextSymbol].st_value);
+                outFile.newLine();
+                symbols[nextSymbol].st_other |= 0x80000000;    // Remember symbol has been written
+            }
+            nextSymbol++;
+        }
+        // Multiple symbols at same position. Write all but the last one as labels on separate lines
+        while (nextSymbol + 1 < numPositions && positions[nextSymbol + 1] == currentPosition) {
+            writeSymbolName(nextSymbol);
+            outFile.put(':'); outFile.newLine();
+            symbols[nextSymbol].st_other |= 0x80000000;
+            nextSymbol++;
+        }
+        symi = 0;
+        if (nextSymbol < numPositions && positions[nextSymbol] == currentPosition) {
+            symi = nextSymbol++;
+            symbols[symi].st_other |= 0x80000000;
+            // Get data size from symbol
+            dataSize = symbols[symi].st_unitsize;
+            if (dataSize > 8) dataSize = 8;
+            if (dataSize == 0) dataSize = 4;
+        }
+        // Sequence ends at next symbol in this section
+        sequenceEnd = sectionEnd;
+        if (nextSymbol < numPositions && symbols[nextSymbol].st_shndx == section
+        && symbols[nextSymbol].st_value > iInstr && symbols[nextSymbol].st_value < sequenceEnd) {
+            sequenceEnd = (uint32_t)symbols[nextSymbol].st_value;
+        }
+        uint32_t num = (sequenceEnd - iInstr) / dataSize;
+        if (num == 0) {
+            dataSize = sequenceEnd - iInstr;               // Reduce data size to avoid going past sequenceEnd
+            while (dataSize & (dataSize-1)) dataSize--;    // Round down to nearest power of 2
+            num = 1;
+        }
+        // Write type and name
+        outFile.tabulate(asmTab1);
+        switch (dataSize) {
+        case 1: outFile.put("int8 "); break;
+        case 2: outFile.put("int16 "); break;
+        case 4: outFile.put("int32 "); break;
+        case 8: outFile.put("int64 "); break;
+        }
+        outFile.tabulate(asmTab2);
+        if (symi) writeSymbolName(symi);
+        else {
+            writeSectionName(section);
+            outFile.put('_');
+            outFile.putHex(iInstr, 2);
+        }
+        if (num > 1) {
+            outFile.put('['); outFile.putDecimal(num); outFile.put(']');
+        }
+        // Write comment with address
+        outFile.put(' '); outFile.tabulate(asmTab3);
+        outFile.put(commentSeparator); outFile.put(' ');
+        if (sectionEnd > 0xFFFF) outFile.putHex(iInstr, 2);
+        else outFile.putHex((uint16_t)iInstr, 2);
+        iInstr += num * dataSize;
+        if (iInstr < sectionEnd) outFile.newLine();
+    }
+}
+
 static const uint32_t relocationSizes[16] = {0, 1, 2, 3, 4, 4, 4, 8, 8, 8, 0, 0, 0, 0, 0, 0};
 
 void CDisassembler::writeRelocationTarget(uint32_t src, uint32_t size) {
     // Write relocation target for this source position
     // Find relocation
-    ElfFWC_Rela2 rel;
-    rel.r_offset = src;
-    rel.r_section = section;
-    //uint32_t irel;  // index to relocation record
-    uint32_t n = relocations.findAll(&relocation, rel);
+    uint32_t n = findRelocations(src, &relocation);
     if (n == 0) return;
     if (n > 1) {
         writeWarning(n ? "Overlapping relocations" : "No relocation found here");
@@ -644,7 +750,8 @@ void CDisassembler::writeInstruction() {
     if (instrLength > 1 && fInstr->tmpl == 0xE) iRecSearch.op2 = pInstr->a.op2;
     else iRecSearch.op2 = 0;
 
-    uint32_t index, n, i;
+    uint64_t index;
+    uint32_t n, i;
     n = instructionlist.findAll(&index, iRecSearch);
     if (n == 0) {    // Instruction not found in list
         writeWarning("Unknown instruction: ");
@@ -920,7 +1027,8 @@ void CDisassembler::writeJumpInstruction(){
 void CDisassembler::writeTinyInstruction() {
     // Write a pair of tiny instructions
     // Extract the two tiny instructions
-    uint32_t index, n, j;
+    uint64_t index;
+    uint32_t n, j;
     STinyTemplate ti[2];
     ti[0].i = pInstr->t.tiny1;
     ti[1].i = pInstr->t.tiny2;
@@ -1219,10 +1327,7 @@ void CDisassembler::writeMemoryOperand() {
     // Check if there is a relocation here
     relocation = 0;  // index to relocation record
     if (fInstr->addrSize) {
-        ElfFWC_Rela2 rel;
-        rel.r_offset = iInstr + fInstr->addrPos;
-        rel.r_section = section;
-        uint32_t nrel = relocations.findAll(&relocation, rel);
+        uint32_t nrel = findRelocations(iInstr + fInstr->addrPos, &relocation);
         if (nrel) relocation++;  // add 1 to avoid zero
     }
     // Enclose in square bracket
@@ -1320,11 +1425,8 @@ void CDisassembler::writeMemoryOperand() {
 void CDisassembler::writeImmediateOperand() {
     // Write immediate operand depending on type in instruction list
     // Check if there is a relocation here
-    ElfFWC_Rela2 rel;
-    rel.r_offset = (uint64_t)iInstr + fInstr->immPos;
-    rel.r_section = section;
-    uint32_t irel;  // index to relocation record
-    uint32_t numRel = relocations.findAll(&irel, rel);
+    uint64_t irel;  // index to relocation record
+    uint32_t numRel = findRelocations((uint64_t)iInstr + fInstr->immPos, &irel);
     if (numRel) {  // Immediate value is relocated
         writeRelocationTarget(iInstr + fInstr->immPos, fInstr->immSize);
         return;
@@ -142,6 +142,28 @@ static inline bool operator < (ElfFWC_Rela2 const & a, ElfFWC_Rela2 const & b) {
     return a.r_offset < b.r_offset;
 }
 
+// Reference from a relocation record to a new symbol. Used by joinSymbolTables
+struct SSymbolReference {
+    uint32_t st_shndx;                           // Section index of symbol
+    uint64_t st_value;                           // Address of symbol
+    uint32_t order;                              // Order of reference in relocation table
+    uint32_t newsymi;                            // Index into newSymbols
+};
+
+// Operator for sorting symbol references by address and order
+static inline bool operator < (SSymbolReference const & a, SSymbolReference const & b) {
+    if (a.st_shndx != b.st_shndx) return a.st_shndx < b.st_shndx;
+    if (a.st_value != b.st_value) return a.st_value < b.st_value;
+    return a.order < b.order;
+}
+
+// Key for fast search of symbols and relocations by section and address. Gives the same order as
+// the operators above. Addresses above 4 GB are truncated. They are outside the section because
+// CDisassembler::go rejects sections of 4 GB or more
+static inline uint64_t positionKey(uint32_t section, uint64_t address) {
+    return (uint64_t)section << 32 | (address < 0xFFFFFFFF ? address : 0xFFFFFFFF);
+}
+
 // Look up format in FormatList
 uint32_t lookupFormat(uint64_t instruct);
 
@@ -176,6 +198,19 @@ const uint64_t VARIANT_SPECD = 0x2000000000; // Special register type for destin
 
 struct SInstruction2;  // defined below
 
+// Part of a section to disassemble in a separate thread
+struct SDisasmChunk {
+    uint32_t section;                            // Section index
+    uint32_t begin;                              // Start address relative to section
+    uint32_t end;                                // End address relative to section
+    uint32_t parts;                              // 1: write section begin, 2: write section end, 4: data section already written
+    uint32_t nextSymbol;                         // State of writeLabels at begin
+    uint32_t currentFunction;                    // Current function at begin
+    uint32_t currentFunctionEnd;                 // End of current function
+    uint64_t textOffset;                         // Offset of text of data section written in advance
+    uint64_t textSize;                           // Size of same text
+};
+
 // class CDisassembler handles disassembly of ForwardCom ELF file
 class CDisassembler : public CELF {
 public:
@@ -196,13 +231,18 @@ protected:
     uint32_t currentFunction;                    // Symbol index of current function
     uint32_t currentFunctionEnd;                 // Address of end of current function
     uint32_t instructionWarning;                 // Warnings and errors for current instruction
-    uint32_t relocation;                         // relocation index in current instruction + 1
+    uint64_t relocation;                         // relocation index in current instruction + 1
     int8_t * sectionBuffer;                      // Pointer to start of current section
     uint64_t variant;                            // Template variant and options
     STemplate const * pInstr;                    // Pointer to current instruction code
     SInstruction2 const * iRecord;               // Pointer to instruction table entry
     SFormat const * fInstr;                      // Format details of current instruction code
+    SFormat formCopy;                            // Modified copy of format details, used by parseInstruction
     CDynamicArray<ElfFWC_Sym> newSymbols;        // List of new symbols added during pass 1
+    CDynamicArray<ElfFWC_Rela2> newRelocations;  // List of new relocations added during pass 1, in address order
+    CDynamicArray<uint64_t> symbolPositions;     // positionKey of each symbol, for fast search
+    CDynamicArray<uint64_t> relocationPositions; // positionKey of each relocation, for fast search
+    uint64_t relocationCursor;                   // Index of last relocation found by findRelocations
     CTextFileBuffer outFile;                     // Output file
     CDynamicArray<SInstruction2> instructionlist;// List of instruction set, sorted by category, format, and op1
     void parseInstruction();                     // Parse current instruction
@@ -220,7 +260,14 @@ protected:
     void writeSpecialRegister(uint32_t r, uint32_t type); // Write name of other type of register
     void pass1();                                // Pass 1 of disassembly. Resolves cross references and adds symbol labels
     void pass2();                                // Pass 2 of disassembly. Writes output file
+    void pass2Threads(uint32_t numThreads);      // Pass 2 with multiple threads
+    void writeSection(uint32_t begin, uint32_t end, uint32_t parts); // Write all or part of current section
+    void writeChunks(SDisasmChunk const * chunks, uint32_t num, std::atomic<uint32_t> * nextChunk, CMetaBuffer<CTextFileBuffer> * texts); // Thread function for pass2Threads
+    void shareComponents(CDisassembler & master);// Use tables of master disassembler
     void sortSymbolsAndRelocations();            // Sort symbols and relocations by address
+    void makePositionTables();                   // Make symbolPositions and relocationPositions
+    void mergeNewRelocations();                  // Insert newRelocations into relocations
+    uint32_t findRelocations(uint64_t address, uint64_t * first); // Find relocations at address in current section
     void updateSymbols();                        // Make missing symbols for jump targets and data references
     void joinSymbolTables();                     // Join the tables: symbols and newSymbols
     void assignSymbolNames();                    // Make names for unnamed symbols
@@ -234,7 +281,9 @@ protected:
     void writeSectionEnd();                      // Write end of section
     void writeCodeComment();                     // Write comment after instruction
     void writeDataItems();                       // Write data to disassembly file
+    void writeUninitializedItems();              // Write declarations for uninitialized data section
     void writeLabels();                          // Find and write any labels at current position
+    void skipLabels();                           // Same as writeLabels without writing anything
     void writeRelocationTarget(uint32_t src, uint32_t size); // Write relocation target for this source position
     void writeWarning(const char * w);           // Write warning message to output file
     void writeError(const char * w);             // Write error message to output file
@@ -312,10 +361,17 @@ class CCSVFile : public CFileBuffer {
 public:
     CCSVFile(char const * filename) : CFileBuffer(filename) {}  // Constructor
     void parse();                                          // Read and parse file
+    void writeTables(char const * filename);               // Write sorted instruction lists as C++ source code
     CDynamicArray<SInstruction> instructionlist;           // List of records
     uint64_t interpretNumber(const char * text); // Interpret number in instruction list
 };
 
+// Built-in instruction list in instruction_table.cpp, made from instruction_list.csv by writeTables
+extern const uint32_t builtinInstructionsNum;            // Number of instruction records
+extern const SInstruction builtinInstructionsByName[];   // Sorted by name
+extern const SInstruction builtinInstructionsById[];     // Sorted by id. Has builtinInstructionsNum+1 records including an empty record at position 0
+extern const SInstruction builtinInstructionsByFormat[]; // Sorted by category, format, and operation codes
+
 // Interpret a string with a decimal, binary, octal, or hexadecimal number
 int64_t interpretNumber(const char * s, uint32_t maxLength, uint32_t * error);
 
@@ -307,7 +307,7 @@ void CELF::parseFile() {
 
     if (buf() && dataSize()) {  // string table
         uint64_t offset = sectionHeaders[fileHeader.e_shstrndx].sh_offset;
-        secStringTable = (char*)buf() + uint32_t(offset);
+        secStringTable = (char*)buf() + offset;
         secStringTableLen = uint32_t(sectionHeaders[fileHeader.e_shstrndx].sh_size);
         if (offset > dataSize() || offset + secStringTableLen > dataSize()) err.submit(ERR_ELF_INDEX_RANGE);
     }
@@ -319,11 +319,11 @@ void CELF::parseFile() {
     if (symtabi) {
         // Save offset to symbol table
         uint64_t offset = sectionHeaders[symtabi].sh_offset;
-        symbolTableOffset = (uint32_t)offset;
+        symbolTableOffset = offset;
         symbolTableEntrySize = (uint32_t)(sectionHeaders[symtabi].sh_entsize); // Entry size of symbol table
         if (symbolTableEntrySize == 0) { err.submit(ERR_ELF_SYMTAB_MISSING); return; } // Avoid division by zero
         symbolTableEntries = uint32_t(sectionHeaders[symtabi].sh_size) / symbolTableEntrySize;
-        if (offset > dataSize() || offset > 0xFFFFFFFFU || offset + sectionHeaders[symtabi].sh_entsize > dataSize()
+        if (offset > dataSize() || offset + sectionHeaders[symtabi].sh_entsize > dataSize()
             || offset + sectionHeaders[symtabi].sh_size > dataSize()) err.submit(ERR_ELF_INDEX_RANGE);
 
         // Find associated string table
@@ -333,9 +333,9 @@ void CELF::parseFile() {
             return;
         }
         offset = sectionHeaders[stringtabi].sh_offset;
-        symbolStringTableOffset = (uint32_t)offset;
+        symbolStringTableOffset = offset;
         symbolStringTableSize = (uint32_t)(sectionHeaders[stringtabi].sh_size);
-        if (offset > dataSize() || offset > 0xFFFFFFFFU || offset + sectionHeaders[stringtabi].sh_size > dataSize()) err.submit(ERR_ELF_INDEX_RANGE);
+        if (offset > dataSize() || offset + sectionHeaders[stringtabi].sh_size > dataSize()) err.submit(ERR_ELF_INDEX_RANGE);
         // check all symbol names
         int8_t * symtab = buf() + symbolTableOffset;
         uint32_t symname = 0;
@@ -360,7 +360,7 @@ void CELF::dump(int options) {
         // File header
         printf("\nDump of ELF file %s", fileName);
         printf("\n-----------------------------------------------");
-        printf("\nFile size: %i", dataSize());
+        printf("\nFile size: %llu", (unsigned long long)dataSize());
         printf("\nFile header:");
         printf("\nFile class: %s, Data encoding: %s, ELF version %i, ABI: %s, ABI version %i",
             Lookup(ELFFileClassNames, fileHeader.e_ident[EI_CLASS]),
@@ -455,7 +455,7 @@ void CELF::dump(int options) {
             if (sheader.sh_type == SHT_STRTAB && (options & DUMP_STRINGTB)) {
                 // Print string table
                 printf("\n  String table:");
-                char * p = (char*)buf() + uint32_t(sheader.sh_offset) + 1;
+                char * p = (char*)buf() + sheader.sh_offset + 1;
                 uint32_t nread = 1, len;
                 while (nread < uint32_t(sheader.sh_size)) {
                     len = (uint32_t)strlen(p);
@@ -476,8 +476,8 @@ void CELF::dump(int options) {
                 int8_t * strtab = buf() + strtabOffset;
 
                 // Find symbol table
-                uint32_t symtabsize = (uint32_t)(sheader.sh_size);
-                int8_t * symtab = buf() + uint32_t(sheader.sh_offset);
+                uint64_t symtabsize = sheader.sh_size;
+                int8_t * symtab = buf() + sheader.sh_offset;
                 int8_t * symtabend = symtab + symtabsize;
                 if (entrysize < sizeof(Elf64_Sym)) { err.submit(ERR_ELF_RECORD_SIZE); entrysize = sizeof(Elf64_Sym); }
 
@@ -526,9 +526,9 @@ void CELF::dump(int options) {
                     else { // Special segment values
                         switch (sym.st_shndx) {
                         case 0: 
-                        case SHN_ABS_X86:  // not used in ForwardCom
+                        case uint32_t(SHN_ABS_X86):  // not used in ForwardCom
                             printf(", absolute,"); break;
-                        case SHN_COMMON:
+                        case uint32_t(SHN_COMMON):
                             printf(", common,"); break;
                         default:
                             printf(", section: 0x%X", sym.st_shndx);
@@ -544,8 +544,8 @@ void CELF::dump(int options) {
             // Dump relocation table
             if ((sheader.sh_type == SHT_REL || sheader.sh_type == SHT_RELA) && (options & DUMP_RELTAB)) {
                 printf("\n  Relocations:");
-                int8_t * reltab = buf() + uint32_t(sheader.sh_offset);
-                int8_t * reltabend = reltab + uint32_t(sheader.sh_size);
+                int8_t * reltab = buf() + sheader.sh_offset;
+                int8_t * reltabend = reltab + sheader.sh_size;
                 uint32_t expectedentrysize = sheader.sh_type == SHT_RELA ?
                     sizeof(Elf64_Rela) :                // Elf32_Rela, Elf64_Rela
                     sizeof(Elf64_Rela) - wordSize / 8;  // Elf32_Rel,  Elf64_Rel
@@ -591,7 +591,7 @@ void CELF::dump(int options) {
 
                     // Find inline addend
                     Elf64_Shdr relsheader = sectionHeaders[sheader.sh_info];
-                    uint32_t relsoffset = uint32_t(relsheader.sh_offset);
+                    uint64_t relsoffset = relsheader.sh_offset;
                     if (relsoffset + rel.r_offset < dataSize() && relsheader.sh_type != SHT_NOBITS) {
                         int32_t * piaddend = (int32_t*)(buf() + relsoffset + rel.r_offset);
                         if (*piaddend) printf(", Inline value: 0x%X", *piaddend);
@@ -620,11 +620,11 @@ void CELF::publicNames(CMemoryBuffer * strings, CDynamicArray<SStringEntry> * in
 
             // Find associated string table
             if (sheader.sh_link >= (uint32_t)nSections) { err.submit(ERR_ELF_INDEX_RANGE); sheader.sh_link = 0; }
-            int8_t * strtab = buf() + uint32_t(sectionHeaders[sheader.sh_link].sh_offset);
+            int8_t * strtab = buf() + sectionHeaders[sheader.sh_link].sh_offset;
 
             // Find symbol table
-            uint32_t symtabsize = uint32_t(sheader.sh_size);
-            int8_t * symtab = buf() + uint32_t(sheader.sh_offset);
+            uint64_t symtabsize = sheader.sh_size;
+            int8_t * symtab = buf() + sheader.sh_offset;
             int8_t * symtabend = symtab + symtabsize;
             if (entrysize < sizeof(Elf64_Sym)) { err.submit(ERR_ELF_RECORD_SIZE); entrysize = sizeof(Elf64_Sym); }
 
@@ -670,10 +670,10 @@ void CELF::publicNames(CMemoryBuffer * strings, CDynamicArray<SStringEntry> * in
 const char * CELF::symbolName(uint32_t index) {
     // Get name of symbol. (ParseFile() must be called first)
     const char * symname = 0;  // Symbol name
-    uint32_t symi;           // Symbol index
+    uint64_t symi;           // Offset of symbol record
     uint32_t stri;           // String index
     if (symbolTableOffset) {
-        symi = symbolTableOffset + index * symbolTableEntrySize;
+        symi = symbolTableOffset + (uint64_t)index * symbolTableEntrySize;
         if (symi < dataSize()) {
             stri = get<Elf64_Sym>(symi).st_name;
             if (stri < symbolStringTableSize) {
@@ -701,7 +701,7 @@ int CELF::split() {
     uint32_t programHeaderOffset = (uint32_t)fileHeader.e_phoff;
     Elf64_Phdr pHeader;
     for (uint32_t i = 0; i < nProgramHeaders; i++) {
-        pHeader = get<Elf64_Phdr>(programHeaderOffset);
+        pHeader = get<Elf64_Phdr>(programHeaderOffset + i * programHeaderSize);
         if (pHeader.p_filesz > 0 && (uint32_t)pHeader.p_offset < dataSize()) {
             uint32_t phOffset = dataBuffer.push(buf() + (uint32_t)pHeader.p_offset, (uint32_t)pHeader.p_filesz);
             pHeader.p_offset = phOffset;         // New offset refers to dataBuffer
@@ -739,6 +739,11 @@ int CELF::split() {
             uint32_t newOffset = dataBuffer.push(sectionData, InitSize);
             sheader2.sh_offset = newOffset;       // New offset refers to dataBuffer
         }
+        else if (sheader2.sh_type == SHT_NOBITS) {
+            // Uninitialized data section. Keep the size, but no data. The linker and the emulator
+            // fill it with zeroes in the memory image
+            sheader2.sh_offset = 0;
+        }
         else {
             sheader2.sh_offset = sheader2.sh_size = 0;
         }
@@ -769,12 +774,12 @@ int CELF::split() {
 
             // Find associated string table
             if (sheader.sh_link >= nSections) { err.submit(ERR_ELF_INDEX_RANGE); sheader.sh_link = 0; }
-            uint32_t strtabOffset = (uint32_t)sectionHeaders[sheader.sh_link].sh_offset;
+            uint64_t strtabOffset = sectionHeaders[sheader.sh_link].sh_offset;
             if (sectionHeaders[sheader.sh_link].sh_offset >= dataSize()) err.submit(ERR_ELF_INDEX_RANGE);
 
             // Find symbol table
-            uint32_t symtabsize = (uint32_t)(sheader.sh_size);
-            int8_t * symtab = buf() + uint32_t(sheader.sh_offset);
+            uint64_t symtabsize = sheader.sh_size;
+            int8_t * symtab = buf() + sheader.sh_offset;
             int8_t * symtabend = symtab + symtabsize;
             if (entrysize < (uint32_t)sizeof(Elf64_Sym)) { 
                 err.submit(ERR_ELF_RECORD_SIZE); entrysize = (uint32_t)sizeof(ElfFWC_Sym); 
@@ -811,7 +816,7 @@ int CELF::split() {
 
                 // Get name
                 if (sym.st_name) {
-                    if ((uint64_t)strtabOffset + sym.st_name > dataSize()) err.submit(ERR_ELF_INDEX_RANGE);
+                    if (strtabOffset + sym.st_name > dataSize()) err.submit(ERR_ELF_INDEX_RANGE);
                     else {
                         const char * symName = (char*)buf() + strtabOffset + sym.st_name;
                         sym.st_name = stringBuffer.pushString(symName);
@@ -841,8 +846,8 @@ int CELF::split() {
 
         if (sheader.sh_type == SHT_RELA || sheader.sh_type == SHT_REL) {
             // Relocations section
-            int8_t * reltab = buf() + uint32_t(sheader.sh_offset);
-            int8_t * reltabend = reltab + uint32_t(sheader.sh_size);
+            int8_t * reltab = buf() + sheader.sh_offset;
+            int8_t * reltabend = reltab + sheader.sh_size;
             int entrysize = (uint32_t)(sheader.sh_entsize);
             int expectedentrysize = sheader.sh_type == SHT_RELA ? sizeof(Elf64_Rela) : 16;  // Elf64_Rela : Elf64_Rel
             if (entrysize < expectedentrysize) {
@@ -908,8 +913,8 @@ int CELF::split() {
 // Join containers into ELF file
 int CELF::join(uint32_t e_type) {
     uint32_t sc;                                 // Section index
-    uint32_t os;                                 // Offset of data in file
-    uint32_t size;                               // Size of section data
+    uint64_t os;                                 // Offset of data in file
+    uint64_t size;                               // Size of section data
     uint32_t shtype;                             // Section header type
     const char * name;                           // Name of a symbol
     CDynamicArray<Elf64_Shdr> newSectionHeaders; // Modify list of section headers
@@ -947,20 +952,17 @@ int CELF::join(uint32_t e_type) {
     newShStrtab.pushString("");
 
     if (e_type == ET_EXEC) {
-        // Executable file. Insert program headers
+        // Executable file. Insert program headers.
+        // The data of each segment are the sections that have the same base pointer flag
+        // (SHF_IP, SHF_DATAP, SHF_THREADP) as p_flags. p_offset is set when the sections are inserted
         uint32_t ph;  // Program header index
         fileheader.e_phoff = dataSize();
         fileheader.e_phentsize = (uint16_t)sizeof(Elf64_Phdr);
+        fileheader.e_phnum = (uint16_t)programHeaders.numEntries();
         for (ph = 0; ph < programHeaders.numEntries(); ph++) {
-            push(&programHeaders[ph], sizeof(Elf64_Phdr));
-        }
-        // Insert program header data
-        for (uint32_t ph = 0; ph < programHeaders.numEntries(); ph++) {
-            if (programHeaders[ph].p_filesz) {
-                os = push(dataBuffer.buf() + programHeaders[ph].p_offset, (uint32_t)programHeaders[ph].p_filesz);
-                get<Elf64_Phdr>(uint32_t(fileheader.e_phoff + ph*sizeof(Elf64_Phdr))).p_offset = os;
-                fileheader.e_phnum++;
-            }
+            Elf64_Phdr pHeader = programHeaders[ph];
+            pHeader.p_offset = 0;
+            push(&pHeader, sizeof(Elf64_Phdr));
         }
     }
 
@@ -976,11 +978,26 @@ int CELF::join(uint32_t e_type) {
         }
         else if (shtype != SHT_NOBITS && sectionHeader.sh_size != 0) {
             // Section contains data
-            os = (uint32_t)sectionHeader.sh_offset;
-            size = (uint32_t)sectionHeader.sh_size;
-            if (os + size > dataBuffer.dataSize()) {
+            os = sectionHeader.sh_offset;
+            size = sectionHeader.sh_size;
+            if (os + size > dataBuffer.dataSize() || os + size < os) {
                 err.submit(ERR_ELF_INDEX_RANGE); return ERR_ELF_INDEX_RANGE;
             }
+            if (e_type == ET_EXEC) {
+                // Place section at the same position relative to the segment begin as in memory
+                for (uint32_t ph = 0; ph < programHeaders.numEntries(); ph++) {
+                    uint64_t phOffset = fileheader.e_phoff + ph * sizeof(Elf64_Phdr);
+                    if (!(get<Elf64_Phdr>(phOffset).p_flags & sectionHeader.sh_flags & (SHF_IP | SHF_DATAP | SHF_THREADP))) continue;
+                    if (get<Elf64_Phdr>(phOffset).p_offset == 0) {
+                        // first section in this segment
+                        align(get<Elf64_Phdr>(phOffset).p_align > 8 ? get<Elf64_Phdr>(phOffset).p_align : 8);
+                        get<Elf64_Phdr>(phOffset).p_offset = dataSize();
+                    }
+                    uint64_t sectionPos = get<Elf64_Phdr>(phOffset).p_offset + sectionHeader.sh_addr;
+                    if (sectionPos > dataSize()) push(0, sectionPos - dataSize());
+                    break;
+                }
+            }
             // Put raw data into file and save the offset
             os = push(dataBuffer.buf() + os, size);
             sectionHeader.sh_offset = os;
@@ -1122,7 +1139,7 @@ uint32_t  CELF::addSection(Elf64_Shdr & section, CMemoryBuffer const & strings,
     int nul = 0;
     section2.sh_name = stringBuffer.pushString((const char*)strings.buf() + section.sh_name); // copy string
     if (dataBuffer.dataSize() == 0) dataBuffer.push(&nul, 4);     // add a zero to avoid offset beginning at zero
-    section2.sh_offset = dataBuffer.push(data.buf() + section.sh_offset, (uint32_t)section.sh_size); // copy data
+    section2.sh_offset = dataBuffer.push(data.buf() + section.sh_offset, section.sh_size); // copy data
     if (sectionHeaders.dataSize() == 0) {    // make empty section 0
         Elf64_Shdr section0 = {0,0,0,0,0,0,0,0,0,0};
         sectionHeaders.push(section0);
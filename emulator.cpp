@@ -0,0 +1,1951 @@
+/****************************    emulator.cpp    ********************************
+* Author:        Agner Fog
+* Date created:  2017-11-25
+* Last modified: 2017-11-28
+* Version:       1.00
+* Project:       Binary tools for ForwardCom instruction set
+* Module:        emulator.cpp
+* Description:
+* This module contains the emulator for running ForwardCom executable files.
+* See emulator.h for a description of the predecoding and execution stages.
+*
+* Copyright 2017 GNU General Public License http://www.gnu.org/licenses
+*****************************************************************************/
+
+#include "stdafx.h"
+
+// Instruction length in 32-bit words, indexed by the upper 3 bits (same as in disasm1.cpp)
+static const uint8_t lengthList[8] = {1, 1, 1, 1, 2, 2, 3, 4};
+
+// Mask for the bits of each integer operand type
+static const uint64_t dataMask[4] = {0xFF, 0xFFFF, 0xFFFFFFFF, 0xFFFFFFFFFFFFFFFF};
+
+// Log2 of data size for each operand type, matching dataSizeTable = {1, 2, 4, 8, 16, 4, 8, 16}
+static const uint8_t dataSizeLog2[8] = {0, 1, 2, 3, 4, 2, 3, 4};
+
+// Operations. The values are the instruction ids in the instruction list
+const int EMU_STORE       = 1;
+const int EMU_MOVE        = 2;
+const int EMU_SIGN_EXTEND = 4;
+const int EMU_COMPARE     = 7;
+const int EMU_ADD         = 8;
+const int EMU_SUB         = 9;
+const int EMU_SUB_REV     = 10;
+const int EMU_MUL         = 11;
+const int EMU_MUL_HI      = 12;
+const int EMU_MUL_HI_U    = 13;
+const int EMU_DIV         = 16;
+const int EMU_DIV_U       = 17;
+const int EMU_DIV_REV     = 18;
+const int EMU_REM         = 20;
+const int EMU_REM_U       = 21;
+const int EMU_MIN         = 22;
+const int EMU_MIN_U       = 23;
+const int EMU_MAX         = 24;
+const int EMU_MAX_U       = 25;
+const int EMU_AND         = 28;
+const int EMU_AND_NOT     = 29;
+const int EMU_OR          = 30;
+const int EMU_XOR         = 31;
+const int EMU_SHL         = 32;
+const int EMU_ROTATE      = 33;
+const int EMU_SHR_S       = 34;
+const int EMU_SHR_U       = 35;
+const int EMU_SET_BIT     = 36;
+const int EMU_CLEAR_BIT   = 37;
+const int EMU_TOGGLE_BIT  = 38;
+const int EMU_TEST_BIT    = 40;
+const int EMU_TEST        = 0x50;          // test/jump_all1
+const int EMU_INCREMENT_COMPARE = 0x51;    // increment_compare/jump_above
+const int EMU_SUB_MAXLEN  = 0x52;          // sub_maxlen/jump_pos
+const int EMU_INSERT_HI   = 0x29001;
+const int EMU_ADDRESS     = 0x29020;
+const int EMU_JUMP        = 0x101000;
+const int EMU_CALL        = 0x101100;
+const int EMU_RETURN      = 0x4001E;
+
+// Jump conditions. The values are bit 8-15 of the instruction id, with the invert bit removed
+const int EMU_COND_ALWAYS   = 0x10;
+const int EMU_COND_ZERO     = 0x12;        // zero or equal
+const int EMU_COND_POS      = 0x14;        // positive or signed above
+const int EMU_COND_NEG      = 0x16;        // negative or signed below
+const int EMU_COND_OVERFLOW = 0x18;        // signed overflow
+const int EMU_COND_CARRY    = 0x20;        // carry, borrow, or unsigned below
+const int EMU_COND_UABOVE   = 0x22;        // unsigned above
+
+
+/*****************************************************************************
+Arithmetic functions
+*****************************************************************************/
+
+// Sign-extend integer of operand type ot to 64 bits
+static inline int64_t signExtend(uint64_t x, uint32_t ot) {
+    uint32_t s = 64 - (8 << ot);
+    return (int64_t)(x << s) >> s;
+}
+
+// High part of unsigned 64x64 bit product
+static inline uint64_t mulHighU(uint64_t a, uint64_t b) {
+    uint64_t a0 = (uint32_t)a, a1 = a >> 32, b0 = (uint32_t)b, b1 = b >> 32;
+    uint64_t p01 = a0 * b1, p10 = a1 * b0;
+    uint64_t mid = (a0 * b0 >> 32) + (uint32_t)p01 + (uint32_t)p10;
+    return a1 * b1 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+}
+
+// High part of signed 64x64 bit product
+static inline uint64_t mulHighS(uint64_t a, uint64_t b) {
+    uint64_t h = mulHighU(a, b);
+    if ((int64_t)a < 0) h -= b;
+    if ((int64_t)b < 0) h -= a;
+    return h;
+}
+
+// Signed division. Does not trap on division by zero or overflow.
+// x / 0 gives the minimum or maximum value with the sign of x. INT_MIN / -1 gives INT_MIN
+static inline uint64_t divSigned(uint64_t a, uint64_t b, uint32_t ot) {
+    int64_t sa = signExtend(a, ot), sb = signExtend(b, ot);
+    int64_t minValue = signExtend((uint64_t)1 << ((8 << ot) - 1), ot);
+    if (sb == 0) return sa < 0 ? minValue : ~minValue;
+    if (sb == -1) return 0 - (uint64_t)sa;
+    return sa / sb;
+}
+
+// Signed remainder. x % 0 gives x
+static inline uint64_t remSigned(uint64_t a, uint64_t b, uint32_t ot) {
+    int64_t sa = signExtend(a, ot), sb = signExtend(b, ot);
+    if (sb == 0) return sa;
+    if (sb == -1) return 0;
+    return sa % sb;
+}
+
+// Calculate result of operation OP with operand type ot
+template <int OP>
+static inline uint64_t emuCalc(uint64_t a, uint64_t b, uint32_t ot, uint32_t options) {
+    uint64_t m = dataMask[ot];
+    uint32_t bits = 8 << ot;
+    uint64_t r = 0;
+    switch (OP) {
+    case EMU_MOVE:
+        r = b;  break;
+    case EMU_SIGN_EXTEND:
+        return signExtend(b, ot);                // 64-bit result
+    case EMU_COMPARE: {
+        // options = IM3: bit 1-2: condition, bit 0: invert, bit 3: unsigned
+        bool c = false;
+        switch (options & 6) {
+        case 0:
+            c = ((a ^ b) & m) == 0;  break;
+        case 2:
+            c = (options & 8) ? (a & m) < (b & m) : signExtend(a, ot) < signExtend(b, ot);  break;
+        case 4:
+            c = (options & 8) ? (a & m) > (b & m) : signExtend(a, ot) > signExtend(b, ot);  break;
+        }                                        // 6: compare absolute values is for float only
+        return c ^ (options & 1);}
+    case EMU_ADD:
+        r = a + b;  break;
+    case EMU_SUB:
+        r = a - b;  break;
+    case EMU_SUB_REV:
+        r = b - a;  break;
+    case EMU_MUL:
+        r = a * b;  break;
+    case EMU_MUL_HI:
+        if (ot == 3) r = mulHighS(a, b);
+        else r = (uint64_t)(signExtend(a, ot) * signExtend(b, ot)) >> bits;
+        break;
+    case EMU_MUL_HI_U:
+        if (ot == 3) r = mulHighU(a, b);
+        else r = (a & m) * (b & m) >> bits;
+        break;
+    case EMU_DIV:
+        r = divSigned(a, b, ot);  break;
+    case EMU_DIV_U:
+        r = (b & m) ? (a & m) / (b & m) : m;  break;
+    case EMU_DIV_REV:
+        r = divSigned(b, a, ot);  break;
+    case EMU_REM:
+        r = remSigned(a, b, ot);  break;
+    case EMU_REM_U:
+        r = (b & m) ? (a & m) % (b & m) : a;  break;
+    case EMU_MIN:
+        r = signExtend(a, ot) < signExtend(b, ot) ? a : b;  break;
+    case EMU_MIN_U:
+        r = (a & m) < (b & m) ? a : b;  break;
+    case EMU_MAX:
+        r = signExtend(a, ot) > signExtend(b, ot) ? a : b;  break;
+    case EMU_MAX_U:
+        r = (a & m) > (b & m) ? a : b;  break;
+    case EMU_AND:
+        r = a & b;  break;
+    case EMU_AND_NOT:
+        r = a & ~b;  break;
+    case EMU_OR:
+        r = a | b;  break;
+    case EMU_XOR:
+        r = a ^ b;  break;
+    case EMU_SHL:
+        r = b < bits ? a << b : 0;  break;
+    case EMU_ROTATE: {
+        uint32_t n = b & (bits - 1);
+        r = n ? (a & m) << n | (a & m) >> (bits - n) : a;
+        break;}
+    case EMU_SHR_S:
+        r = signExtend(a, ot) >> (b < bits ? b : bits - 1);  break;
+    case EMU_SHR_U:
+        r = b < bits ? (a & m) >> b : 0;  break;
+    case EMU_SET_BIT:
+        r = b < bits ? a | (uint64_t)1 << b : a;  break;
+    case EMU_CLEAR_BIT:
+        r = b < bits ? a & ~((uint64_t)1 << b) : a;  break;
+    case EMU_TOGGLE_BIT:
+        r = b < bits ? a ^ (uint64_t)1 << b : a;  break;
+    case EMU_TEST_BIT:
+        r = b < bits ? (a >> b) & 1 : 0;  break;
+    case EMU_INSERT_HI:
+        r = (a & 0xFFFFFFFF) | b;  break;
+    }
+    return r & m;
+}
+
+
+/*****************************************************************************
+Vector kernels
+*****************************************************************************/
+
+// Element size for each operand type
+static const uint32_t elementSize[8] = {1, 2, 4, 8, 16, 4, 8, 16};
+
+// Source of vector length for memory operand
+const int EMU_VECTOR_LENGTH    = 0;        // Length in register
+const int EMU_VECTOR_BROADCAST = 1;        // Broadcast one element to length in register
+const int EMU_VECTOR_SCALAR    = 2;        // One element
+
+// Bit pattern of floating point number converted to float (ot = 5) or double (ot = 6)
+static inline int64_t floatBits(double f, uint32_t ot) {
+    if (ot == 5) {
+        float g = (float)f;
+        uint32_t b;
+        memcpy(&b, &g, 4);
+        return b;
+    }
+    int64_t b;
+    memcpy(&b, &f, 8);
+    return b;
+}
+
+// Operand type of element type T: 0-3 for integers, 5 for float, 6 for double
+template <typename T>
+static inline uint32_t elementType() {
+    if (T(0.5) != T(0)) return sizeof(T) == 4 ? 5 : 6;
+    return sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 1 : sizeof(T) == 4 ? 2 : 3;
+}
+
+#if defined(FWC_AVX2)
+#define EMU_SIMD
+// 256-bit registers
+typedef __m256i EmuSimd;
+const uint32_t EMU_SIMD_SIZE = 32;
+#define EMU_SIMD_OP(name) _mm256_##name
+static inline EmuSimd simdLoad(void const * p) {return _mm256_loadu_si256((__m256i const *)p);}
+static inline void simdStore(void * p, EmuSimd x) {_mm256_storeu_si256((__m256i *)p, x);}
+static inline EmuSimd simdAnd(EmuSimd a, EmuSimd b) {return _mm256_and_si256(a, b);}
+static inline EmuSimd simdAndNot(EmuSimd a, EmuSimd b) {return _mm256_andnot_si256(b, a);}
+static inline EmuSimd simdOr(EmuSimd a, EmuSimd b) {return _mm256_or_si256(a, b);}
+static inline EmuSimd simdXor(EmuSimd a, EmuSimd b) {return _mm256_xor_si256(a, b);}
+static inline __m256  simdF(EmuSimd x) {return _mm256_castsi256_ps(x);}
+static inline __m256d simdD(EmuSimd x) {return _mm256_castsi256_pd(x);}
+static inline EmuSimd simdI(__m256 x) {return _mm256_castps_si256(x);}
+static inline EmuSimd simdI(__m256d x) {return _mm256_castpd_si256(x);}
+static const char * const simdName = "AVX2";
+#elif defined(FWC_SSE2)
+#define EMU_SIMD
+// 128-bit registers
+typedef __m128i EmuSimd;
+const uint32_t EMU_SIMD_SIZE = 16;
+#define EMU_SIMD_OP(name) _mm_##name
+static inline EmuSimd simdLoad(void const * p) {return _mm_loadu_si128((__m128i const *)p);}
+static inline void simdStore(void * p, EmuSimd x) {_mm_storeu_si128((__m128i *)p, x);}
+static inline EmuSimd simdAnd(EmuSimd a, EmuSimd b) {return _mm_and_si128(a, b);}
+static inline EmuSimd simdAndNot(EmuSimd a, EmuSimd b) {return _mm_andnot_si128(b, a);}
+static inline EmuSimd simdOr(EmuSimd a, EmuSimd b) {return _mm_or_si128(a, b);}
+static inline EmuSimd simdXor(EmuSimd a, EmuSimd b) {return _mm_xor_si128(a, b);}
+static inline __m128  simdF(EmuSimd x) {return _mm_castsi128_ps(x);}
+static inline __m128d simdD(EmuSimd x) {return _mm_castsi128_pd(x);}
+static inline EmuSimd simdI(__m128 x) {return _mm_castps_si128(x);}
+static inline EmuSimd simdI(__m128d x) {return _mm_castpd_si128(x);}
+static const char * const simdName = "SSE2";
+#else
+static const char * const simdName = "none";
+#endif
+
+#ifdef EMU_SIMD
+// Number of SIMD registers in a vector register
+const uint32_t EMU_SIMD_NUM = EMU_MAX_VECTOR_LENGTH / EMU_SIMD_SIZE;
+
+// Byte indexes for making a mask from the vector length
+static const int8_t byteIndex[EMU_MAX_VECTOR_LENGTH] = {
+     0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63};
+
+// Mask with all ones in the bytes of SIMD register k that are below len
+static inline EmuSimd simdLengthMask(uint32_t len, uint32_t k) {
+    return EMU_SIMD_OP(cmpgt_epi8)(EMU_SIMD_OP(set1_epi8)((char)len), simdLoad(byteIndex + k * EMU_SIMD_SIZE));
+}
+
+// Broadcast immediate operand with operand type ot
+static inline EmuSimd simdBroadcast(int64_t x, uint32_t ot) {
+    switch (elementSize[ot]) {
+    case 1:  return EMU_SIMD_OP(set1_epi8)((char)x);
+    case 2:  return EMU_SIMD_OP(set1_epi16)((short)x);
+    case 4:  return EMU_SIMD_OP(set1_epi32)((int)x);
+    default: return EMU_SIMD_OP(set1_epi64x)(x);
+    }
+}
+#endif
+
+// Element types for vector operations. Integer operations use unsigned types to avoid
+// undefined overflow. Bitwise operations on float and double use the bit pattern
+struct EmuVectorUnsigned {
+    static const bool move = false;
+    typedef uint8_t T0;  typedef uint16_t T1;  typedef uint32_t T2;  typedef uint64_t T3;
+    typedef float T5;  typedef double T6;
+};
+struct EmuVectorSigned {
+    static const bool move = false;
+    typedef int8_t T0;  typedef int16_t T1;  typedef int32_t T2;  typedef int64_t T3;
+    typedef float T5;  typedef double T6;
+};
+struct EmuVectorBits {
+    static const bool move = false;
+    typedef uint8_t T0;  typedef uint16_t T1;  typedef uint32_t T2;  typedef uint64_t T3;
+    typedef uint32_t T5;  typedef uint64_t T6;
+};
+
+// Vector operations. types has a bit for each supported operand type. simdTypes has a bit for
+// each operand type that has a SIMD kernel. calc makes one element. simd makes one SIMD register
+struct EmuVectorMove : EmuVectorBits {
+    static const bool move = true;
+    static const uint32_t types = 0x6F, simdTypes = 0x6F;
+    template <typename T> static T calc(T, T b) {return b;}
+#ifdef EMU_SIMD
+    static EmuSimd simd(EmuSimd, EmuSimd b, uint32_t) {return b;}
+#endif
+};
+
+struct EmuVectorAdd : EmuVectorUnsigned {
+    static const uint32_t types = 0x6F, simdTypes = 0x6F;
+    template <typename T> static T calc(T a, T b) {return T(a + b);}
+#ifdef EMU_SIMD
+    static EmuSimd simd(EmuSimd a, EmuSimd b, uint32_t ot) {
+        switch (ot) {
+        case 0:  return EMU_SIMD_OP(add_epi8)(a, b);
+        case 1:  return EMU_SIMD_OP(add_epi16)(a, b);
+        case 2:  return EMU_SIMD_OP(add_epi32)(a, b);
+        case 3:  return EMU_SIMD_OP(add_epi64)(a, b);
+        case 5:  return simdI(EMU_SIMD_OP(add_ps)(simdF(a), simdF(b)));
+        default: return simdI(EMU_SIMD_OP(add_pd)(simdD(a), simdD(b)));
+        }
+    }
+#endif
+};
+
+struct EmuVectorSub : EmuVectorUnsigned {
+    static const uint32_t types = 0x6F, simdTypes = 0x6F;
+    template <typename T> static T calc(T a, T b) {return T(a - b);}
+#ifdef EMU_SIMD
+    static EmuSimd simd(EmuSimd a, EmuSimd b, uint32_t ot) {
+        switch (ot) {
+        case 0:  return EMU_SIMD_OP(sub_epi8)(a, b);
+        case 1:  return EMU_SIMD_OP(sub_epi16)(a, b);
+        case 2:  return EMU_SIMD_OP(sub_epi32)(a, b);
+        case 3:  return EMU_SIMD_OP(sub_epi64)(a, b);
+        case 5:  return simdI(EMU_SIMD_OP(sub_ps)(simdF(a), simdF(b)));
+        default: return simdI(EMU_SIMD_OP(sub_pd)(simdD(a), simdD(b)));
+        }
+    }
+#endif
+};
+
+struct EmuVectorSubRev : EmuVectorUnsigned {
+    static const uint32_t types = 0x6F, simdTypes = 0x6F;
+    template <typename T> static T calc(T a, T b) {return EmuVectorSub::calc(b, a);}
+#ifdef EMU_SIMD
+    static EmuSimd simd(EmuSimd a, EmuSimd b, uint32_t ot) {return EmuVectorSub::simd(b, a, ot);}
+#endif
+};
+
+// Integer multiplication has SIMD instructions only for 16 bits, and 32 bits with AVX2
+struct EmuVectorMul : EmuVectorUnsigned {
+#ifdef FWC_AVX2
+    static const uint32_t types = 0x6F, simdTypes = 0x66;
+#else
+    static const uint32_t types = 0x6F, simdTypes = 0x62;
+#endif
+    template <typename T> static T calc(T a, T b) {return T(a * b);}
+    static uint16_t calc(uint16_t a, uint16_t b) {return uint16_t((uint32_t)a * b);} // Avoid signed int overflow
+#ifdef EMU_SIMD
+    static EmuSimd simd(EmuSimd a, EmuSimd b, uint32_t ot) {
+        switch (ot) {
+        case 1:  return EMU_SIMD_OP(mullo_epi16)(a, b);
+#ifdef FWC_AVX2
+        case 2:  return _mm256_mullo_epi32(a, b);
+#endif
+        case 5:  return simdI(EMU_SIMD_OP(mul_ps)(simdF(a), simdF(b)));
+        default: return simdI(EMU_SIMD_OP(mul_pd)(simdD(a), simdD(b)));
+        }
+    }
+#endif
+};
+
+// Integer division is not supported in vectors
+struct EmuVectorDiv : EmuVectorUnsigned {
+    static const uint32_t types = 0x60, simdTypes = 0x60;
+    template <typename T> static T calc(T a, T b) {return T(a / b);}
+#ifdef EMU_SIMD
+    static EmuSimd simd(EmuSimd a, EmuSimd b, uint32_t ot) {
+        if (ot == 5) return simdI(EMU_SIMD_OP(div_ps)(simdF(a), simdF(b)));
+        return simdI(EMU_SIMD_OP(div_pd)(simdD(a), simdD(b)));
+    }
+#endif
+};
+
+// Signed minimum and maximum have SIMD instructions for 16 bits, and 8 and 32 bits with AVX2.
+// The float versions give b if either operand is NAN, as calc does
+struct EmuVectorMin : EmuVectorSigned {
+#ifdef FWC_AVX2
+    static const uint32_t types = 0x6F, simdTypes = 0x67;
+#else
+    static const uint32_t types = 0x6F, simdTypes = 0x62;
+#endif
+    template <typename T> static T calc(T a, T b) {return a < b ? a : b;}
+#ifdef EMU_SIMD
+    static EmuSimd simd(EmuSimd a, EmuSimd b, uint32_t ot) {
+        switch (ot) {
+#ifdef FWC_AVX2
+        case 0:  return _mm256_min_epi8(a, b);
+        case 2:  return _mm256_min_epi32(a, b);
+#endif
+        case 1:  return EMU_SIMD_OP(min_epi16)(a, b);
+        case 5:  return simdI(EMU_SIMD_OP(min_ps)(simdF(a), simdF(b)));
+        default: return simdI(EMU_SIMD_OP(min_pd)(simdD(a), simdD(b)));
+        }
+    }
+#endif
+};
+
+struct EmuVectorMax : EmuVectorSigned {
+#ifdef FWC_AVX2
+    static const uint32_t types = 0x6F, simdTypes = 0x67;
+#else
+    static const uint32_t types = 0x6F, simdTypes = 0x62;
+#endif
+    template <typename T> static T calc(T a, T b) {return a > b ? a : b;}
+#ifdef EMU_SIMD
+    static EmuSimd simd(EmuSimd a, EmuSimd b, uint32_t ot) {
+        switch (ot) {
+#ifdef FWC_AVX2
+        case 0:  return _mm256_max_epi8(a, b);
+        case 2:  return _mm256_max_epi32(a, b);
+#endif
+        case 1:  return EMU_SIMD_OP(max_epi16)(a, b);
+        case 5:  return simdI(EMU_SIMD_OP(max_ps)(simdF(a), simdF(b)));
+        default: return simdI(EMU_SIMD_OP(max_pd)(simdD(a), simdD(b)));
+        }
+    }
+#endif
+};
+
+struct EmuVectorAnd : EmuVectorBits {
+    static const uint32_t types = 0x6F, simdTypes = 0x6F;
+    template <typename T> static T calc(T a, T b) {return T(a & b);}
+#ifdef EMU_SIMD
+    static EmuSimd simd(EmuSimd a, EmuSimd b, uint32_t) {return simdAnd(a, b);}
+#endif
+};
+
+struct EmuVectorAndNot : EmuVectorBits {
+    static const uint32_t types = 0x6F, simdTypes = 0x6F;
+    template <typename T> static T calc(T a, T b) {return T(a & ~b);}
+#ifdef EMU_SIMD
+    static EmuSimd simd(EmuSimd a, EmuSimd b, uint32_t) {return simdAndNot(a, b);}
+#endif
+};
+
+struct EmuVectorOr : EmuVectorBits {
+    static const uint32_t types = 0x6F, simdTypes = 0x6F;
+    template <typename T> static T calc(T a, T b) {return T(a | b);}
+#ifdef EMU_SIMD
+    static EmuSimd simd(EmuSimd a, EmuSimd b, uint32_t) {return simdOr(a, b);}
+#endif
+};
+
+struct EmuVectorXor : EmuVectorBits {
+    static const uint32_t types = 0x6F, simdTypes = 0x6F;
+    template <typename T> static T calc(T a, T b) {return T(a ^ b);}
+#ifdef EMU_SIMD
+    static EmuSimd simd(EmuSimd a, EmuSimd b, uint32_t) {return simdXor(a, b);}
+#endif
+};
+
+// Copy len bytes from memory to vector register and clear the rest of the register.
+// The SIMD version reads a whole vector register from memory if wholeFits is true
+template <bool SIMD>
+static inline void vectorRead(uint8_t * d, int8_t const * s, uint32_t len, bool wholeFits) {
+#ifdef EMU_SIMD
+    if (SIMD && wholeFits) {
+        for (uint32_t k = 0; k < EMU_SIMD_NUM; k++) {
+            simdStore(d + k * EMU_SIMD_SIZE, simdAnd(simdLoad(s + k * EMU_SIMD_SIZE), simdLengthMask(len, k)));
+        }
+        return;
+    }
+#endif
+    memcpy(d, s, len);
+    memset(d + len, 0, EMU_MAX_VECTOR_LENGTH - len);
+}
+
+// Copy len bytes from vector register to memory. The SIMD version merges the last partial
+// SIMD register with the existing memory contents if the whole SIMD register fits in memory
+template <bool SIMD>
+static inline void vectorWrite(int8_t * d, uint8_t const * s, uint32_t len, bool wholeFits) {
+#ifdef EMU_SIMD
+    if (SIMD && wholeFits) {
+        uint32_t k;
+        for (k = 0; (k + 1) * EMU_SIMD_SIZE <= len; k++) {
+            simdStore(d + k * EMU_SIMD_SIZE, simdLoad(s + k * EMU_SIMD_SIZE));
+        }
+        if (k * EMU_SIMD_SIZE < len) {           // Masked tail
+            EmuSimd m = simdLengthMask(len, k);
+            EmuSimd x = simdLoad(s + k * EMU_SIMD_SIZE);
+            EmuSimd y = simdLoad(d + k * EMU_SIMD_SIZE);
+            simdStore(d + k * EMU_SIMD_SIZE, simdOr(simdAnd(x, m), simdAndNot(y, m)));
+        }
+        return;
+    }
+#endif
+    memcpy(d, s, len);
+}
+
+
+/*****************************************************************************
+Micro-operation handlers. Each handler returns the next micro-operation
+*****************************************************************************/
+
+// rd = OP(rs1, rs2 or immediate)
+template <int OP, bool IMM>
+static SEmuOp const * emuArith(CEmulator & e, SEmuOp const * op) {
+    uint64_t b = IMM ? (uint64_t)op->imm : e.registers[op->rs2];
+    e.registers[op->rd] = emuCalc<OP>(e.registers[op->rs1], b, op->ot, op->options);
+    return op + 1;
+}
+
+// rd = memory operand, zero-extended
+template <int SIZE, bool LIMIT>
+static SEmuOp const * emuLoad(CEmulator & e, SEmuOp const * op) {
+    uint64_t index = e.registers[op->index];
+    if (LIMIT && index > (uint64_t)op->imm) return e.fault(ERR_EMU_INDEX_LIMIT, op, index);
+    uint64_t a = e.registers[op->base] + (index << op->scale) + op->offset;
+    if (a > e.memSize - SIZE) return e.fault(ERR_EMU_MEMORY_ACCESS, op, a);
+    uint64_t x = 0;
+    switch (SIZE) {
+    case 1: x = *(uint8_t*)(e.mem + a);  break;
+    case 2: x = *(uint16_t*)(e.mem + a);  break;
+    case 4: x = *(uint32_t*)(e.mem + a);  break;
+    case 8: x = *(uint64_t*)(e.mem + a);  break;
+    }
+    e.registers[op->rd] = x;
+    return op + 1;
+}
+
+// memory operand = rs2 or immediate
+template <int SIZE, bool IMM, bool LIMIT>
+static SEmuOp const * emuStore(CEmulator & e, SEmuOp const * op) {
+    uint64_t index = e.registers[op->index];
+    if (LIMIT && index > (uint64_t)op->imm) return e.fault(ERR_EMU_INDEX_LIMIT, op, index);
+    uint64_t a = e.registers[op->base] + (index << op->scale) + op->offset;
+    if (a - e.writeBegin > e.memSize - e.writeBegin - SIZE) return e.fault(ERR_EMU_MEMORY_ACCESS, op, a);
+    uint64_t x = IMM ? (uint64_t)op->imm : e.registers[op->rs2];
+    switch (SIZE) {
+    case 1: *(uint8_t*)(e.mem + a) = (uint8_t)x;  break;
+    case 2: *(uint16_t*)(e.mem + a) = (uint16_t)x;  break;
+    case 4: *(uint32_t*)(e.mem + a) = (uint32_t)x;  break;
+    case 8: *(uint64_t*)(e.mem + a) = x;  break;
+    }
+    return op + 1;
+}
+
+// rd = address of memory operand
+static SEmuOp const * emuAddress(CEmulator & e, SEmuOp const * op) {
+    e.registers[op->rd] = e.registers[op->base] + (e.registers[op->index] << op->scale) + op->offset;
+    return op + 1;
+}
+
+// rd = temporary result if mask bit 0 is set, otherwise fallback
+static SEmuOp const * emuSelect(CEmulator & e, SEmuOp const * op) {
+    if (e.registers[op->mask] & 1) e.registers[op->rd] = e.registers[EMU_REG_TEMP];
+    else e.registers[op->rd] = e.registers[op->fallback] & dataMask[op->ot];
+    return op + 1;
+}
+
+// Address of vector memory operand. The index may be subtracted
+static inline uint64_t vectorAddress(CEmulator & e, SEmuOp const * op) {
+    uint64_t index = e.registers[op->index] << op->scale;
+    if (op->flags & EMU_FLAG_NEGATIVE) index = 0 - index;
+    return e.registers[op->base] + index + op->offset;
+}
+
+// Vector register rd = memory operand. MODE = EMU_VECTOR_LENGTH, EMU_VECTOR_BROADCAST, or EMU_VECTOR_SCALAR
+template <int MODE, bool SIMD>
+static SEmuOp const * emuVectorLoad(CEmulator & e, SEmuOp const * op) {
+    uint32_t size = elementSize[op->ot];
+    uint64_t len = size;
+    if (MODE != EMU_VECTOR_SCALAR) {
+        len = e.registers[op->length];
+        if (len > EMU_MAX_VECTOR_LENGTH) len = EMU_MAX_VECTOR_LENGTH;
+    }
+    uint64_t a = vectorAddress(e, op);
+    uint8_t * d = e.vectors[op->rd];
+    if (MODE == EMU_VECTOR_BROADCAST) {
+        if (a > e.memSize - size) return e.fault(ERR_EMU_MEMORY_ACCESS, op, a);
+        for (uint32_t i = 0; i < len; i += size) memcpy(d + i, e.mem + a, size);
+        memset(d + len, 0, EMU_MAX_VECTOR_LENGTH - (size_t)len);
+    }
+    else {
+        if (a > e.memSize - len) return e.fault(ERR_EMU_MEMORY_ACCESS, op, a);
+        vectorRead<SIMD>(d, e.mem + a, (uint32_t)len, a <= e.memSize - EMU_MAX_VECTOR_LENGTH);
+    }
+    e.vectorLength[op->rd] = (uint32_t)len;
+    return op + 1;
+}
+
+// Memory operand = vector register rs2. MODE = EMU_VECTOR_LENGTH or EMU_VECTOR_SCALAR
+template <int MODE, bool SIMD>
+static SEmuOp const * emuVectorStore(CEmulator & e, SEmuOp const * op) {
+    uint64_t len = elementSize[op->ot];
+    if (MODE == EMU_VECTOR_LENGTH) {
+        len = e.registers[op->length];
+        if (len > EMU_MAX_VECTOR_LENGTH) len = EMU_MAX_VECTOR_LENGTH;
+    }
+    uint64_t a = vectorAddress(e, op);
+    if (a - e.writeBegin > e.memSize - e.writeBegin - len) return e.fault(ERR_EMU_MEMORY_ACCESS, op, a);
+    vectorWrite<SIMD>(e.mem + a, e.vectors[op->rs2], (uint32_t)len, a <= e.memSize - EMU_MAX_VECTOR_LENGTH);
+    return op + 1;
+}
+
+// Vector register rd = F(rs1, rs2 or immediate), one element at a time. The length is
+// the length of rs1, or one element for move immediate. A partial last element is truncated
+template <typename T, typename F, bool IMM>
+static SEmuOp const * emuVectorLoop(CEmulator & e, SEmuOp const * op) {
+    uint32_t len = (F::move && IMM) ? (uint32_t)sizeof(T) : e.vectorLength[op->rs1];
+    T const * a = (T const *)e.vectors[op->rs1];
+    T const * b = (T const *)e.vectors[op->rs2];
+    T * d = (T *)e.vectors[op->rd];
+    T c;
+    memcpy(&c, &op->imm, sizeof(T));             // Immediate operand is in the low bytes of imm
+    uint32_t n = (len + (uint32_t)sizeof(T) - 1) / (uint32_t)sizeof(T);
+    for (uint32_t i = 0; i < n; i++) d[i] = F::calc(a[i], IMM ? c : b[i]);
+    memset((uint8_t *)d + len, 0, EMU_MAX_VECTOR_LENGTH - len);
+    e.vectorLength[op->rd] = len;
+    return op + 1;
+}
+
+#ifdef EMU_SIMD
+// Same as emuVectorLoop, with SIMD instructions. All SIMD registers of the vector are
+// calculated and masked by the length, so that the result is the same as with emuVectorLoop
+template <typename T, typename F, bool IMM>
+static SEmuOp const * emuVectorSimd(CEmulator & e, SEmuOp const * op) {
+    const uint32_t ot = elementType<T>();
+    uint32_t len = (F::move && IMM) ? (uint32_t)sizeof(T) : e.vectorLength[op->rs1];
+    uint8_t const * a = e.vectors[op->rs1];
+    uint8_t const * b = e.vectors[op->rs2];
+    uint8_t * d = e.vectors[op->rd];
+    EmuSimd c = simdBroadcast(IMM ? op->imm : 0, ot);
+    for (uint32_t k = 0; k < EMU_SIMD_NUM; k++) {
+        EmuSimd x = simdLoad(a + k * EMU_SIMD_SIZE);
+        EmuSimd y = IMM ? c : simdLoad(b + k * EMU_SIMD_SIZE);
+        simdStore(d + k * EMU_SIMD_SIZE, simdAnd(F::simd(x, y, ot), simdLengthMask(len, k)));
+    }
+    e.vectorLength[op->rd] = len;
+    return op + 1;
+}
+#endif
+
+static SEmuOp const * emuNop(CEmulator &, SEmuOp const * op) {
+    return op + 1;
+}
+
+// Arithmetic operation combined with conditional jump
+template <int BASE, int COND, bool IMM>
+static SEmuOp const * emuJumpCond(CEmulator & e, SEmuOp const * op) {
+    uint32_t ot = op->ot;
+    uint64_t m = dataMask[ot];
+    uint32_t bits = 8 << ot;
+    uint64_t a = e.registers[op->rs1];
+    uint64_t b = IMM ? (uint64_t)op->imm : e.registers[op->rs2];
+    uint64_t r = 0;
+    bool c = false;
+    switch (BASE) {
+    case EMU_ADD:
+        r = a + b;  break;
+    case EMU_SUB: case EMU_SUB_MAXLEN:
+        r = a - b;  break;
+    case EMU_AND:
+        r = a & b;  break;
+    case EMU_OR:
+        r = a | b;  break;
+    case EMU_XOR:
+        r = a ^ b;  break;
+    case EMU_SHL:
+        r = b < bits ? a << b : 0;  break;
+    case EMU_SHR_U:
+        r = b < bits ? (a & m) >> b : 0;  break;
+    case EMU_TEST_BIT:
+        r = b < bits ? (a >> b) & 1 : 0;  break;
+    case EMU_TEST:                               // zero if all bits indicated by b are 1 in a
+        r = ~a & b;  break;
+    case EMU_INCREMENT_COMPARE:
+        r = a + 1;  break;
+    case EMU_COMPARE:
+        r = a - b;  break;
+    }
+    switch (COND) {
+    case EMU_COND_ALWAYS:
+        c = true;  break;
+    case EMU_COND_ZERO:
+        c = (r & m) == 0;  break;
+    case EMU_COND_POS:
+        if (BASE == EMU_COMPARE) c = signExtend(a, ot) > signExtend(b, ot);
+        else if (BASE == EMU_INCREMENT_COMPARE) c = signExtend(r, ot) > signExtend(b, ot);
+        else c = signExtend(r, ot) > 0;
+        break;
+    case EMU_COND_NEG:
+        if (BASE == EMU_COMPARE) c = signExtend(a, ot) < signExtend(b, ot);
+        else c = signExtend(r, ot) < 0;
+        break;
+    case EMU_COND_OVERFLOW:
+        if (BASE == EMU_ADD) c = ((a ^ r) & (b ^ r)) >> (bits - 1) & 1;
+        else c = ((a ^ b) & (a ^ r)) >> (bits - 1) & 1;
+        break;
+    case EMU_COND_CARRY:
+        if (BASE == EMU_ADD) c = (r & m) < (a & m);
+        else c = (a & m) < (b & m);
+        break;
+    case EMU_COND_UABOVE:
+        c = (a & m) > (b & m);  break;
+    }
+    // Write result, except for compare and test
+    if (BASE != EMU_COMPARE && BASE != EMU_TEST_BIT && BASE != EMU_TEST) {
+        e.registers[op->rd] = r & m;
+    }
+    return c != (op->options != 0) ? op->target : op + 1;
+}
+
+// Two arithmetic operations in one. The second operation is op + 1, which is still
+// executed alone if a jump goes to it
+template <int OP1, bool IMM1, int OP2, bool IMM2>
+static SEmuOp const * emuPair(CEmulator & e, SEmuOp const * op) {
+    uint64_t b = IMM1 ? (uint64_t)op->imm : e.registers[op->rs2];
+    e.registers[op->rd] = emuCalc<OP1>(e.registers[op->rs1], b, op->ot, 0);
+    SEmuOp const * op2 = op + 1;
+    b = IMM2 ? (uint64_t)op2->imm : e.registers[op2->rs2];
+    e.registers[op2->rd] = emuCalc<OP2>(e.registers[op2->rs1], b, op2->ot, 0);
+    return op + 2;
+}
+
+// Compare r with zero. cond = EMU_COND_ZERO, EMU_COND_POS, or EMU_COND_NEG
+static inline bool compareZero(uint64_t r, uint32_t ot, uint32_t cond) {
+    switch (cond) {
+    case EMU_COND_ZERO:
+        return r == 0;
+    case EMU_COND_POS:
+        return signExtend(r, ot) > 0;
+    default:
+        return signExtend(r, ot) < 0;
+    }
+}
+
+// Arithmetic operation followed by compare of the result with zero and conditional jump in op + 1
+template <int OP, bool IMM, int COND>
+static SEmuOp const * emuArithJump(CEmulator & e, SEmuOp const * op) {
+    uint64_t b = IMM ? (uint64_t)op->imm : e.registers[op->rs2];
+    uint64_t r = emuCalc<OP>(e.registers[op->rs1], b, op->ot, 0);
+    e.registers[op->rd] = r;
+    SEmuOp const * jop = op + 1;
+    return compareZero(r, op->ot, COND) != (jop->options != 0) ? jop->target : op + 2;
+}
+
+// Two arithmetic operations followed by compare of the second result with zero and conditional
+// jump in op + 2. The condition is in op->options
+template <int OP1, bool IMM1, int OP2, bool IMM2>
+static SEmuOp const * emuPairJump(CEmulator & e, SEmuOp const * op) {
+    uint64_t b = IMM1 ? (uint64_t)op->imm : e.registers[op->rs2];
+    e.registers[op->rd] = emuCalc<OP1>(e.registers[op->rs1], b, op->ot, 0);
+    SEmuOp const * op2 = op + 1;
+    b = IMM2 ? (uint64_t)op2->imm : e.registers[op2->rs2];
+    uint64_t r = emuCalc<OP2>(e.registers[op2->rs1], b, op2->ot, 0);
+    e.registers[op2->rd] = r;
+    SEmuOp const * jop = op + 2;
+    return compareZero(r, op2->ot, op->options) != (jop->options != 0) ? jop->target : op + 3;
+}
+
+static SEmuOp const * emuJump(CEmulator &, SEmuOp const * op) {
+    return op->target;
+}
+
+static SEmuOp const * emuCall(CEmulator & e, SEmuOp const * op) {
+    if (e.callDepth >= EMU_CALL_STACK_SIZE) return e.fault(ERR_EMU_CALL_STACK, op, e.callDepth);
+    e.callStack[e.callDepth++] = op + 1;
+    return op->target;
+}
+
+// Jump to address in register rs1
+static SEmuOp const * emuJumpRegister(CEmulator & e, SEmuOp const * op) {
+    return e.jumpTo(e.registers[op->rs1], op);
+}
+
+// Call to address in register rs1
+static SEmuOp const * emuCallRegister(CEmulator & e, SEmuOp const * op) {
+    if (e.callDepth >= EMU_CALL_STACK_SIZE) return e.fault(ERR_EMU_CALL_STACK, op, e.callDepth);
+    e.callStack[e.callDepth++] = op + 1;
+    return e.jumpTo(e.registers[op->rs1], op);
+}
+
+// Return from function. Return from the entry function ends the program
+static SEmuOp const * emuReturn(CEmulator & e, SEmuOp const *) {
+    if (e.callDepth == 0) return 0;
+    return e.callStack[--e.callDepth];
+}
+
+// Instruction that cannot be emulated. imm contains the first word of the instruction
+static SEmuOp const * emuUnsupported(CEmulator & e, SEmuOp const * op) {
+    return e.fault(ERR_EMU_UNKNOWN_INSTRUCTION, op, (uint64_t)op->imm);
+}
+
+// Placed after the last instruction of each code section
+static SEmuOp const * emuEndOfCode(CEmulator & e, SEmuOp const * op) {
+    return e.fault(ERR_EMU_END_OF_CODE, op, op->address);
+}
+
+// Jump target that is not the beginning of an instruction. offset contains the target address
+static SEmuOp const * emuBadTarget(CEmulator & e, SEmuOp const * op) {
+    return e.fault(ERR_EMU_JUMP_TARGET, op, (uint64_t)op->offset);
+}
+
+
+/*****************************************************************************
+Selection of handlers during predecoding
+*****************************************************************************/
+
+// Handler for arithmetic operation. Returns 0 if not supported
+static EmuHandler arithmeticHandler(uint32_t id, bool imm) {
+#define EMU_ARITH_CASE(OP) case OP: return imm ? emuArith<OP, true> : emuArith<OP, false>
+    switch (id) {
+    EMU_ARITH_CASE(EMU_MOVE);
+    EMU_ARITH_CASE(EMU_SIGN_EXTEND);
+    EMU_ARITH_CASE(EMU_COMPARE);
+    EMU_ARITH_CASE(EMU_ADD);
+    EMU_ARITH_CASE(EMU_SUB);
+    EMU_ARITH_CASE(EMU_SUB_REV);
+    EMU_ARITH_CASE(EMU_MUL);
+    EMU_ARITH_CASE(EMU_MUL_HI);
+    EMU_ARITH_CASE(EMU_MUL_HI_U);
+    EMU_ARITH_CASE(EMU_DIV);
+    EMU_ARITH_CASE(EMU_DIV_U);
+    EMU_ARITH_CASE(EMU_DIV_REV);
+    EMU_ARITH_CASE(EMU_REM);
+    EMU_ARITH_CASE(EMU_REM_U);
+    EMU_ARITH_CASE(EMU_MIN);
+    EMU_ARITH_CASE(EMU_MIN_U);
+    EMU_ARITH_CASE(EMU_MAX);
+    EMU_ARITH_CASE(EMU_MAX_U);
+    EMU_ARITH_CASE(EMU_AND);
+    EMU_ARITH_CASE(EMU_AND_NOT);
+    EMU_ARITH_CASE(EMU_OR);
+    EMU_ARITH_CASE(EMU_XOR);
+    EMU_ARITH_CASE(EMU_SHL);
+    EMU_ARITH_CASE(EMU_ROTATE);
+    EMU_ARITH_CASE(EMU_SHR_S);
+    EMU_ARITH_CASE(EMU_SHR_U);
+    EMU_ARITH_CASE(EMU_SET_BIT);
+    EMU_ARITH_CASE(EMU_CLEAR_BIT);
+    EMU_ARITH_CASE(EMU_TOGGLE_BIT);
+    EMU_ARITH_CASE(EMU_TEST_BIT);
+    EMU_ARITH_CASE(EMU_INSERT_HI);
+    }
+#undef EMU_ARITH_CASE
+    return 0;
+}
+
+// Handler for combined arithmetic and conditional jump. Returns 0 if not supported
+static EmuHandler jumpHandler(uint32_t base, uint32_t cond, bool imm) {
+#define EMU_JUMP_CASE(B, C) case B << 8 | C: return imm ? emuJumpCond<B, C, true> : emuJumpCond<B, C, false>
+    switch (base << 8 | cond) {
+    EMU_JUMP_CASE(EMU_SUB, EMU_COND_ALWAYS);
+    EMU_JUMP_CASE(EMU_SUB, EMU_COND_ZERO);
+    EMU_JUMP_CASE(EMU_SUB, EMU_COND_POS);
+    EMU_JUMP_CASE(EMU_SUB, EMU_COND_NEG);
+    EMU_JUMP_CASE(EMU_SUB, EMU_COND_OVERFLOW);
+    EMU_JUMP_CASE(EMU_SUB, EMU_COND_CARRY);
+    EMU_JUMP_CASE(EMU_ADD, EMU_COND_ALWAYS);
+    EMU_JUMP_CASE(EMU_ADD, EMU_COND_ZERO);
+    EMU_JUMP_CASE(EMU_ADD, EMU_COND_POS);
+    EMU_JUMP_CASE(EMU_ADD, EMU_COND_NEG);
+    EMU_JUMP_CASE(EMU_ADD, EMU_COND_OVERFLOW);
+    EMU_JUMP_CASE(EMU_ADD, EMU_COND_CARRY);
+    EMU_JUMP_CASE(EMU_AND, EMU_COND_ZERO);
+    EMU_JUMP_CASE(EMU_OR, EMU_COND_ZERO);
+    EMU_JUMP_CASE(EMU_XOR, EMU_COND_ZERO);
+    EMU_JUMP_CASE(EMU_SHL, EMU_COND_ZERO);
+    EMU_JUMP_CASE(EMU_SHR_U, EMU_COND_ZERO);
+    EMU_JUMP_CASE(EMU_TEST_BIT, EMU_COND_ZERO);
+    EMU_JUMP_CASE(EMU_TEST, EMU_COND_ZERO);
+    EMU_JUMP_CASE(EMU_INCREMENT_COMPARE, EMU_COND_POS);
+    EMU_JUMP_CASE(EMU_SUB_MAXLEN, EMU_COND_POS);
+    EMU_JUMP_CASE(EMU_COMPARE, EMU_COND_ZERO);
+    EMU_JUMP_CASE(EMU_COMPARE, EMU_COND_POS);
+    EMU_JUMP_CASE(EMU_COMPARE, EMU_COND_NEG);
+    EMU_JUMP_CASE(EMU_COMPARE, EMU_COND_CARRY);
+    EMU_JUMP_CASE(EMU_COMPARE, EMU_COND_UABOVE);
+    }
+#undef EMU_JUMP_CASE
+    return 0;
+}
+
+// Operations that can be combined with emuPair and emuArithJump
+static const uint32_t fusedOperations[] = {EMU_MOVE, EMU_ADD, EMU_SUB, EMU_AND, EMU_OR, EMU_XOR};
+
+// Find operation with handler h in fusedOperations. Returns 0 if not found
+static uint32_t fusedOperation(EmuHandler h, bool & imm) {
+    for (uint32_t i = 0; i < sizeof(fusedOperations) / sizeof(fusedOperations[0]); i++) {
+        uint32_t id = fusedOperations[i];
+        imm = h == arithmeticHandler(id, true);
+        if (imm || h == arithmeticHandler(id, false)) return id;
+    }
+    return 0;
+}
+
+#define EMU_FUSED_SWITCH(ID, IMM, CASE) \
+    switch (ID) { \
+    case EMU_MOVE: return IMM ? CASE(EMU_MOVE, true) : CASE(EMU_MOVE, false); \
+    case EMU_ADD:  return IMM ? CASE(EMU_ADD, true)  : CASE(EMU_ADD, false); \
+    case EMU_SUB:  return IMM ? CASE(EMU_SUB, true)  : CASE(EMU_SUB, false); \
+    case EMU_AND:  return IMM ? CASE(EMU_AND, true)  : CASE(EMU_AND, false); \
+    case EMU_OR:   return IMM ? CASE(EMU_OR, true)   : CASE(EMU_OR, false); \
+    case EMU_XOR:  return IMM ? CASE(EMU_XOR, true)  : CASE(EMU_XOR, false); \
+    }
+
+// Handler for two operations from fusedOperations
+template <int OP1, bool IMM1>
+static EmuHandler pairHandler2(uint32_t id2, bool imm2) {
+#define EMU_PAIR_CASE(OP2, IMM2) emuPair<OP1, IMM1, OP2, IMM2>
+    EMU_FUSED_SWITCH(id2, imm2, EMU_PAIR_CASE)
+#undef EMU_PAIR_CASE
+    return 0;
+}
+
+static EmuHandler pairHandler(uint32_t id1, bool imm1, uint32_t id2, bool imm2) {
+#define EMU_PAIR_CASE(OP1, IMM1) pairHandler2<OP1, IMM1>(id2, imm2)
+    EMU_FUSED_SWITCH(id1, imm1, EMU_PAIR_CASE)
+#undef EMU_PAIR_CASE
+    return 0;
+}
+
+// Handler for two operations from fusedOperations followed by compare with zero and jump
+template <int OP1, bool IMM1>
+static EmuHandler pairJumpHandler2(uint32_t id2, bool imm2) {
+#define EMU_PAIR_JUMP_CASE(OP2, IMM2) emuPairJump<OP1, IMM1, OP2, IMM2>
+    EMU_FUSED_SWITCH(id2, imm2, EMU_PAIR_JUMP_CASE)
+#undef EMU_PAIR_JUMP_CASE
+    return 0;
+}
+
+static EmuHandler pairJumpHandler(uint32_t id1, bool imm1, uint32_t id2, bool imm2) {
+#define EMU_PAIR_JUMP_CASE(OP1, IMM1) pairJumpHandler2<OP1, IMM1>(id2, imm2)
+    EMU_FUSED_SWITCH(id1, imm1, EMU_PAIR_JUMP_CASE)
+#undef EMU_PAIR_JUMP_CASE
+    return 0;
+}
+
+// Handler for operation from fusedOperations followed by compare with zero and jump
+template <int COND>
+static EmuHandler arithJumpHandler2(uint32_t id, bool imm) {
+#define EMU_ARITH_JUMP_CASE(OP, IMM) emuArithJump<OP, IMM, COND>
+    EMU_FUSED_SWITCH(id, imm, EMU_ARITH_JUMP_CASE)
+#undef EMU_ARITH_JUMP_CASE
+    return 0;
+}
+
+static EmuHandler arithJumpHandler(uint32_t id, bool imm, uint32_t cond) {
+    switch (cond) {
+    case EMU_COND_ZERO: return arithJumpHandler2<EMU_COND_ZERO>(id, imm);
+    case EMU_COND_POS:  return arithJumpHandler2<EMU_COND_POS>(id, imm);
+    case EMU_COND_NEG:  return arithJumpHandler2<EMU_COND_NEG>(id, imm);
+    }
+    return 0;
+}
+#undef EMU_FUSED_SWITCH
+
+// Condition of compare with zero and conditional jump. Returns 0 if op is not such a jump,
+// or if it does not use the result in register r with operand type ot
+static uint32_t zeroJumpCondition(SEmuOp const & op, uint32_t r, uint32_t ot) {
+    if (op.rs1 != r || op.imm != 0 || op.ot != ot) return 0;
+    static const uint32_t conditions[] = {EMU_COND_ZERO, EMU_COND_POS, EMU_COND_NEG};
+    for (uint32_t i = 0; i < 3; i++) {
+        if (op.handler == jumpHandler(EMU_COMPARE, conditions[i], true)) return conditions[i];
+    }
+    return 0;
+}
+
+// Handler for memory read or write with operand type ot
+static EmuHandler loadHandler(uint32_t ot, bool limit) {
+    switch (ot) {
+    case 0:  return limit ? emuLoad<1, true> : emuLoad<1, false>;
+    case 1:  return limit ? emuLoad<2, true> : emuLoad<2, false>;
+    case 2:  return limit ? emuLoad<4, true> : emuLoad<4, false>;
+    default: return limit ? emuLoad<8, true> : emuLoad<8, false>;
+    }
+}
+
+static EmuHandler storeHandler(uint32_t ot, bool imm, bool limit) {
+    switch (ot) {
+    case 0:  return imm ? (limit ? emuStore<1, true, true> : emuStore<1, true, false>) : (limit ? emuStore<1, false, true> : emuStore<1, false, false>);
+    case 1:  return imm ? (limit ? emuStore<2, true, true> : emuStore<2, true, false>) : (limit ? emuStore<2, false, true> : emuStore<2, false, false>);
+    case 2:  return imm ? (limit ? emuStore<4, true, true> : emuStore<4, true, false>) : (limit ? emuStore<4, false, true> : emuStore<4, false, false>);
+    default: return imm ? (limit ? emuStore<8, true, true> : emuStore<8, true, false>) : (limit ? emuStore<8, false, true> : emuStore<8, false, false>);
+    }
+}
+
+// Kernel for vector operation F with element type T
+template <typename F, typename T>
+static EmuHandler vectorKernel(bool imm, bool simd) {
+#ifdef EMU_SIMD
+    if (simd) return imm ? emuVectorSimd<T, F, true> : emuVectorSimd<T, F, false>;
+#endif
+    return imm ? emuVectorLoop<T, F, true> : emuVectorLoop<T, F, false>;
+}
+
+// Handler for vector operation F with operand type ot. Returns 0 if not supported
+template <typename F>
+static EmuHandler vectorOperation(uint32_t ot, bool imm, bool simd) {
+    if (!(F::types >> ot & 1)) return 0;
+    simd = simd && (F::simdTypes >> ot & 1);     // Use loop if there is no SIMD kernel
+    switch (ot) {
+    case 0:  return vectorKernel<F, typename F::T0>(imm, simd);
+    case 1:  return vectorKernel<F, typename F::T1>(imm, simd);
+    case 2:  return vectorKernel<F, typename F::T2>(imm, simd);
+    case 3:  return vectorKernel<F, typename F::T3>(imm, simd);
+    case 5:  return vectorKernel<F, typename F::T5>(imm, simd);
+    default: return vectorKernel<F, typename F::T6>(imm, simd);
+    }
+}
+
+// Handler for vector operation. Returns 0 if not supported
+static EmuHandler vectorHandler(uint32_t id, uint32_t ot, bool imm, bool simd) {
+    switch (id) {
+    case EMU_MOVE:    return vectorOperation<EmuVectorMove>(ot, imm, simd);
+    case EMU_ADD:     return vectorOperation<EmuVectorAdd>(ot, imm, simd);
+    case EMU_SUB:     return vectorOperation<EmuVectorSub>(ot, imm, simd);
+    case EMU_SUB_REV: return vectorOperation<EmuVectorSubRev>(ot, imm, simd);
+    case EMU_MUL:     return vectorOperation<EmuVectorMul>(ot, imm, simd);
+    case EMU_DIV:     return vectorOperation<EmuVectorDiv>(ot, imm, simd);
+    case EMU_MIN:     return vectorOperation<EmuVectorMin>(ot, imm, simd);
+    case EMU_MAX:     return vectorOperation<EmuVectorMax>(ot, imm, simd);
+    case EMU_AND:     return vectorOperation<EmuVectorAnd>(ot, imm, simd);
+    case EMU_AND_NOT: return vectorOperation<EmuVectorAndNot>(ot, imm, simd);
+    case EMU_OR:      return vectorOperation<EmuVectorOr>(ot, imm, simd);
+    case EMU_XOR:     return vectorOperation<EmuVectorXor>(ot, imm, simd);
+    }
+    return 0;
+}
+
+// Handler for vector memory read or write. mode = EMU_VECTOR_LENGTH, EMU_VECTOR_BROADCAST, or EMU_VECTOR_SCALAR
+static EmuHandler vectorLoadHandler(int mode, bool simd) {
+    switch (mode) {
+    case EMU_VECTOR_LENGTH:    return simd ? emuVectorLoad<EMU_VECTOR_LENGTH, true> : emuVectorLoad<EMU_VECTOR_LENGTH, false>;
+    case EMU_VECTOR_BROADCAST: return emuVectorLoad<EMU_VECTOR_BROADCAST, false>;
+    default:                   return simd ? emuVectorLoad<EMU_VECTOR_SCALAR, true> : emuVectorLoad<EMU_VECTOR_SCALAR, false>;
+    }
+}
+
+static EmuHandler vectorStoreHandler(int mode, bool simd) {
+    switch (mode) {
+    case EMU_VECTOR_LENGTH:    return simd ? emuVectorStore<EMU_VECTOR_LENGTH, true> : emuVectorStore<EMU_VECTOR_LENGTH, false>;
+    case EMU_VECTOR_SCALAR:    return simd ? emuVectorStore<EMU_VECTOR_SCALAR, true> : emuVectorStore<EMU_VECTOR_SCALAR, false>;
+    default:                   return 0;     // Broadcast is not possible for destination
+    }
+}
+
+// Select a register from template. i = 5: RT, 6: RS, 7: RU, 8: RD (same as in disasm2.cpp)
+static uint8_t getRegister(const STemplate * pInstr, int i) {
+    uint8_t r = 0xFF;
+    switch (i) {
+    case 5: r = pInstr->a.rt;  break;
+    case 6: r = pInstr->a.rs;  break;
+    case 7: r = pInstr->a.ru;  break;
+    case 8: r = pInstr->a.rd;  break;
+    }
+    return r;
+}
+
+// Make micro-operation with no operands
+static SEmuOp newOp(uint32_t address, uint32_t ot) {
+    SEmuOp op;
+    memset(&op, 0, sizeof(op));
+    op.address = address;
+    op.ot = (uint8_t)ot;
+    op.rd = op.rs1 = op.rs2 = op.base = op.index = op.mask = op.fallback = op.length = EMU_REG_ZERO;
+    return op;
+}
+
+
+/*****************************************************************************
+Members of class CEmulator
+*****************************************************************************/
+
+CEmulator::CEmulator() {
+    // Constructor
+    memset(registers, 0, sizeof(registers));
+    memset(vectors, 0, sizeof(vectors));
+    memset(vectorLength, 0, sizeof(vectorLength));
+#ifdef EMU_SIMD
+    simd = (cmd.emulateOptions & CMDL_EMU_SCALAR) == 0;
+#else
+    simd = false;
+#endif
+    mem = 0;
+    memSize = writeBegin = 0;
+    callStack = 0;
+    callDepth = 0;
+    ipSize = datapBase = threadpBase = 0;
+    faultError = faultAddress = 0;
+    faultValue = 0;
+    opCount = 0;
+    address = instrLength = operandType = format = 0;
+    variant = 0;
+    pInstr = 0;
+    iRecord = 0;
+    fInstr = 0;
+}
+
+void CEmulator::go() {
+    // Check file type
+    if (fileType != FILETYPE_ELF || !executable || machineType != EM_FORWARDCOM) {
+        err.submit(ERR_EMU_FILE_TYPE, fileName);
+        return;
+    }
+    // Check code integrity
+    checkFormatListIntegrity();
+
+    // Read instruction list
+    initializeInstructionList();
+
+    // Split ELF file into containers
+    split();
+    if (err.number()) return;
+
+    // Make memory image
+    loadProgram();
+    if (err.number()) return;
+
+    // Translate code into micro-operations
+    predecode();
+    if (err.number()) return;
+
+    // Execute
+    run();
+}
+
+void CEmulator::initializeInstructionList() {
+    // Read and initialize instruction list and sort it by category, format, and op1
+    if (cmd.instructionListFile == 0) {
+        // No instruction list file specified. Use built-in list, which is already sorted
+        instructionlist.pushBig((SInstruction2 const*)builtinInstructionsByFormat, builtinInstructionsNum * (uint32_t)sizeof(SInstruction2));
+        return;
+    }
+    CCSVFile instructionListFile(cmd.instructionListFile); // Filename of list of instructions
+    instructionListFile.parse();                 // Read and interpret instruction list file
+    instructionlist << instructionListFile.instructionlist; // Transfer instruction list to my own container
+    instructionlist.sort();                      // Sort list, using sort order defined by SInstruction2
+}
+
+// Make memory image from program headers
+void CEmulator::loadProgram() {
+    uint32_t ph;                                 // Program header index
+    uint64_t end = 0;                            // End of last group
+    bool hasIP = false;                          // IP group found
+    writeBegin = 0;
+    for (ph = 0; ph < programHeaders.numEntries(); ph++) {
+        Elf64_Phdr const & pHeader = programHeaders[ph];
+        if (pHeader.p_type != PT_LOAD) continue;
+        if (pHeader.p_vaddr + pHeader.p_memsz > end) end = pHeader.p_vaddr + pHeader.p_memsz;
+        if (pHeader.p_flags & SHF_IP) {
+            if (pHeader.p_vaddr != 0) err.submit(ERR_EMU_FILE_TYPE, fileName);
+            ipSize = pHeader.p_memsz;
+            hasIP = true;
+        }
+        else {
+            if (pHeader.p_flags & SHF_DATAP) datapBase = pHeader.p_vaddr;
+            if (pHeader.p_flags & SHF_THREADP) threadpBase = pHeader.p_vaddr;
+            if (writeBegin == 0 || pHeader.p_vaddr < writeBegin) writeBegin = pHeader.p_vaddr;
+        }
+    }
+    if (!hasIP || end > 0xFFFFFFFF - EMU_STACK_SIZE) {
+        err.submit(ERR_EMU_FILE_TYPE, fileName);
+        return;
+    }
+    // The stack follows the last group
+    end = (end + 15) & -(int64_t)16;
+    if (writeBegin == 0 || writeBegin < ipSize) writeBegin = end;
+    memSize = end + EMU_STACK_SIZE;
+    memory.setSize(memSize);                     // Zero-filled
+    mem = memory.buf();
+
+    // Copy initialized data
+    for (ph = 0; ph < programHeaders.numEntries(); ph++) {
+        Elf64_Phdr const & pHeader = programHeaders[ph];
+        if (pHeader.p_type != PT_LOAD || pHeader.p_filesz == 0) continue;
+        if (pHeader.p_filesz > pHeader.p_memsz || pHeader.p_offset + pHeader.p_filesz > dataBuffer.dataSize()) {
+            err.submit(ERR_ELF_INDEX_RANGE);
+            return;
+        }
+        memcpy(mem + pHeader.p_vaddr, dataBuffer.buf() + pHeader.p_offset, (size_t)pHeader.p_filesz);
+    }
+
+    // Initialize registers
+    registers[EMU_REG_THREADP] = threadpBase;
+    registers[EMU_REG_DATAP] = datapBase;
+    registers[31] = memSize;                     // Stack pointer
+    callStackBuffer.setNum(EMU_CALL_STACK_SIZE);
+    callStack = &callStackBuffer[0];
+}
+
+// Translate all code sections into micro-operations
+void CEmulator::predecode() {
+    codeMap.setNum((uint32_t)((ipSize + 3) >> 2));
+    for (uint32_t sc = 0; sc < sectionHeaders.numEntries(); sc++) {
+        Elf64_Shdr const & sHeader = sectionHeaders[sc];
+        if ((sHeader.sh_flags & (SHF_EXEC | SHF_IP)) != (SHF_EXEC | SHF_IP) || sHeader.sh_type == SHT_NOBITS) continue;
+        if (sHeader.sh_addr + sHeader.sh_size > ipSize || (sHeader.sh_addr & 3)) {
+            err.submit(ERR_ELF_INDEX_RANGE);
+            return;
+        }
+        uint32_t sectionEnd = (uint32_t)(sHeader.sh_addr + sHeader.sh_size);
+        for (address = (uint32_t)sHeader.sh_addr; address + 4 <= sectionEnd; ) {
+            pInstr = (STemplate const *)(mem + address);
+            instrLength = lengthList[pInstr->i[0] >> 29];
+            codeMap[address >> 2] = (uint32_t)ops.numEntries() + 1;
+            if (address + instrLength * 4 > sectionEnd) {
+                emitUnsupported();               // Instruction crosses end of section
+                break;
+            }
+            decodeInstruction();
+            address += instrLength * 4;
+        }
+        // Stop if execution continues past the end of the section
+        SEmuOp op = newOp(sectionEnd, 0);
+        op.handler = emuEndOfCode;
+        ops.push(op);
+    }
+    resolveTargets();
+    if (!(cmd.emulateOptions & CMDL_EMU_NOFUSE)) fuseOperations();
+}
+
+// Translate instruction at address
+void CEmulator::decodeInstruction() {
+    // Get format. Same method as in CDisassembler::parseInstruction
+    format = (pInstr->a.il << 8) + (pInstr->a.mode << 4);
+    if ((format & 0xFEF) == 0x160) {
+        // Tiny instruction pair
+        decodeTiny(pInstr->t.tiny1);
+        decodeTiny(pInstr->t.tiny2);
+        return;
+    }
+    fInstr = &formatList[lookupFormat(pInstr->q)];
+    format = fInstr->format2;                    // Include subformat depending on op1
+    if (fInstr->tmpl == 0xE && pInstr->a.op2) {
+        // Single format instruction if op2 != 0
+        formCopy = *fInstr;
+        formCopy.cat = 1;
+        fInstr = &formCopy;
+    }
+    // Get operand type
+    if (fInstr->ot == 0) {                       // Operand type determined by OT field
+        operandType = pInstr->a.ot;
+        if (!(pInstr->a.mode & 6) && !(fInstr->vect & 0x10)) {
+            format |= (operandType & 4) << 5;    // Add M bit to format
+            operandType &= ~4;                   // Remove M bit from operand type
+        }
+    }
+    else if ((fInstr->ot & 0xF0) == 0x10) operandType = fInstr->ot & 7;
+    else if (fInstr->ot == 0x32) operandType = 2 + (pInstr->a.op1 & 1);
+    else if (fInstr->ot == 0x35) operandType = 5 + (pInstr->a.op1 & 1);
+    else operandType = 0;
+
+    // Find instruction in instruction list. Same method as in CDisassembler::writeInstruction
+    SInstruction2 iRecSearch;
+    iRecSearch.format = format;
+    iRecSearch.category = fInstr->cat;
+    iRecSearch.op1 = pInstr->a.op1;
+    if (iRecSearch.category == 4) {
+        if (fInstr->imm2 & 0x80) iRecSearch.op1 = pInstr->b[0]; // opj in IM1
+        if (fInstr->tmpl == 0xD) iRecSearch.op1 &= 0xF8;
+    }
+    if (instrLength > 1 && fInstr->tmpl == 0xE) iRecSearch.op2 = pInstr->a.op2;
+    else iRecSearch.op2 = 0;
+
+    uint64_t index;
+    uint32_t n, i;
+    n = instructionlist.findAll(&index, iRecSearch);
+    for (i = 0; i < n; i++) {
+        SInstruction2 const & rec = instructionlist[index + i];
+        bool otFits, formatFits = true;
+        if (operandType < 4 && !(fInstr->vect & 1)) otFits = (rec.optypesgp & (0x101 << operandType)) != 0;
+        else otFits = ((rec.optypesscalar | rec.optypesvector) & (0x101 << operandType)) != 0;
+        if (fInstr->cat >= 3) formatFits = (rec.format & ((uint64_t)1 << fInstr->formatIndex)) != 0;
+        if (otFits && formatFits) break;
+    }
+    if (i >= n) {
+        emitUnsupported();
+        return;
+    }
+    iRecord = &instructionlist[index + i];
+
+    // Template C or D has no OT field. Get operand type from instruction list
+    if ((iRecord->templt & 0xFE) == 0xC) {
+        uint32_t optypes = fInstr->vect ? iRecord->optypesscalar | iRecord->optypesvector : iRecord->optypesgp;
+        for (i = 0; i < 16; i++) {
+            if (optypes & (1 << i)) break;
+        }
+        operandType = i & 7;
+    }
+    variant = interpretTemplateVariants(iRecord->template_variant);
+
+    // General purpose registers are supported with integer operands. Vector registers are
+    // supported with integer operands up to 64 bits, float, and double
+    if ((fInstr->vect & 1) ? (operandType == 4 || operandType == 7 || fInstr->cat == 4) : operandType >= 4) {
+        emitUnsupported();
+        return;
+    }
+    if (fInstr->cat == 4) decodeJump();
+    else decodeNormal();
+}
+
+// Translate normal instruction
+void CEmulator::decodeNormal() {
+    SEmuOp op = newOp(address, operandType);
+    uint32_t id = iRecord->id;
+    bool vector = (fInstr->vect & 1) != 0;       // Uses vector registers
+    if (variant & VARIANT_D0) {
+        if (id == 0x30000 || id == 0x30200 || id == 0x30300) { // nop, nop2, nop3
+            op.handler = emuNop;
+            ops.push(op);
+        }
+        else emitUnsupported();
+        return;
+    }
+    if (variant & (VARIANT_D1 | VARIANT_SPECD)) {
+        emitUnsupported();
+        return;
+    }
+    if (vector && (variant & (VARIANT_D2 | VARIANT_R0 | VARIANT_R123 | VARIANT_RL | VARIANT_H0 | VARIANT_SPECS))) {
+        emitUnsupported();                       // Mix of vector and general purpose registers
+        return;
+    }
+
+    // Select source operands. Same method as in CDisassembler::writeNormalInstruction:
+    // Select nOp operands in the order of priority: immediate, memory, RT, RS, RU, RD.
+    // The selected operands are used in the reverse order
+    int nOp = (int)iRecord->sourceoperands;      // Number of source operands
+    uint8_t opAvail = fInstr->opAvail;           // Bit index of available operands
+    if (fInstr->cat != 3) {                      // Immediate operand determined by instruction table
+        if (iRecord->opimmediate) opAvail |= 1;
+        else opAvail &= ~1;
+    }
+    if (variant & VARIANT_M0) opAvail &= ~2;     // Memory operand is destination
+    if ((variant & VARIANT_M1) && fInstr->tmpl == 0xE && nOp > 1 && (opAvail & 2)) {
+        opAvail |= 1;                            // IM3 is an immediate operand
+    }
+    uint8_t operands[4] = {0,0,0,0};             // 0=none, 1=immediate, 2=memory, 5=RT, 6=RS, 7=RU, 8=RD
+    uint32_t a = 0;                              // Index to opAvail
+    int      j = nOp - 1;                        // Index into operands
+    uint8_t fallback;                            // Fallback register
+    while (j >= 0 && a < 8) {
+        if (opAvail & (1 << a)) {
+            opAvail &= ~(1 << a);
+            operands[j--] = a + 1;
+        }
+        a++;
+    }
+    if      (opAvail & (1 << 4)) fallback = 5;   // RT
+    else if (opAvail & (1 << 5)) fallback = 6;   // RS
+    else if (opAvail & (1 << 6)) fallback = 7;   // RU
+    else if ((opAvail & (1 << 7)) && (variant & VARIANT_M0)) fallback = 8;  // RD if not used for destination
+    else if (operands[0] > 2) fallback = operands[0];  // First source register operand
+    else fallback = 0x1F;                        // Zero
+
+    bool masked = (fInstr->tmpl == 0xA || fInstr->tmpl == 0xE) && pInstr->a.mask != 7;
+    bool store = (variant & VARIANT_M0) != 0;
+    bool immediate = false;                      // Has immediate operand
+    bool memory = false;                         // Has memory source operand
+    bool limit = false;                          // Memory operand has limit on index
+    uint8_t src[4] = {EMU_REG_ZERO, EMU_REG_ZERO, EMU_REG_ZERO, EMU_REG_ZERO}; // Source registers
+    if (nOp < 1 || nOp > 2 || (store && (masked || id != EMU_STORE)) || (vector && masked)) {
+        emitUnsupported();
+        return;
+    }
+    for (j = 0; j < nOp; j++) {
+        switch (operands[j]) {
+        case 1:                                  // Immediate operand
+            if (!decodeImmediate(op.imm)) {
+                emitUnsupported();
+                return;
+            }
+            immediate = true;
+            break;
+        case 2:                                  // Memory operand
+            memory = true;
+            src[j] = vector ? EMU_VECTOR_TEMP : EMU_REG_TEMP;
+            break;
+        default:                                 // Register operand
+            src[j] = vector ? getRegister(pInstr, operands[j]) : sourceRegister(getRegister(pInstr, operands[j]));
+            if (src[j] == 0xFF) {
+                emitUnsupported();
+                return;
+            }
+        }
+    }
+    // Options in IM3 are supported only for compare
+    if ((variant & VARIANT_On) && fInstr->tmpl == 0xE && (fInstr->imm2 & 2) && pInstr->a.im3
+    && !((variant & VARIANT_M1) && (fInstr->opAvail & 2))) {
+        if (id == EMU_COMPARE && !vector) op.options = pInstr->a.im3 & 0xF;
+        else {
+            emitUnsupported();
+            return;
+        }
+    }
+    // Memory operand
+    SEmuOp mop = op;
+    if (memory || store || id == EMU_ADDRESS) {
+        if (!decodeMemoryOperand(mop, limit) || (limit && store && immediate) || (limit && vector)) {
+            emitUnsupported();
+            return;
+        }
+    }
+    if (vector) {
+        decodeVector(op, mop, src, nOp, immediate, memory, store);
+        return;
+    }
+    if (store) {
+        mop.rs2 = src[0];
+        mop.handler = storeHandler(operandType, immediate, limit);
+        ops.push(mop);
+        return;
+    }
+    if (id == EMU_ADDRESS) {
+        if (masked) {
+            emitUnsupported();
+            return;
+        }
+        mop.rd = pInstr->a.rd;
+        mop.handler = emuAddress;
+        ops.push(mop);
+        return;
+    }
+    // Arithmetic operation
+    op.handler = arithmeticHandler(id, immediate);
+    if (op.handler == 0) {
+        emitUnsupported();
+        return;
+    }
+    if (nOp == 1) op.rs2 = src[0];
+    else {
+        op.rs1 = src[0];
+        op.rs2 = src[1];
+    }
+    op.rd = masked ? EMU_REG_TEMP : pInstr->a.rd;
+    if (memory) {                                // Load memory operand into temporary register
+        mop.rd = EMU_REG_TEMP;
+        mop.handler = loadHandler(operandType, limit);
+        ops.push(mop);
+    }
+    ops.push(op);
+    if (masked) {                                // Select result or fallback
+        SEmuOp sel = newOp(address, operandType);
+        sel.rd = pInstr->a.rd;
+        sel.mask = pInstr->a.mask;
+        uint8_t fallbackReg = getRegister(pInstr, fallback);
+        if ((fallbackReg & 0x1F) != 0x1F) sel.fallback = fallbackReg;
+        sel.handler = emuSelect;
+        ops.push(sel);
+    }
+}
+
+// Translate vector instruction. op has the operation and mop has the memory operand, if any
+void CEmulator::decodeVector(SEmuOp & op, SEmuOp & mop, uint8_t const * src, int nOp, bool immediate, bool memory, bool store) {
+    uint32_t id = iRecord->id;
+    int mode = EMU_VECTOR_SCALAR;                // Vector length of memory operand
+    if (mop.length != EMU_REG_ZERO) mode = (fInstr->vect & 2) ? EMU_VECTOR_LENGTH : EMU_VECTOR_BROADCAST;
+    if (store) {
+        mop.rs2 = src[0];
+        mop.handler = immediate ? 0 : vectorStoreHandler(mode, simd);
+        if (mop.handler == 0) {
+            emitUnsupported();
+            return;
+        }
+        ops.push(mop);
+        return;
+    }
+    if (memory && id == EMU_MOVE && nOp == 1) {
+        mop.rd = pInstr->a.rd;                   // Read memory operand directly into destination
+        mop.handler = vectorLoadHandler(mode, simd);
+        ops.push(mop);
+        return;
+    }
+    op.handler = vectorHandler(id, operandType, immediate, simd);
+    if (op.handler == 0) {
+        emitUnsupported();
+        return;
+    }
+    // The length of the result is the length of rs1
+    if (nOp == 1) op.rs1 = op.rs2 = src[0];
+    else {
+        op.rs1 = src[0];
+        op.rs2 = src[1];
+    }
+    op.rd = pInstr->a.rd;
+    if (memory) {                                // Read memory operand into temporary vector
+        mop.rd = EMU_VECTOR_TEMP;
+        mop.handler = vectorLoadHandler(mode, simd);
+        ops.push(mop);
+    }
+    ops.push(op);
+}
+
+// Translate jump, call, or return instruction
+void CEmulator::decodeJump() {
+    SEmuOp op = newOp(address, operandType);
+    uint32_t id = iRecord->id;
+    if (!(fInstr->mem & 0x80)) {
+        // Not a self-relative jump
+        if (id == EMU_RETURN) {
+            op.handler = emuReturn;
+            ops.push(op);
+            return;
+        }
+        if ((id == EMU_JUMP || id == EMU_CALL) && iRecord->sourceoperands == 1) {
+            bool call = id == EMU_CALL;
+            if (iRecord->opimmediate) {
+                // Absolute address
+                if (!decodeImmediate(op.offset)) {
+                    emitUnsupported();
+                    return;
+                }
+                op.flags = EMU_FLAG_TARGET;
+                op.handler = call ? emuCall : emuJump;
+                ops.push(op);
+                return;
+            }
+            if (fInstr->opAvail & 2) {
+                // Address in memory. Load it into the temporary register
+                SEmuOp mop = op;
+                bool limit = false;
+                if (!decodeMemoryOperand(mop, limit)) {
+                    emitUnsupported();
+                    return;
+                }
+                mop.ot = 3;
+                mop.rd = EMU_REG_TEMP;
+                mop.handler = loadHandler(3, limit);
+                ops.push(mop);
+                op.rs1 = EMU_REG_TEMP;
+            }
+            else op.rs1 = pInstr->a.rd;          // Address in register
+            op.handler = call ? emuCallRegister : emuJumpRegister;
+            ops.push(op);
+            return;
+        }
+        emitUnsupported();                       // System call, trap, or jump table
+        return;
+    }
+    // Self-relative jump target, scaled by 4, relative to end of instruction
+    int64_t offset = 0;
+    switch (fInstr->addrSize) {
+    case 1:
+        offset = *(int8_t*)(pInstr->b + fInstr->addrPos);  break;
+    case 2:
+        offset = *(int16_t*)(pInstr->b + fInstr->addrPos);  break;
+    case 3:
+        offset = pInstr->d.im2;  break;          // 24 bits in template D
+    case 4:
+        offset = *(int32_t*)(pInstr->b + fInstr->addrPos);  break;
+    default:
+        emitUnsupported();
+        return;
+    }
+    op.offset = address + instrLength * 4 + offset * 4;
+    op.flags = EMU_FLAG_TARGET;
+
+    // Operation and condition are in the instruction id
+    uint32_t base = id & 0xFF;
+    uint32_t cond = (id >> 8) & 0xFF;
+    if (base == 0) {
+        if (cond == 0x10) op.handler = emuJump;
+        else if (cond == 0x11) op.handler = emuCall;
+        else {
+            emitUnsupported();
+            return;
+        }
+        ops.push(op);
+        return;
+    }
+    if (cond >= 0x12) {
+        // Bit 0 of opj inverts the condition. (The id of borrow and nborrow is the same)
+        uint32_t opj = (fInstr->imm2 & 0x80) ? pInstr->b[0] : pInstr->a.op1;
+        op.options = opj & 1;
+        cond &= 0xFE;
+    }
+    else cond = EMU_COND_ALWAYS;
+    bool immediate = (fInstr->opAvail & 1) != 0;
+    op.handler = iRecord->sourceoperands == 3 ? jumpHandler(base, cond, immediate) : 0;
+    if (op.handler == 0) {
+        emitUnsupported();
+        return;
+    }
+    // Operands are selected in the same way as in CDisassembler::writeJumpInstruction
+    op.rs1 = pInstr->a.rd;
+    if ((fInstr->opAvail & 0x21) == 0x21) op.rs1 = pInstr->a.rs;
+    if (immediate) {
+        if (!decodeImmediate(op.imm)) {
+            emitUnsupported();
+            return;
+        }
+        // The maximum vector length is the same for all operand types
+        if (base == EMU_SUB_MAXLEN) op.imm = EMU_MAX_VECTOR_LENGTH;
+    }
+    else op.rs2 = pInstr->a.rs;
+    op.rd = pInstr->a.rd;
+    ops.push(op);
+}
+
+// Translate one of a pair of tiny instructions
+void CEmulator::decodeTiny(uint32_t tiny) {
+    STinyTemplate ti;
+    ti.i = tiny;
+    SInstruction2 iRecSearch;
+    iRecSearch.category = 2;
+    iRecSearch.op1 = ti.t.op1;
+    iRecSearch.op2 = 0;
+    uint64_t index;
+    if (instructionlist.findAll(&index, iRecSearch) != 1) {
+        emitUnsupported();
+        return;
+    }
+    iRecord = &instructionlist[index];
+    SEmuOp op = newOp(address, 3);               // General purpose tiny instructions are int64
+    uint8_t rs = ti.t.rs & 0xF;
+    uint8_t rd = ti.t.rd;
+    switch (ti.t.op1 ? iRecord->format : 0) {
+    case 0:                                      // nop
+        op.handler = emuNop;
+        break;
+    case 1:                                      // rd = op(rd, unsigned 4-bit constant)
+        op.rd = op.rs1 = rd;
+        op.imm = rs;
+        op.handler = arithmeticHandler(iRecord->id, true);
+        break;
+    case 2:                                      // rd = op(rd, rs)
+        op.rd = op.rs1 = rd;
+        op.rs2 = rs;
+        op.handler = arithmeticHandler(iRecord->id, false);
+        break;
+    case 4:                                      // rd = [rs]. rs = 15 means sp
+        op.rd = rd;
+        op.base = rs == 15 ? 31 : rs;
+        op.handler = loadHandler(3, false);
+        break;
+    case 5:                                      // [rs] = rd
+        op.rs2 = rd;
+        op.base = rs == 15 ? 31 : rs;
+        op.handler = storeHandler(3, false, false);
+        break;
+    case 9:                                      // vector rd = float or double converted from signed 4-bit constant
+        op.ot = 5 + (ti.t.op1 & 1);
+        op.rd = op.rs1 = rd;
+        op.imm = floatBits(ti.t.rs, op.ot);
+        op.handler = vectorHandler(iRecord->id, op.ot, true, simd);
+        break;
+    case 10:                                     // vector rd = op(rd, vector rs). Float for even op1, double for odd op1
+        op.ot = 5 + (ti.t.op1 & 1);
+        op.rd = op.rs1 = rd;
+        op.rs2 = rs;
+        if (iRecord->sourceoperands == 1) op.rs1 = rs;  // Copy vector
+        op.handler = vectorHandler(iRecord->id, op.ot, false, simd);
+        break;
+    }
+    if (op.handler == 0) {                       // Other vector instructions are not supported
+        emitUnsupported();
+        return;
+    }
+    ops.push(op);
+}
+
+// Get base, index, scale, offset, and limit of memory operand. Returns false if not supported
+bool CEmulator::decodeMemoryOperand(SEmuOp & op, bool & limit) {
+    if (fInstr->mem == 0) return false;
+    uint32_t baseP = pInstr->a.rt;               // Base pointer is RT or RS
+    if (fInstr->mem & 2) baseP = pInstr->a.rs;
+    op.base = baseP;
+    op.offset = 0;
+    if (fInstr->mem & 0x10) {                    // Has offset
+        switch (fInstr->addrSize) {
+        case 1:
+            op.offset = *(int8_t*)(pInstr->b + fInstr->addrPos);  break;
+        case 2:
+            op.offset = *(int16_t*)(pInstr->b + fInstr->addrPos);  break;
+        case 4:
+            op.offset = *(int32_t*)(pInstr->b + fInstr->addrPos);  break;
+        }
+        if (fInstr->scale & 1) op.offset <<= dataSizeLog2[operandType & 7]; // Offset is scaled
+    }
+    if (fInstr->addrSize > 1 && baseP >= 28) {   // Special pointers used if at least 16 bit offset
+        switch (baseP) {
+        case 28:
+            op.base = EMU_REG_THREADP;  break;
+        case 29:
+            op.base = EMU_REG_DATAP;  break;
+        case 30:                                 // IP-relative. Address is relative to end of instruction
+            op.base = EMU_REG_ZERO;
+            op.offset += address + instrLength * 4;
+            break;
+        }
+    }
+    if ((fInstr->mem & 4) && pInstr->a.rs != 31) { // Has index in RS
+        if (fInstr->scale & 4) {                 // Index is subtracted. Used only with vectors
+            if (!(fInstr->vect & 1)) return false;
+            op.flags |= EMU_FLAG_NEGATIVE;
+        }
+        op.index = pInstr->a.rs;
+        if (fInstr->scale & 2) op.scale = dataSizeLog2[operandType & 7]; // Index is scaled by operand size
+    }
+    if ((fInstr->vect & 6) && pInstr->a.rs != 31) { // Vector length or broadcast length in RS
+        op.length = pInstr->a.rs;
+    }
+    limit = false;
+    if (fInstr->mem & 0x20) {                    // Has limit on index
+        if (fInstr->addrSize == 4) op.imm = *(uint32_t*)(pInstr->b + fInstr->addrPos);
+        else op.imm = *(uint16_t*)(pInstr->b + fInstr->addrPos);
+        limit = true;
+    }
+    return true;
+}
+
+// Get immediate operand. Same interpretation as in CDisassembler::writeImmediateOperand
+bool CEmulator::decodeImmediate(int64_t & x) {
+    if ((variant & VARIANT_M1) && fInstr->tmpl == 0xE && (fInstr->opAvail & 2)) {
+        x = pInstr->a.im3;                       // VARIANT_M1: immediate operand is in IM3
+        return operandType < 5;
+    }
+    const uint8_t * bb = pInstr->b;
+    if (operandType >= 5 && !(variant & VARIANT_I2) && (iRecord->opimmediate == 0 || iRecord->opimmediate == 64)) {
+        // Floating point immediate operand. Convert to float or double
+        double f;
+        switch (fInstr->immSize) {
+        case 1:                                  // Integer
+            f = *(int8_t*)(bb + fInstr->immPos);  break;
+        case 2:                                  // Half precision
+            f = half2float(*(uint16_t*)(bb + fInstr->immPos));  break;
+        case 4:
+            f = *(float*)(bb + fInstr->immPos);  break;
+        case 8:
+            if (operandType == 5) f = *(float*)(bb + fInstr->immPos);  // Float in double size field
+            else f = *(double*)(bb + fInstr->immPos);
+            break;
+        default:
+            return false;
+        }
+        x = floatBits(f, operandType);
+        return true;
+    }
+    switch (fInstr->immSize) {
+    case 1:
+        x = *(int8_t*)(bb + fInstr->immPos);  break;
+    case 2:
+        x = *(int16_t*)(bb + fInstr->immPos);  break;
+    case 4:
+        x = *(int32_t*)(bb + fInstr->immPos);  break;
+    case 8:
+        x = *(int64_t*)(bb + fInstr->immPos);  break;
+    case 14:                                     // 4 bits
+        x = *(int8_t*)(bb + fInstr->immPos) & 0xF;
+        if (iRecord->opimmediate == 1) x = (int8_t)(x << 4) >> 4;
+        break;
+    default:
+        return false;
+    }
+    switch (iRecord->opimmediate) {
+    case 0: case 100:                            // Same as operand type
+        if ((fInstr->imm2 & 4) && fInstr->immSize == 2 && pInstr->a.im3 && !(variant & VARIANT_On)) {
+            x = (uint64_t)x << pInstr->a.im3;    // IM2 << IM3
+        }
+        if ((fInstr->imm2 & 8) && fInstr->immSize == 4 && pInstr->a.im2) {
+            x = pInstr->a.im2 < 64 ? (uint64_t)x << pInstr->a.im2 : 0; // IM4 << IM2
+        }
+        break;
+    case 2:
+        x = (int8_t)x;  break;
+    case 3:
+        x = (int16_t)x;  break;
+    case 4:
+        x = (int32_t)x;  break;
+    case 5: case 21:
+        break;
+    case 6:                                      // IM2 << IM1
+        x = (uint8_t)x < 64 ? (uint64_t)(int64_t)(int8_t)(x >> 8) << (uint8_t)x : 0;  break;
+    case 8:
+        x = (uint64_t)(int64_t)(int16_t)x << 16;  break;
+    case 9:
+        x = (uint64_t)(uint32_t)x << 32;  break;
+    case 17:
+        x &= 0xF;  break;
+    case 18:
+        x = (uint8_t)x;  break;
+    case 19:
+        x = (uint16_t)x;  break;
+    case 20:
+        x = (uint32_t)x;  break;
+    default:
+        return false;
+    }
+    if (operandType >= 5 && !(variant & VARIANT_I2)) return false; // Integer constant for float operand
+    return true;
+}
+
+// Register file index of source register. Returns 0xFF if not supported
+uint8_t CEmulator::sourceRegister(uint32_t r) {
+    if (!(variant & VARIANT_SPECS)) return (uint8_t)r;
+    if (((variant >> VARIANT_SPECB) & 0xF) == 0) {
+        // Special pointer
+        if (r < 28 || r == 31) return (uint8_t)r;
+        if (r == 28) return EMU_REG_THREADP;
+        if (r == 29) return EMU_REG_DATAP;
+    }
+    return 0xFF;                                 // IP or other special registers
+}
+
+// Make micro-operation for instruction that cannot be emulated
+void CEmulator::emitUnsupported() {
+    SEmuOp op = newOp(address, 0);
+    op.imm = pInstr->i[0];
+    op.handler = emuUnsupported;
+    ops.push(op);
+}
+
+// Convert jump target addresses to pointers into ops
+void CEmulator::resolveTargets() {
+    uint32_t i, num = (uint32_t)ops.numEntries();
+    for (i = 0; i < num; i++) {
+        if (!(ops[i].flags & EMU_FLAG_TARGET)) continue;
+        uint64_t target = (uint64_t)ops[i].offset;
+        uint32_t k = 0;
+        if (target < ipSize && !(target & 3)) k = codeMap[(uint32_t)(target >> 2)];
+        if (k == 0) {
+            // Not the beginning of an instruction. Make an operation that reports the error
+            SEmuOp bad = newOp(ops[i].address, 0);
+            bad.offset = (int64_t)target;
+            bad.handler = emuBadTarget;
+            k = (uint32_t)ops.push(bad) + 1;
+        }
+        ops[i].offset = k - 1;
+    }
+    // ops will not grow any more. Pointers into ops can be used now
+    SEmuOp * list = &ops[0];
+    for (i = 0; i < num; i++) {
+        if (list[i].flags & EMU_FLAG_TARGET) list[i].target = list + list[i].offset;
+    }
+}
+
+// Combine adjacent micro-operations into one. An arithmetic operation gets a handler that
+// also executes the following arithmetic operation and a following compare with zero and
+// conditional jump. The handler reads the operands of the following micro-operations but
+// does not change them. Each micro-operation is combined with the ones that follow it, so
+// that a jump, call, or return into the middle of a combination executes the rest of it
+void CEmulator::fuseOperations() {
+    uint32_t num = (uint32_t)ops.numEntries();
+    // Find the combination for each micro-operation before any handler is changed
+    CDynamicArray<EmuHandler> fused;
+    fused.setNum(num);
+    for (uint32_t i = 0; i + 1 < num; i++) {
+        SEmuOp & op = ops[i];
+        SEmuOp const & next = ops[i + 1];
+        bool imm1 = false, imm2 = false;
+        uint32_t id1 = fusedOperation(op.handler, imm1);
+        if (id1 == 0) continue;
+        uint32_t cond = zeroJumpCondition(next, op.rd, op.ot);
+        if (cond) {
+            fused[i] = arithJumpHandler(id1, imm1, cond);
+            continue;
+        }
+        uint32_t id2 = fusedOperation(next.handler, imm2);
+        if (id2 == 0) continue;
+        cond = i + 2 < num ? zeroJumpCondition(ops[i + 2], next.rd, next.ot) : 0;
+        if (cond) {
+            fused[i] = pairJumpHandler(id1, imm1, id2, imm2);
+            op.options = (uint8_t)cond;          // Not used by the arithmetic operations in fusedOperations
+        }
+        else fused[i] = pairHandler(id1, imm1, id2, imm2);
+    }
+    for (uint32_t i = 0; i < num; i++) {
+        if (fused[i]) ops[i].handler = fused[i];
+    }
+}
+
+// Find micro-operation for jump target calculated at run time
+SEmuOp const * CEmulator::jumpTo(uint64_t target, SEmuOp const * op) {
+    uint32_t k = 0;
+    if (target < ipSize && !(target & 3)) k = codeMap[(uint32_t)(target >> 2)];
+    if (k == 0) return fault(ERR_EMU_JUMP_TARGET, op, target);
+    return &ops[k - 1];
+}
+
+// Stop execution with error message
+SEmuOp const * CEmulator::fault(uint32_t error, SEmuOp const * op, uint64_t value) {
+    faultError = error;
+    faultAddress = op->address;
+    faultValue = value;
+    return 0;
+}
+
+// Execute the program
+void CEmulator::run() {
+    // Find entry point
+    uint64_t entry = fileHeader.e_entry;
+    uint32_t k = 0;
+    if (entry < ipSize && !(entry & 3)) k = codeMap[(uint32_t)(entry >> 2)];
+    if (k == 0) {
+        err.submit(ERR_EMU_JUMP_TARGET, (int)entry, (int)entry);
+        return;
+    }
+    SEmuOp const * op = &ops[k - 1];
+    uint64_t n = 0;                              // Count micro-operations
+    clock_t startTime = clock();
+
+    // Dispatch loop
+    while (op) {
+        op = op->handler(*this, op);
+        n++;
+    }
+
+    double seconds = double(clock() - startTime) / CLOCKS_PER_SEC;
+    opCount = n;
+    if (faultError) {
+        err.submit(faultError, (int)faultValue, (int)faultAddress);
+        return;
+    }
+    printf("\nProgram returned %lli (0x%llX)", (long long)registers[0], (unsigned long long)registers[0]);
+    if (cmd.verbose) {
+        printf("\n%llu micro-operations executed in %.3f seconds", (unsigned long long)opCount, seconds);
+        if (seconds > 0) printf(", %.0f million per second", opCount / seconds * 1E-6);
+        printf("\nVector kernels: %s", simd ? simdName : "loops");
+    }
+}
@@ -0,0 +1,159 @@
+/****************************    emulator.h    ********************************
+* Author:        Agner Fog
+* Date created:  2017-11-25
+* Last modified: 2017-11-28
+* Version:       1.00
+* Project:       Binary tools for ForwardCom instruction set
+* Module:        emulator.h
+* Description:
+* Header file for emulator
+*
+* Copyright 2017 GNU General Public License http://www.gnu.org/licenses
+*****************************************************************************/
+#pragma once
+
+/* The emulator runs an executable file made by the linker in two stages:
+
+Stage 1 predecodes all code sections once. Each instruction is looked up with lookupFormat
+and the instruction list, in the same way as the disassembler does it, and translated into
+one or more micro-operations (SEmuOp). A micro-operation contains a pointer to the function
+that executes it, register indexes, immediate operand, operand type, and decoded memory
+operand. An instruction with a memory source operand is split into a load into a temporary
+register followed by the operation. A masked instruction is split into the operation into
+the temporary register followed by a select. A tiny instruction pair gives two micro-operations.
+Jump targets are resolved to pointers into the list of micro-operations.
+
+The predecoded list is kept for the whole run. Code cannot change because the IP group is
+read-only. Adjacent micro-operations are then combined into superinstructions: an integer
+move, add, sub, and, or, or xor is combined with a following one of these, such as the other
+half of a tiny instruction pair, and with a following compare with zero and conditional jump
+on its result. The combined handler reads the operands of the following micro-operations, which
+are left unchanged, so that a jump into the middle of a combination works. The command line
+option -emu-n turns this off.
+There is no basic-block cache. Blocks are not discovered at jump targets, combinations are
+formed over the whole predecoded list rather than per block, and nothing is invalidated when
+memory is written, because stores to the IP group are not allowed.
+
+Stage 2 executes the micro-operations. Each handler returns a pointer to the next
+micro-operation, so that a taken jump costs no more than any other instruction.
+The dispatch loop makes one indirect call per micro-operation. A combination counts as one.
+
+The memory image has the IP group at address 0, followed by the DATAP and THREADP groups
+and the stack. The IP group is read-only. The program ends when the entry function returns.
+The return value is in r0.
+
+Vector registers have a maximum length of EMU_MAX_VECTOR_LENGTH bytes for all operand types.
+The bytes beyond the current length of a vector register are always zero. Vector instructions
+with operand types int8 - int64, float, and double are executed by kernels that are templated
+on the element type. The SIMD kernels process the whole register with SSE2 or AVX2 instructions
+and clear the tail beyond the vector length with a mask made from the length. The loop kernels
+process one element at a time. They are used when the command line option -emu-s is given,
+and for operations that have no SIMD instruction, such as multiplication of 64-bit integers.
+
+Not supported yet: masked vector instructions, floating point in general purpose registers,
+system calls, and jump tables. Such instructions are translated into a micro-operation that
+stops the emulation with an error message if it is executed.
+*/
+
+// Register file indexes. 0-31 are the general purpose registers
+const uint32_t EMU_REG_ZERO    = 32;       // Always zero. Used for missing base, index, or fallback
+const uint32_t EMU_REG_TEMP    = 33;       // Temporary result of split instruction
+const uint32_t EMU_REG_THREADP = 34;       // threadp
+const uint32_t EMU_REG_DATAP   = 35;       // datap
+const uint32_t EMU_REG_NUM     = 36;       // Size of register file
+
+// Vector register file indexes. 0-31 are v0 - v31
+const uint32_t EMU_VECTOR_TEMP = 32;       // Temporary vector for memory operand
+const uint32_t EMU_VECTOR_NUM  = 33;       // Size of vector register file
+const uint32_t EMU_MAX_VECTOR_LENGTH = 64; // Maximum length of vector registers, in bytes
+
+const uint64_t EMU_STACK_SIZE      = 0x100000; // Size of data stack
+const uint32_t EMU_CALL_STACK_SIZE = 0x10000;  // Maximum depth of function calls
+
+// Values for SEmuOp::flags
+const uint8_t  EMU_FLAG_TARGET = 1;        // offset contains jump target address to resolve
+const uint8_t  EMU_FLAG_NEGATIVE = 2;      // index of memory operand is subtracted
+
+class CEmulator;
+struct SEmuOp;
+
+// Function that executes a micro-operation and returns the next one, or 0 to stop
+typedef SEmuOp const * (*EmuHandler)(CEmulator & emu, SEmuOp const * op);
+
+// Predecoded micro-operation
+struct SEmuOp {
+    EmuHandler handler;                    // Function that executes the operation
+    SEmuOp const * target;                 // Jump target
+    int64_t  imm;                          // Immediate operand, or limit on index
+    int64_t  offset;                       // Offset of memory operand. Jump target address during predecoding
+    uint32_t address;                      // Address of instruction, for error messages
+    uint8_t  rd;                           // Destination register. Vector register for vector instructions
+    uint8_t  rs1;                          // First source register
+    uint8_t  rs2;                          // Second source register, or register to store
+    uint8_t  ot;                           // Operand type, 0-3. 0-6 for vector instructions
+    uint8_t  base;                         // Base register of memory operand
+    uint8_t  index;                        // Index register of memory operand
+    uint8_t  scale;                        // Index is shifted left by scale
+    uint8_t  mask;                         // Mask register of select
+    uint8_t  fallback;                     // Fallback register of select
+    uint8_t  options;                      // Condition for compare. Invert condition for jump
+    uint8_t  flags;                        // EMU_FLAG_TARGET, EMU_FLAG_NEGATIVE
+    uint8_t  length;                       // Register with vector length or broadcast length of memory operand
+};
+
+// Emulator class. Gets the executable file in its buffer
+class CEmulator : public CELF {
+public:
+    CEmulator();                                 // Constructor
+    void go();                                   // Run the program
+    // Machine state. Public for access from the micro-operation handlers
+    uint64_t registers[EMU_REG_NUM];             // Register file
+    alignas(64) uint8_t vectors[EMU_VECTOR_NUM][EMU_MAX_VECTOR_LENGTH]; // Vector registers
+    uint32_t vectorLength[EMU_VECTOR_NUM];       // Length of each vector register, in bytes
+    int8_t * mem;                                // Emulated memory = memory.buf()
+    uint64_t memSize;                            // Size of emulated memory
+    uint64_t writeBegin;                         // First address that can be written
+    SEmuOp const ** callStack;                   // Return addresses
+    uint32_t callDepth;                          // Number of entries in callStack
+    SEmuOp const * fault(uint32_t error, SEmuOp const * op, uint64_t value); // Stop with error message
+    SEmuOp const * jumpTo(uint64_t address, SEmuOp const * op); // Find micro-operation for run-time jump target
+protected:
+    CDynamicArray<SInstruction2> instructionlist;// List of instruction set, sorted by category, format, and op1
+    CMemoryBuffer memory;                        // Memory image of program
+    CDynamicArray<SEmuOp> ops;                   // Predecoded micro-operations
+    CDynamicArray<uint32_t> codeMap;             // Index+1 into ops for each 32-bit word in IP group. 0 if not code
+    CDynamicArray<SEmuOp const *> callStackBuffer; // Storage for callStack
+    uint64_t ipSize;                             // Size of IP group
+    uint64_t datapBase;                          // Address of DATAP group
+    uint64_t threadpBase;                        // Address of THREADP group
+    bool simd;                                   // Use SIMD kernels for vector instructions
+    uint32_t faultError;                         // Error code if program stopped by fault
+    uint32_t faultAddress;                       // Address of instruction that caused fault
+    uint64_t faultValue;                         // Address or value that caused fault
+    uint64_t opCount;                            // Number of micro-operations executed
+    // Variables used during predecoding, as in CDisassembler
+    uint32_t address;                            // Address of current instruction
+    uint32_t instrLength;                        // Length of current instruction, in 32-bit words
+    uint32_t operandType;                        // Operand type of current instruction
+    uint32_t format;                             // Format of current instruction
+    uint64_t variant;                            // Template variant and options
+    STemplate const * pInstr;                    // Pointer to current instruction code
+    SInstruction2 const * iRecord;               // Pointer to instruction table entry
+    SFormat const * fInstr;                      // Format details of current instruction code
+    SFormat formCopy;                            // Modified copy of format details
+    void initializeInstructionList();            // Get instruction list
+    void loadProgram();                          // Make memory image from program headers
+    void predecode();                            // Translate all code sections into micro-operations
+    void decodeInstruction();                    // Translate instruction at address
+    void decodeNormal();                         // Translate normal instruction
+    void decodeVector(SEmuOp & op, SEmuOp & mop, uint8_t const * src, int nOp, bool immediate, bool memory, bool store); // Translate vector instruction
+    void decodeJump();                           // Translate jump, call, or return instruction
+    void decodeTiny(uint32_t tiny);              // Translate one of a pair of tiny instructions
+    bool decodeMemoryOperand(SEmuOp & op, bool & limit); // Get base, index, scale, offset, and limit
+    bool decodeImmediate(int64_t & x);           // Get immediate operand. Returns false if not supported
+    uint8_t sourceRegister(uint32_t r);          // Register file index of special pointer or general purpose register
+    void emitUnsupported();                      // Make micro-operation for unsupported instruction
+    void resolveTargets();                       // Convert jump target addresses to pointers
+    void fuseOperations();                       // Combine adjacent micro-operations
+    void run();                                  // Execute the program
+};
@@ -51,6 +51,9 @@ SErrorText errorTexts[] = {
    {1214, 1, "Symbol %s defined in both modules %s"}, //?
    {1303, 1, "Cannot find imported symbol"}, //?
    {1304, 1, "Unknown relocation address"}, //?
+   {ERR_LINK_NO_ENTRY, 1, "No entry point found. Executable file has no main function"},
+   {ERR_LIBRARY_MEMBER_NOT_FOUND, 1, "Library member %s not found"},
+   {ERR_LIBRARY_DUPLICATE_SYMBOL, 1, "Symbol %s in library member %s is already defined in another member. Only the first one is indexed"},
 
    // Error messages
    {ERR_MULTIPLE_IO_FILES, 2, "No more than one input file and one output file can be specified"}, //?
@@ -72,6 +75,7 @@ SErrorText errorTexts[] = {
    {ERR_ELF_SYMTAB_MISSING, 2, "Symbol table not found in ELF file"},
    {ERR_ELF_INDEX_RANGE, 2, "Index out of range in object file"},
    {ERR_ELF_UNKNOWN_SECTION, 2, "Unknown section index in ELF file: %i"},
+   {ERR_ELF_SECTION_SIZE, 2, "Section %s is too big. Sections of 4 GB or more are not supported"},
    {2037, 2, "Symbol storage/binding type %i not supported"}, //?
    {2038, 2, "Symbol type %i not supported"}, //?
    {2040, 2, "Symbol table corrupt in object file"}, //?
@@ -97,6 +101,23 @@ SErrorText errorTexts[] = {
    {ERR_INSTRUCTION_LIST_SYNTAX, 2, "Syntax error in instruction list: %s"},
    {ERR_INSTRUCTION_LIST_QUOTE, 2, "Unmatched quote in instruction list, line %i"},  //?
 
+   {ERR_LINK_FILE_TYPE, 2, "File %s is not a ForwardCom object file"},
+   {ERR_LINK_NO_INPUT, 2, "No object files to link"},
+   {ERR_LINK_DUPLICATE_SYMBOL, 2, "Symbol %s is defined in more than one module, including %s"},
+   {ERR_LINK_UNRESOLVED, 2, "Unresolved external symbol %s in module %s"},
+   {ERR_LINK_RELOCATION_TYPE, 2, "Unsupported relocation type 0x%X in module %s"},
+   {ERR_LINK_OVERFLOW, 2, "Address of %s does not fit into relocation field in module %s"},
+   {ERR_LINK_MISALIGNED, 2, "Address of %s is not divisible by the scale factor of relocation in module %s"},
+   {ERR_LIBRARY_FILE_TYPE, 2, "File %s is not a ForwardCom library or it is corrupt"},
+   {ERR_LIBRARY_MEMBER_TYPE, 2, "Cannot store file %s in library. It is not a ForwardCom object file"},
+   {ERR_EMU_FILE_TYPE, 2, "File %s is not a ForwardCom executable file"},
+   {ERR_EMU_UNKNOWN_INSTRUCTION, 2, "Emulation of instruction 0x%08X at address 0x%X not supported"},
+   {ERR_EMU_MEMORY_ACCESS, 2, "Access violation at memory address 0x%X by instruction at address 0x%X"},
+   {ERR_EMU_JUMP_TARGET, 2, "Jump to invalid address 0x%X from instruction at address 0x%X"},
+   {ERR_EMU_CALL_STACK, 2, "Call stack overflow at depth %i, instruction address 0x%X"},
+   {ERR_EMU_INDEX_LIMIT, 2, "Index 0x%X exceeds limit in instruction at address 0x%X"},
+   {ERR_EMU_END_OF_CODE, 2, "Execution continues past end of code section at address 0x%X"},
+
    {2500, 2, "Library/archive file is corrupt"}, //?
    {2501, 2, "Cannot store file of type %s in library"}, //?
    {2502, 2, "Too many members in library"}, //?
@@ -385,6 +406,9 @@ void CErrorReporter::clearError(int ErrorNumber) {
 // Members of class CAssemErrors: reporting of errors in assembly file
 CAssemErrors::CAssemErrors() {                   // Constructor
     maxErrors = cmd.maxErrors;
+    numStreamed = 0;
+    cacheLine = 0xFFFFFFFF;
+    cachePos = 0;  cacheExtra = 0;
 }
 
 void CAssemErrors::setOwner(CAssembler * a) {
@@ -424,6 +448,8 @@ void CAssemErrors::report(uint32_t position, uint32_t stringLength, uint32_t num
 
     // save error record
     list.push(e);
+    // stream diagnostic. lines are not complete until after pass 1
+    if (cmd.diagFormat == CMDL_DIAG_JSON && e.pass > 1) streamDiagnostics();
 }
 
 // Report a misplaced token
@@ -440,16 +466,144 @@ void CAssemErrors::reportLine(uint32_t num) {
         num);
 }
 
+void CAssemErrors::findLineColumn(uint32_t pos, uint32_t & line, uint32_t & column) {
+    // Find line and column of a position in the input file.
+    // line is the index of the first record in lines[] for the line containing pos.
+    // column is 1-based
+    const uint32_t tabstops = 8;                      // default position of tabstops
+    uint32_t j;
+
+    // find line containing error. lines[] is sorted by beginPos, so use binary search
+    // for the last record with beginPos <= pos
+    uint32_t a = 0, b = owner->lines.numEntries();   // search interval
+    while (a < b) {
+        uint32_t m = (a + b) >> 1;
+        if (pos < owner->lines[m].beginPos) b = m;
+        else a = m + 1;
+    }
+    line = a - 1;
+    // if this line has multiple records in lines[] then find the first one
+    j = line;
+    while (j > 0 && owner->lines[j-1].linenum == owner->lines[line].linenum) j--;
+    line = j;
+
+    // find column
+    uint32_t pos1 = owner->lines[line].beginPos;
+    column = pos - pos1;
+    // count UTF-8 multibyte characters in line up to error position
+    int32_t extraBytes = 0;
+    int8_t c;   // current character
+    if (line == cacheLine && pos >= cachePos) {
+        // continue scan from previous error in same line
+        extraBytes = cacheExtra;
+        pos1 = cachePos;
+    }
+    for (uint32_t pp = pos1; pp < pos; pp++) {
+        c = *(owner->buf() + pp);
+        if ((c & 0xC0) == 0x80) extraBytes--;   // count UTF-8 continuation bytes
+        if (c == '\t') {
+            uint32_t col = pp - owner->lines[line].beginPos + extraBytes;  // 0-based column of tab
+            uint32_t pos2 = (col + tabstops) / tabstops * tabstops;        // find next tabstop
+            extraBytes += pos2 - col - 1;
+        }  
+    }
+    cacheLine = line;  cachePos = pos;  cacheExtra = extraBytes;
+    // adjust column number to 1-based. count UTF-8 characters as one
+    column += extraBytes + 1;
+}
+
+const char * CAssemErrors::errorText(SAssemError const & e, char * text2) {
+    // Get text for error message. Any extra string is written to text2, which must have 256 bytes
+    const uint32_t errorTextsLength = TableSize(assemErrorTexts);
+    uint32_t j;
+    for (j = 0; j < errorTextsLength; j++) {
+        if ((uint32_t)assemErrorTexts[j].errorNumber == e.num) break;
+    }
+    if (j >= errorTextsLength) j = 0;
+    if (assemErrorTexts[j].status && e.stringLength < 256) {
+        // extra text required
+        memcpy(text2, owner->buf() + e.pos, e.stringLength);
+        text2[e.stringLength] = 0;
+    }
+    else text2[0] = 0;
+    return assemErrorTexts[j].text;
+}
+
+// Write string to JSON buffer with quotes and escape sequences
+static void pushJsonString(CMemoryBuffer & b, const char * s) {
+    static const char hexDigits[] = "0123456789abcdef";
+    char esc[8] = "\\u00";
+    b.push("\"", 1);
+    const char * run = s;                        // start of run of characters that need no escape
+    for (; *s; s++) {
+        uint8_t c = (uint8_t)*s;
+        if (c != '"' && c != '\\' && c >= 0x20) continue;
+        if (s > run) b.push(run, s - run);
+        if (c >= 0x20) {
+            esc[1] = c;  b.push(esc, 2);
+        }
+        else {
+            esc[1] = 'u';  esc[4] = hexDigits[c >> 4];  esc[5] = hexDigits[c & 0xF];
+            b.push(esc, 6);
+        }
+        run = s + 1;
+    }
+    if (s > run) b.push(run, s - run);
+    b.push("\"", 1);
+}
+
+void CAssemErrors::streamDiagnostics() {
+    // Format errors that have not been written yet as JSON lines in diagBuffer.
+    // The buffer is written to stderr in chunks
+    const uint32_t chunkSize = 0x4000;                // write buffer when it exceeds this size
+    const char * filename = owner->fileName;          // to do: support include filenames
+    char text[256+32];
+    char text2[256];
+    uint32_t line, column;
+    for (; numStreamed < list.numEntries() && numStreamed < maxErrors; numStreamed++) {
+        SAssemError const & e = list[numStreamed];
+        findLineColumn(e.pos, line, column);
+        const char * text1 = errorText(e, text2);
+        diagBuffer.push("{\"file\":", 8);
+        if (filename) pushJsonString(diagBuffer, filename);
+        else diagBuffer.push("null", 4);
+        sprintf(text, ",\"line\":%u,\"column\":%i,\"length\":%u,\"code\":%u,\"severity\":\"error\",\"pass\":%u,\"message\":",
+            owner->lines[line].linenum, (int32_t)column, e.stringLength, e.num, e.pass);
+        diagBuffer.push(text, strlen(text));
+        snprintf(text, sizeof(text), "%s%s", text1, text2);
+        pushJsonString(diagBuffer, text);
+        diagBuffer.push("}\n", 2);
+        if (diagBuffer.dataSize() >= chunkSize) {
+            fwrite(diagBuffer.buf(), 1, (size_t)diagBuffer.dataSize(), stderr);
+            diagBuffer.setSize(0);
+        }
+    }
+}
+
+void CAssemErrors::flushDiagnostics() {
+    // Write all pending diagnostics if streaming output is enabled.
+    // Called at the end of each pass
+    if (cmd.diagFormat != CMDL_DIAG_JSON) return;
+    streamDiagnostics();
+    if (diagBuffer.dataSize()) {
+        fwrite(diagBuffer.buf(), 1, (size_t)diagBuffer.dataSize(), stderr);
+        diagBuffer.setSize(0);
+    }
+    fflush(stderr);
+}
+
 void CAssemErrors::outputErrors() {
     // Output errors to STDERR
-    const uint32_t tabstops = 8;                      // default position of tabstops
-    
+    if (cmd.diagFormat == CMDL_DIAG_JSON) {
+        // errors have been streamed during assembly. write the rest
+        flushDiagnostics();
+        return;
+    }
     if (list.numEntries() == 0) return;
     const char * text1;
     char text2[256];
     const char * filename = owner->fileName; // to do: support include filenames
-    const uint32_t errorTextsLength = TableSize(assemErrorTexts);
-    uint32_t i, j, texti; 
+    uint32_t i, line, column; 
 
     uint32_t lastPass = 0;
     for (i = 0; i < list.numEntries() && i < maxErrors; i++) {
@@ -458,51 +612,10 @@ void CAssemErrors::outputErrors() {
             printf("\n\nDuring pass %i:", list[i].pass);
             lastPass = list[i].pass;
         }
-
-        // find line containing error
-        uint32_t line;
-        uint32_t numLines = owner->lines.numEntries();
-        uint32_t pos = list[i].pos;
-        for (line = 0; line < numLines; line++) {
-            if (pos < owner->lines[line].beginPos) break;
-        }
-        line--;
-        // if this line has multiple records in lines[] then find the first one
-        j = line;
-        while (j > 0 && owner->lines[j-1].linenum == owner->lines[line].linenum) j--;
-        line = j;
-
-        // find column
-        uint32_t pos1 = owner->lines[line].beginPos;
-        uint32_t stringLength = list[i].stringLength;
-        uint32_t column = pos - pos1;
-        // count UTF-8 multibyte characters in line up to error position
-        int32_t extraBytes = 0;
-        int8_t c;   // current character
-        for (uint32_t pp = pos1; pp < pos1 + column; pp++) {
-            c = *(owner->buf() + pp);
-            if ((c & 0xC0) == 0xC0) extraBytes--;   // count UTF-8 continuation bytes
-            if (c == '\t') {
-                uint32_t pos2 = (pp + tabstops) % tabstops;  // find next tabstop
-                extraBytes += pos2 - pp - 1;
-            }  
-        }
-        // adjust column number to 1-based. count UTF-8 characters as one
-        column += extraBytes + 1;
- 
+        // find line and column
+        findLineColumn(list[i].pos, line, column);
         // find text
-        texti = list[i].num;
-        for (j = 0; j < errorTextsLength; j++) {
-            if ((uint32_t)assemErrorTexts[j].errorNumber == texti) break;
-        }
-        if (j >= errorTextsLength) j = 0;
-        text1 = assemErrorTexts[j].text;
-        if (assemErrorTexts[j].status && stringLength < sizeof(text2)) {
-            // extra text required
-            memcpy(text2, owner->buf() + pos, stringLength);
-            text2[stringLength] = 0;
-        }
-        else text2[0] = 0;
+        text1 = errorText(list[i], text2);
 
         if (filename) {        
             fprintf(stderr, "\n%s:", filename);
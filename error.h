@@ -36,8 +36,28 @@ const int ERR_ELF_SYMTAB_MISSING       = 0x2206;
 const int ERR_ELF_INDEX_RANGE          = 0x2207;
 const int ERR_ELF_UNKNOWN_SECTION      = 0x2208;
 const int ERR_ELF_STRING_TABLE         = 0x2209;
+const int ERR_ELF_SECTION_SIZE         = 0x220A;
 const int ERR_INSTRUCTION_LIST_SYNTAX  = 0x2300;
 const int ERR_INSTRUCTION_LIST_QUOTE   = 0x2301;
+const int ERR_LINK_FILE_TYPE           = 0x2400;
+const int ERR_LINK_NO_INPUT            = 0x2401;
+const int ERR_LINK_DUPLICATE_SYMBOL    = 0x2402;
+const int ERR_LINK_UNRESOLVED          = 0x2403;
+const int ERR_LINK_RELOCATION_TYPE     = 0x2404;
+const int ERR_LINK_OVERFLOW            = 0x2405;
+const int ERR_LINK_MISALIGNED          = 0x2406;
+const int ERR_LINK_NO_ENTRY            = 0x2407;
+const int ERR_LIBRARY_FILE_TYPE        = 0x2500;
+const int ERR_LIBRARY_MEMBER_TYPE      = 0x2501;
+const int ERR_LIBRARY_MEMBER_NOT_FOUND = 0x2502;
+const int ERR_LIBRARY_DUPLICATE_SYMBOL = 0x2503;
+const int ERR_EMU_FILE_TYPE            = 0x2600;
+const int ERR_EMU_UNKNOWN_INSTRUCTION  = 0x2601;
+const int ERR_EMU_MEMORY_ACCESS        = 0x2602;
+const int ERR_EMU_JUMP_TARGET          = 0x2603;
+const int ERR_EMU_CALL_STACK           = 0x2604;
+const int ERR_EMU_INDEX_LIMIT          = 0x2605;
+const int ERR_EMU_END_OF_CODE          = 0x2606;
 const int ERR_TOO_MANY_ERRORS          = 0x9000;
 const int ERR_BIG_ENDIAN               = 0x9001;
 const int ERR_INTERNAL                 = 0x9002;
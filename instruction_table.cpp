@@ -0,0 +1,1090 @@
+/****************************  instruction_table.cpp  ************************
+* Project:       Binary tools for ForwardCom instruction set
+* Module:        instruction_table.cpp
+* Description:
+* Built-in instruction list, generated from instruction_list.csv by the command
+*   forw -ilist-compile instruction_list.csv instruction_table.cpp
+* Do not edit this file. Run 'make ilist' to remake it after changing instruction_list.csv
+*
+* Copyright 2017 GNU General Public License http://www.gnu.org/licenses
+*****************************************************************************/
+#include "stdafx.h"
+
+// Number of instruction records
+const uint32_t builtinInstructionsNum = 353;
+
+// Instruction records sorted by name. Used by assembler
+const SInstruction builtinInstructionsByName[] = {
+//  id, category, format, templt, sourceoperands, op1, op2, optypesgp, optypesscalar, optypesvector, opimmediate, template_variant, name
+    {0xA0000, 1, 0x180, 0xB, 2, 0x0, 0, 0x100F, 0x0, 0x0, 0x12, "", "abs"},
+    {0xA0000, 1, 0x130, 0xB, 2, 0x10, 0, 0x0, 0xF00F, 0xF00F, 0x2, "I2", "abs"},
+    {0x8, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x8, 0, 0xF, 0x906F, 0x906F, 0x0, "", "add"},
+    {0x8, 2, 0x1, 0x1, 2, 0x2, 0, 0x8, 0x0, 0x0, 0x11, "", "add"},
+    {0x8, 2, 0x2, 0x1, 2, 0x9, 0, 0x8, 0x0, 0x0, 0x0, "", "add"},
+    {0x8, 2, 0xA, 0x1, 2, 0x14, 0, 0x0, 0x20, 0x20, 0x0, "", "add"},
+    {0x8, 2, 0xA, 0x1, 2, 0x15, 0, 0x0, 0x40, 0x40, 0x0, "", "add"},
+    {0x8, 1, 0x110, 0xC, 2, 0x2, 0, 0x8, 0x0, 0x0, 0x3, "", "add"},
+    {0x8, 1, 0x110, 0xC, 2, 0x7, 0, 0x8, 0x0, 0x0, 0x8, "", "add"},
+    {0x8, 1, 0x110, 0xC, 2, 0x11, 0, 0x8, 0x0, 0x0, 0x6, "", "add"},
+    {0x8, 1, 0x290, 0xA, 2, 0x2, 0, 0x8, 0x0, 0x0, 0x14, "", "add"},
+    {0x8, 1, 0x290, 0xA, 2, 0x4, 0, 0x8, 0x0, 0x0, 0x9, "", "add"},
+    {0x8, 1, 0x131, 0xC, 2, 0x21, 0, 0x0, 0x200, 0x200, 0x3, "", "add"},
+    {0x8, 1, 0x132, 0xC, 2, 0x2A, 0, 0x0, 0x400, 0x400, 0x6, "", "add"},
+    {0x8, 1, 0x132, 0xC, 2, 0x2B, 0, 0x0, 0x800, 0x800, 0x6, "", "add"},
+    {0x8, 1, 0x133, 0xC, 2, 0x3A, 0, 0x0, 0x2000, 0x2000, 0x40, "", "add"},
+    {0x8, 1, 0x133, 0xC, 2, 0x3B, 0, 0x0, 0x4000, 0x4000, 0x40, "", "add"},
+    {0x101008, 4, 0x35021, 0x0, 3, 0x37, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump"},
+    {0x102008, 4, 0x135021, 0x0, 3, 0x18, 0, 0xF, 0x1000, 0x0, 0x0, "U0", "add/jump_carry"},
+    {0x102108, 4, 0x135021, 0x0, 3, 0x19, 0, 0xF, 0x1000, 0x0, 0x0, "U0", "add/jump_ncarry"},
+    {0x101608, 4, 0x135021, 0x0, 3, 0x12, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_neg"},
+    {0x101708, 4, 0x135021, 0x0, 3, 0x13, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_nneg"},
+    {0x101908, 4, 0x135021, 0x0, 3, 0x17, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_noverfl"},
+    {0x101508, 4, 0x135021, 0x0, 3, 0x15, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_npos"},
+    {0x101308, 4, 0x135021, 0x0, 3, 0x11, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_nzero"},
+    {0x101808, 4, 0x135021, 0x0, 3, 0x16, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_overfl"},
+    {0x101408, 4, 0x135021, 0x0, 3, 0x14, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_pos"},
+    {0x101208, 4, 0x135021, 0x0, 3, 0x10, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_zero"},
+    {0x32, 3, 0xFFFFFFFFF700F, 0x0, 3, 0x32, 0, 0xF00, 0xFF00, 0xFF00, 0x0, "O3", "add_add"},
+    {0x1201C, 1, 0x120, 0xA, 2, 0x1C, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "add_c"},
+    {0x2001C, 2, 0xB, 0x1, 2, 0x1C, 0, 0x8, 0xFF, 0xFF, 0x0, "R0R1", "add_cps"},
+    {0x50008, 1, 0x120, 0xA, 2, 0x30, 0, 0x0, 0x200, 0x200, 0x0, "H0", "add_h"},
+    {0x50008, 1, 0x131, 0xC, 2, 0x25, 0, 0x0, 0x200, 0x200, 0x40, "H0", "add_h"},
+    {0x12026, 1, 0x120, 0xA, 2, 0x26, 0, 0x0, 0xFF00, 0xFF00, 0x0, "", "add_oc"},
+    {0x1201E, 1, 0x120, 0xA, 2, 0x1E, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "add_ss"},
+    {0x1201F, 1, 0x120, 0xA, 2, 0x1F, 0, 0x0, 0x1F00, 0x1F00, 0x0, "U0", "add_us"},
+    {0x29020, 1, 0x291, 0xA, 1, 0x20, 0, 0x8, 0x0, 0x0, 0x0, "X0", "address"},
+    {0x1C, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x1C, 0, 0xF, 0x906F, 0x906F, 0x0, "", "and"},
+    {0x1C, 2, 0x2, 0x1, 2, 0xB, 0, 0x8, 0x0, 0x0, 0x0, "", "and"},
+    {0x1C, 1, 0x110, 0xC, 2, 0x12, 0, 0x8, 0x0, 0x0, 0x6, "", "and"},
+    {0x1C, 1, 0x290, 0xA, 2, 0x5, 0, 0x8, 0x0, 0x0, 0x9, "", "and"},
+    {0x1C, 1, 0x131, 0xC, 2, 0x22, 0, 0x0, 0x200, 0x200, 0x3, "", "and"},
+    {0x1C, 1, 0x132, 0xC, 2, 0x2C, 0, 0x0, 0x400, 0x400, 0x6, "", "and"},
+    {0x1C, 1, 0x132, 0xC, 2, 0x2D, 0, 0x0, 0x800, 0x800, 0x6, "", "and"},
+    {0x10131C, 4, 0x135021, 0x0, 3, 0x1B, 0, 0xF, 0x9060, 0x0, 0x0, "", "and/jump_nzero"},
+    {0x10121C, 4, 0x135021, 0x0, 3, 0x1A, 0, 0xF, 0x9060, 0x0, 0x0, "", "and/jump_zero"},
+    {0x27, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x27, 0, 0xF, 0x906F, 0x906F, 0x0, "I2M1", "and_bit"},
+    {0x1D, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x1D, 0, 0xF, 0x906F, 0x906F, 0x0, "", "and_not"},
+    {0x13015, 1, 0x130, 0xB, 1, 0x15, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "bit_reverse"},
+    {0x1200E, 1, 0x120, 0xA, 2, 0xE, 0, 0x0, 0x906F, 0x906F, 0x0, "R1", "bits2bool"},
+    {0x10001, 1, 0x100, 0xA, 1, 0x1, 0, 0x1F00, 0x0, 0x0, 0x0, "", "bitscan_f"},
+    {0x10001, 1, 0x130, 0xB, 1, 0x16, 0, 0x0, 0x100F, 0x1F00, 0x0, "", "bitscan_f"},
+    {0x10002, 1, 0x100, 0xA, 1, 0x2, 0, 0x1F00, 0x0, 0x0, 0x0, "", "bitscan_r"},
+    {0x10002, 1, 0x130, 0xB, 1, 0x17, 0, 0x0, 0x100F, 0x1F00, 0x0, "", "bitscan_r"},
+    {0x1200F, 1, 0x120, 0xA, 2, 0xF, 0, 0x0, 0x906F, 0x906F, 0x0, "R1RL", "bool2bits"},
+    {0x12010, 1, 0x120, 0xA, 2, 0x10, 0, 0x0, 0x906F, 0x906F, 0x0, "R1RL", "bool_reduce"},
+    {0x1200D, 1, 0x120, 0xA, 2, 0xD, 0, 0x0, 0xFF, 0xFF, 0x0, "R1RL", "broad"},
+    {0x1200D, 1, 0x130, 0xB, 2, 0x12, 0, 0x0, 0x906F, 0x906F, 0x2, "R1RL", "broad"},
+    {0x1200D, 1, 0x260, 0xA, 2, 0x6, 0, 0x0, 0x906F, 0x906F, 0x64, "R1RL", "broad"},
+    {0x13013, 1, 0x130, 0xB, 1, 0x13, 0, 0x0, 0x906F, 0x906F, 0x2, "", "broadcast_max"},
+    {0x13014, 1, 0x130, 0xB, 1, 0x14, 0, 0x0, 0x100F, 0x100F, 0x0, "", "byte_reverse"},
+    {0x101100, 4, 0x2002, 0xB, 1, 0x3B, 0, 0xF, 0x0, 0x0, 0x0, "D0", "call"},
+    {0x101100, 4, 0x10, 0xD, 1, 0x8, 0, 0xF, 0x0, 0x0, 0x0, "D0", "call"},
+    {0x101100, 4, 0x10040, 0xC, 1, 0x3B, 0, 0xF, 0x0, 0x0, 0x0, "D0", "call"},
+    {0x101100, 4, 0x100000, 0xC, 1, 0x3B, 0, 0xF, 0x0, 0x0, 0x15, "D0", "call"},
+    {0x101100, 4, 0x2004, 0xA, 2, 0x3D, 0, 0xF, 0x0, 0x0, 0x0, "D1", "call"},
+    {0x101100, 4, 0x80, 0xC, 1, 0x3D, 0, 0xF, 0x0, 0x0, 0x0, "D0", "call"},
+    {0x20010, 2, 0x8, 0x1, 0, 0x10, 0, 0x0, 0x8, 0x8, 0x0, "D2", "clear"},
+    {0x25, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x25, 0, 0xF, 0x906F, 0x906F, 0x0, "I2M1", "clear_bit"},
+    {0x7, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x7, 0, 0xF, 0x906F, 0x906F, 0x0, "O6U3", "compare"},
+    {0x102207, 4, 0x135021, 0x0, 3, 0x28, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_absabove"},
+    {0x102107, 4, 0x135021, 0x0, 3, 0x27, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_absaboveeq"},
+    {0x102007, 4, 0x135021, 0x0, 3, 0x26, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_absbelow"},
+    {0x102307, 4, 0x135021, 0x0, 3, 0x29, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_absbeloweq"},
+    {0x101207, 4, 0x135021, 0x0, 3, 0x20, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_eq"},
+    {0x102707, 4, 0x1001, 0x0, 3, 0x19, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_finite"},
+    {0x101307, 4, 0x135021, 0x0, 3, 0x21, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_neq"},
+    {0x102607, 4, 0x1001, 0x0, 3, 0x18, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_nfinite"},
+    {0x101407, 4, 0x135021, 0x0, 3, 0x24, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_sabove"},
+    {0x101707, 4, 0x135021, 0x0, 3, 0x23, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_saboveeq"},
+    {0x101607, 4, 0x135021, 0x0, 3, 0x22, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_sbelow"},
+    {0x101507, 4, 0x135021, 0x0, 3, 0x25, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_sbeloweq"},
+    {0x102207, 4, 0x135021, 0x0, 3, 0x28, 0, 0xF, 0x1000, 0x0, 0x0, "D1U0O4", "compare/jump_uabove"},
+    {0x102107, 4, 0x135021, 0x0, 3, 0x27, 0, 0xF, 0x1000, 0x0, 0x0, "D1U0O4", "compare/jump_uaboveeq"},
+    {0x102007, 4, 0x135021, 0x0, 3, 0x26, 0, 0xF, 0x1000, 0x0, 0x0, "D1U0O4", "compare/jump_ubelow"},
+    {0x102307, 4, 0x135021, 0x0, 3, 0x29, 0, 0xF, 0x1000, 0x0, 0x0, "D1U0O4", "compare/jump_ubeloweq"},
+    {0x25912, 1, 0x259, 0xA, 3, 0x12, 0, 0xFF00, 0xFF00, 0x0, 0x0, "D1", "compare_swap"},
+    {0x42207, 4, 0x40000, 0xC, 2, 0x3F, 0, 0x8, 0x0, 0x0, 0x14, "D0", "compare_trap_uabove"},
+    {0x12004, 1, 0x120, 0xA, 2, 0x4, 0, 0x0, 0xB04E, 0xB04E, 0x0, "R1RL", "compress"},
+    {0x12009, 1, 0x120, 0xA, 2, 0x9, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R1RL", "compress_sparse"},
+    {0x12005, 1, 0x120, 0xA, 2, 0x5, 0, 0x0, 0xFE00, 0xFE00, 0x0, "R1RL", "compress_ss"},
+    {0x12006, 1, 0x120, 0xA, 2, 0x6, 0, 0x0, 0xFE00, 0xFE00, 0x0, "R1RL", "compress_us"},
+    {0x22600, 1, 0x226, 0xE, 3, 0x0, 1, 0x0, 0x906F, 0x906F, 0x0, "R2RL", "concatenate"},
+    {0x10, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x10, 0, 0xF, 0x906F, 0xFF00, 0x0, "O4", "div"},
+    {0x10, 1, 0x110, 0xC, 2, 0x6, 0, 0x8, 0x0, 0x0, 0x3, "", "div"},
+    {0x12018, 1, 0x120, 0xA, 2, 0x18, 0, 0x0, 0x1906, 0x1F00, 0x0, "", "div_ex"},
+    {0x12019, 1, 0x120, 0xA, 2, 0x19, 0, 0x0, 0x1906, 0x1F00, 0x0, "U0", "div_ex_u"},
+    {0x50010, 1, 0x120, 0xA, 2, 0x33, 0, 0x0, 0x200, 0x200, 0x0, "H0", "div_h"},
+    {0x1202A, 1, 0x120, 0xA, 2, 0x2A, 0, 0x0, 0xFF00, 0xFF00, 0x0, "", "div_oc"},
+    {0x12, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x12, 0, 0xF, 0x906F, 0xFF00, 0x0, "O4", "div_rev"},
+    {0x11, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x11, 0, 0xF, 0x100F, 0x100F, 0x0, "O4U0", "div_u"},
+    {0x12007, 1, 0x120, 0xA, 2, 0x7, 0, 0x0, 0xB04E, 0xB04E, 0x0, "R1RL", "expand"},
+    {0x1200A, 1, 0x120, 0xA, 2, 0xA, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R1RL", "expand_sparse"},
+    {0x12008, 1, 0x120, 0xA, 2, 0x8, 0, 0x0, 0x100E, 0x100E, 0x0, "R1RL", "expand_u"},
+    {0x1200B, 1, 0x120, 0xA, 2, 0xB, 0, 0x0, 0xFF, 0xFF, 0x0, "R1", "extract"},
+    {0x25A20, 1, 0x25A, 0xA, 2, 0x20, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R2M0", "extract_store"},
+    {0x25910, 1, 0x259, 0xA, 2, 0x10, 0, 0xFF00, 0x0, 0x0, 0x12, "D1", "fence"},
+    {0x4101F, 4, 0x40, 0xC, 0, 0x3F, 0, 0xFF, 0xFF, 0x0, 0x0, "D0", "filler"},
+    {0x1300C, 1, 0x130, 0xB, 2, 0xC, 0, 0x0, 0x8060, 0x8060, 0x12, "I2", "float2int"},
+    {0x13011, 1, 0x130, 0xB, 2, 0x11, 0, 0x0, 0x8060, 0x8060, 0x12, "I2", "fp_category"},
+    {0x12001, 1, 0x120, 0xA, 1, 0x1, 0, 0x0, 0x906F, 0x906F, 0x0, "R0", "get_len"},
+    {0x12003, 1, 0x120, 0xA, 1, 0x3, 0, 0x0, 0x906F, 0x906F, 0x0, "R0", "get_num"},
+    {0x13000, 1, 0x130, 0xB, 1, 0x0, 0, 0x6F, 0x6F, 0x0, 0x0, "R1", "gp2vec"},
+    {0x51, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "increment_compare"},
+    {0x101451, 4, 0x135021, 0x0, 3, 0x32, 0, 0xF, 0x1000, 0x0, 0x0, "O4", "increment_compare/jump_sabove"},
+    {0x101551, 4, 0x135021, 0x0, 3, 0x33, 0, 0xF, 0x1000, 0x0, 0x0, "O4", "increment_compare/jump_sbeloweq"},
+    {0x1203E, 1, 0x120, 0xA, 2, 0x3E, 0, 0x0, 0x100F, 0x100F, 0x0, "R1R2", "input"},
+    {0x1200C, 1, 0x120, 0xA, 2, 0xC, 0, 0x0, 0xFF, 0xFF, 0x0, "R1", "insert"},
+    {0x29001, 1, 0x290, 0xA, 2, 0x1, 0, 0x8, 0x0, 0x0, 0x14, "", "insert_hi"},
+    {0x29001, 1, 0x260, 0xA, 2, 0x1, 0, 0x0, 0x906F, 0x906F, 0x64, "", "insert_hi"},
+    {0x1300D, 1, 0x130, 0xB, 1, 0xD, 0, 0x0, 0x100C, 0x100C, 0x0, "", "int2float"},
+    {0x22602, 1, 0x226, 0xE, 3, 0x2, 1, 0x0, 0x0, 0xFF00, 0x0, "R2RL", "interleave"},
+    {0x101000, 4, 0x2002, 0xB, 1, 0x3A, 0, 0xF, 0x0, 0x0, 0x0, "D0", "jump"},
+    {0x101000, 4, 0x10, 0xD, 1, 0x0, 0, 0xF, 0x0, 0x0, 0x0, "D0", "jump"},
+    {0x101000, 4, 0x10040, 0xC, 1, 0x3A, 0, 0xF, 0x0, 0x0, 0x0, "D0", "jump"},
+    {0x101000, 4, 0x100000, 0xC, 1, 0x3A, 0, 0xF, 0x0, 0x0, 0x15, "D0", "jump"},
+    {0x101000, 4, 0x2004, 0xA, 2, 0x3C, 0, 0xF, 0x0, 0x0, 0x0, "D1", "jump"},
+    {0x101000, 4, 0x80, 0xC, 1, 0x3C, 0, 0xF, 0x0, 0x0, 0x0, "D0", "jump"},
+    {0x101400, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_above"},
+    {0x101700, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_aboveeq"},
+    {0x102200, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_absabove"},
+    {0x102100, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_absaboveeq"},
+    {0x102000, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_absbelow"},
+    {0x102300, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_absbeloweq"},
+    {0x101200, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_all1"},
+    {0x101600, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_below"},
+    {0x101500, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_beloweq"},
+    {0x102000, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "U0", "jump_borrow"},
+    {0x102000, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_carry"},
+    {0x101200, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_eq"},
+    {0x101200, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_equal"},
+    {0x102700, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_finite"},
+    {0x101300, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_nall1"},
+    {0x102000, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "U0", "jump_nborrow"},
+    {0x102100, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_ncarry"},
+    {0x101600, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_neg"},
+    {0x101300, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_neq"},
+    {0x102600, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_nfinite"},
+    {0x101700, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_nneg"},
+    {0x101300, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_notequal"},
+    {0x101900, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_noverfl"},
+    {0x101500, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_npos"},
+    {0x101300, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_nzero"},
+    {0x101800, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_overfl"},
+    {0x101400, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_pos"},
+    {0x101400, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_sabove"},
+    {0x101700, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_saboveeq"},
+    {0x101600, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_sbelow"},
+    {0x101500, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_sbeloweq"},
+    {0x102200, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1U0", "jump_uabove"},
+    {0x102100, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1U0", "jump_uaboveeq"},
+    {0x102000, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1U0", "jump_ubelow"},
+    {0x102300, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1U0", "jump_ubeloweq"},
+    {0x101200, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_zero"},
+    {0x26000, 1, 0x260, 0xA, 1, 0x0, 0, 0x0, 0x906F, 0x906F, 0x64, "", "load_hi"},
+    {0x26002, 1, 0x260, 0xA, 2, 0x2, 0, 0x0, 0x906F, 0x906F, 0x14, "", "make_mask"},
+    {0x13004, 1, 0x130, 0xB, 2, 0x4, 0, 0x0, 0xF00F, 0xF00F, 0x2, "R1", "make_sequence"},
+    {0x28701, 1, 0x227, 0xE, 3, 0x1, 1, 0x0, 0x100F, 0x100F, 0x12, "R1RLO5", "mask_length"},
+    {0x18, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x18, 0, 0xF, 0x906F, 0x906F, 0x0, "", "max"},
+    {0x19, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x19, 0, 0x8060, 0x8060, 0x8060, 0x0, "", "max_abs"},
+    {0x19, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x19, 0, 0xF, 0x100F, 0x100F, 0x0, "U0", "max_u"},
+    {0x16, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x16, 0, 0xF, 0x906F, 0x906F, 0x0, "", "min"},
+    {0x17, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x17, 0, 0x8060, 0x8060, 0x8060, 0x0, "", "min_abs"},
+    {0x17, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x17, 0, 0xF, 0x100F, 0x100F, 0x0, "U0", "min_u"},
+    {0x2, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 1, 0x2, 0, 0xF, 0x906F, 0x906F, 0x0, "", "move"},
+    {0x2, 2, 0x1, 0x1, 1, 0x1, 0, 0x8, 0x0, 0x0, 0x11, "", "move"},
+    {0x2, 2, 0x2, 0x1, 1, 0x8, 0, 0x8, 0x0, 0x0, 0x0, "", "move"},
+    {0x2, 2, 0x4, 0x1, 1, 0xE, 0, 0x8, 0x0, 0x0, 0x0, "", "move"},
+    {0x2, 2, 0xA, 0x1, 1, 0x11, 0, 0x0, 0x8, 0x8, 0x0, "D2", "move"},
+    {0x2, 2, 0x9, 0x1, 1, 0x12, 0, 0x0, 0x20, 0x0, 0x21, "", "move"},
+    {0x2, 2, 0x9, 0x1, 1, 0x13, 0, 0x0, 0x40, 0x0, 0x21, "", "move"},
+    {0x2, 1, 0x110, 0xC, 1, 0x0, 0, 0x8, 0x0, 0x0, 0x3, "", "move"},
+    {0x2, 1, 0x110, 0xC, 1, 0x10, 0, 0x8, 0x0, 0x0, 0x6, "", "move"},
+    {0x2, 1, 0x290, 0xA, 1, 0x0, 0, 0x8, 0x0, 0x0, 0x9, "", "move"},
+    {0x2, 1, 0x131, 0xC, 1, 0x20, 0, 0x0, 0x200, 0x0, 0x3, "", "move"},
+    {0x2, 1, 0x132, 0xC, 1, 0x28, 0, 0x0, 0x400, 0x0, 0x6, "", "move"},
+    {0x2, 1, 0x132, 0xC, 1, 0x29, 0, 0x0, 0x800, 0x0, 0x6, "", "move"},
+    {0x2, 1, 0x133, 0xC, 1, 0x38, 0, 0x0, 0x2000, 0x2000, 0x40, "", "move"},
+    {0x2, 1, 0x133, 0xC, 1, 0x39, 0, 0x0, 0x4000, 0x4000, 0x40, "", "move"},
+    {0x28700, 1, 0x207, 0xE, 3, 0x0, 1, 0x1F00, 0x0, 0x0, 0x19, "O6I2", "move_bits"},
+    {0x28700, 1, 0x227, 0xE, 3, 0x0, 1, 0x0, 0x1F00, 0x1F00, 0x19, "O6I2", "move_bits"},
+    {0x11001, 1, 0x110, 0xC, 1, 0x1, 0, 0x8, 0x0, 0x0, 0x13, "U0", "move_u"},
+    {0xB, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0xB, 0, 0xF, 0x906F, 0x9867, 0x0, "", "mul"},
+    {0xB, 2, 0xA, 0x1, 2, 0x18, 0, 0x0, 0x20, 0x20, 0x0, "", "mul"},
+    {0xB, 2, 0xA, 0x1, 2, 0x19, 0, 0x0, 0x40, 0x40, 0x0, "", "mul"},
+    {0xB, 1, 0x110, 0xC, 2, 0x5, 0, 0x8, 0x0, 0x0, 0x3, "", "mul"},
+    {0xB, 1, 0x133, 0xC, 2, 0x3C, 0, 0x0, 0x2000, 0x2000, 0x40, "", "mul"},
+    {0xB, 1, 0x133, 0xC, 2, 0x3D, 0, 0x0, 0x4000, 0x4000, 0x40, "", "mul"},
+    {0x20, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x20, 0, 0x0, 0x8060, 0x8060, 0x0, "I2M1", "mul_2pow"},
+    {0x30, 3, 0xFFFFFFFFF700F, 0x0, 3, 0x30, 0, 0xF00, 0xFF00, 0xFF00, 0x0, "O4", "mul_add"},
+    {0x31, 3, 0xFFFFFFFFF700F, 0x0, 3, 0x31, 0, 0xF00, 0xFF00, 0xFF00, 0x0, "O4", "mul_add2"},
+    {0x50030, 1, 0x120, 0xA, 3, 0x34, 0, 0x0, 0x200, 0x200, 0x0, "H0", "mul_add_h"},
+    {0xE, 3, 0xFF000FF00C0FC, 0x0, 2, 0xE, 0, 0xB04, 0x1B04, 0x1F00, 0x0, "", "mul_ex"},
+    {0xF, 3, 0xFF000FF00C0FC, 0x0, 2, 0xF, 0, 0xB04, 0x1B04, 0x1F00, 0x0, "U0", "mul_ex_u"},
+    {0x5000B, 1, 0x120, 0xA, 2, 0x32, 0, 0x0, 0x200, 0x200, 0x0, "H0", "mul_h"},
+    {0x5000B, 1, 0x131, 0xC, 2, 0x26, 0, 0x0, 0x200, 0x200, 0x40, "H0", "mul_h"},
+    {0xC, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0xC, 0, 0xB04, 0x1B04, 0x1F00, 0x0, "", "mul_hi"},
+    {0xD, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0xD, 0, 0xB04, 0x1B04, 0x1F00, 0x0, "U0", "mul_hi_u"},
+    {0x12029, 1, 0x120, 0xA, 2, 0x29, 0, 0x0, 0xFF00, 0xFF00, 0x0, "", "mul_oc"},
+    {0x12022, 1, 0x120, 0xA, 2, 0x22, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "mul_ss"},
+    {0x12023, 1, 0x120, 0xA, 2, 0x23, 0, 0x0, 0x1F00, 0x1F00, 0x0, "U0", "mul_us"},
+    {0x30000, 3, 0xFFF, 0x0, 0, 0x0, 0, 0xF, 0xFF, 0x0, 0x0, "D0", "nop"},
+    {0x30200, 3, 0xFFFFF000, 0x0, 0, 0x0, 0, 0xF, 0xFF, 0x0, 0x0, "D0", "nop2"},
+    {0x30300, 3, 0xFFFFF00000000, 0x0, 0, 0x0, 0, 0xF, 0xFF, 0x0, 0x0, "D0", "nop3"},
+    {0x20000, 2, 0x1, 0x1, 0, 0x0, 0, 0xF, 0x0, 0x0, 0x0, "D0", "nop_t"},
+    {0x1E, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x1E, 0, 0xF, 0x906F, 0x906F, 0x0, "", "or"},
+    {0x1E, 2, 0x2, 0x1, 2, 0xC, 0, 0x8, 0x0, 0x0, 0x0, "", "or"},
+    {0x1E, 1, 0x110, 0xC, 2, 0x13, 0, 0x8, 0x0, 0x0, 0x6, "", "or"},
+    {0x1E, 1, 0x290, 0xA, 2, 0x6, 0, 0x8, 0x0, 0x0, 0x9, "", "or"},
+    {0x1E, 1, 0x131, 0xC, 2, 0x23, 0, 0x0, 0x200, 0x200, 0x3, "", "or"},
+    {0x1E, 1, 0x132, 0xC, 2, 0x2E, 0, 0x0, 0x400, 0x400, 0x6, "", "or"},
+    {0x1E, 1, 0x132, 0xC, 2, 0x2F, 0, 0x0, 0x800, 0x800, 0x6, "", "or"},
+    {0x10131E, 4, 0x135021, 0x0, 3, 0x1D, 0, 0xF, 0x9060, 0x0, 0x0, "", "or/jump_nzero"},
+    {0x10121E, 4, 0x135021, 0x0, 3, 0x1C, 0, 0xF, 0x9060, 0x0, 0x0, "", "or/jump_zero"},
+    {0x1203F, 1, 0x120, 0xA, 3, 0x3F, 0, 0x0, 0x100F, 0x100F, 0x0, "R2R3D1", "output"},
+    {0x22601, 1, 0x226, 0xE, 3, 0x1, 1, 0x0, 0x906F, 0x906F, 0x0, "R2RL", "permute"},
+    {0x22601, 1, 0x260, 0xA, 3, 0x8, 0, 0x0, 0x906F, 0x906F, 0x14, "I2R1RL", "permute"},
+    {0x13018, 1, 0x130, 0xB, 1, 0x18, 0, 0x0, 0x100F, 0x1F00, 0x0, "", "popcount"},
+    {0x3, 3, 0xA0900F0FA3F0, 0x0, 1, 0x3, 0, 0xF, 0x906F, 0x906F, 0x0, "D04", "prefetch"},
+    {0x1203A, 1, 0x120, 0xA, 2, 0x3A, 0, 0x0, 0x100F, 0x100F, 0x0, "R1R2", "read_call_stack"},
+    {0x18022, 1, 0x180, 0xB, 2, 0x22, 0, 0x1708, 0x0, 0x0, 0x12, "X2", "read_capabilities"},
+    {0x25A18, 1, 0x25A, 0xA, 3, 0x18, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R2", "read_insert"},
+    {0x1203C, 1, 0x120, 0xA, 2, 0x3C, 0, 0x0, 0x100F, 0x100F, 0x0, "R1R2", "read_memory_map"},
+    {0x18024, 1, 0x180, 0xB, 2, 0x24, 0, 0x1708, 0x0, 0x0, 0x12, "X3", "read_perf"},
+    {0x18025, 1, 0x180, 0xB, 2, 0x25, 0, 0x1708, 0x0, 0x0, 0x12, "X3", "read_perfs"},
+    {0x18020, 1, 0x180, 0xB, 2, 0x20, 0, 0x1708, 0x0, 0x0, 0x12, "X1", "read_spec"},
+    {0x13002, 1, 0x130, 0xB, 2, 0x2, 0, 0x0, 0x100F, 0x100F, 0x12, "R1", "read_spev"},
+    {0x18026, 1, 0x180, 0xB, 2, 0x26, 0, 0x1708, 0x0, 0x0, 0x12, "X4", "read_sys"},
+    {0x14, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x14, 0, 0xF, 0x906F, 0xFF00, 0x0, "", "rem"},
+    {0x15, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x15, 0, 0xF, 0xF, 0xF00, 0x0, "U0", "rem_u"},
+    {0x22608, 1, 0x227, 0xE, 3, 0x3, 1, 0x0, 0x0, 0xFC00, 0x13, "R1RLI2", "repeat_block"},
+    {0x22609, 1, 0x227, 0xE, 3, 0x4, 1, 0x0, 0x0, 0xFC00, 0x13, "R1RLI2", "repeat_within_blocks"},
+    {0xA0001, 1, 0x260, 0xA, 2, 0x3, 0, 0x0, 0x906F, 0x906F, 0x64, "", "replace"},
+    {0xA0001, 1, 0x318, 0xA, 2, 0x8, 0, 0x0, 0x906F, 0x906F, 0x64, "", "replace"},
+    {0x26009, 1, 0x290, 0xA, 2, 0x9, 0, 0x1F00, 0x0, 0x0, 0x1D, "O6", "replace_bits"},
+    {0x26009, 1, 0x260, 0xA, 2, 0x9, 0, 0x0, 0x1F00, 0x1F00, 0x1D, "O6", "replace_bits"},
+    {0x26004, 1, 0x260, 0xA, 2, 0x4, 0, 0x0, 0x906F, 0x906F, 0x64, "", "replace_even"},
+    {0x26005, 1, 0x260, 0xA, 2, 0x5, 0, 0x0, 0x906F, 0x906F, 0x64, "", "replace_odd"},
+    {0x2001E, 2, 0xC, 0x1, 1, 0x1E, 0, 0x0, 0xFF, 0xFF, 0x0, "D2", "restore_cp"},
+    {0x4001E, 4, 0x8, 0xB, 0, 0x3E, 0, 0xF, 0x0, 0x0, 0x0, "D0", "return"},
+    {0x21, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x21, 0, 0x100F, 0x100F, 0x100F, 0x0, "I2M1", "rotate"},
+    {0x102021, 4, 0x135001, 0x0, 3, 0xE, 0, 0xF, 0x9060, 0x0, 0x0, "I2", "rotate/jump_carry"},
+    {0x102121, 4, 0x135001, 0x0, 3, 0xF, 0, 0xF, 0x9060, 0x0, 0x0, "I2", "rotate/jump_ncarry"},
+    {0x12017, 1, 0x120, 0xA, 2, 0x17, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R1", "rotate_down"},
+    {0x12016, 1, 0x120, 0xA, 2, 0x16, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R1", "rotate_up"},
+    {0x1300E, 1, 0x130, 0xB, 2, 0xE, 0, 0x0, 0x8060, 0x8060, 0x12, "I2", "round"},
+    {0x1300F, 1, 0x130, 0xB, 2, 0xF, 0, 0x0, 0xE000, 0xE000, 0x2, "I2", "round2n"},
+    {0x10003, 1, 0x100, 0xA, 1, 0x3, 0, 0x100F, 0x0, 0x0, 0x0, "", "round_d2"},
+    {0x10004, 1, 0x100, 0xA, 1, 0x4, 0, 0x100F, 0x0, 0x0, 0x0, "", "round_u2"},
+    {0x2001F, 2, 0xD, 0x1, 1, 0x1F, 0, 0x0, 0xFF, 0xFF, 0x0, "M0D2", "save_cp"},
+    {0x24, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x24, 0, 0xF, 0x906F, 0x906F, 0x0, "I2M1", "set_bit"},
+    {0x12000, 1, 0x120, 0xA, 2, 0x0, 0, 0x0, 0x906F, 0x906F, 0x0, "R1RL", "set_len"},
+    {0x12002, 1, 0x120, 0xA, 2, 0x2, 0, 0x0, 0x906F, 0x906F, 0x0, "R1", "set_num"},
+    {0x18001, 1, 0x180, 0xB, 3, 0x1, 0, 0x100F, 0x0, 0x0, 0x12, "", "shift_add"},
+    {0x12015, 1, 0x120, 0xA, 2, 0x15, 0, 0x0, 0x906F, 0x906F, 0x0, "R1", "shift_down"},
+    {0x12012, 1, 0x120, 0xA, 2, 0x12, 0, 0x0, 0xFF, 0xFF, 0x0, "R1", "shift_expand"},
+    {0x20, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x20, 0, 0x100F, 0x100F, 0x100F, 0x0, "I2M1", "shift_left"},
+    {0x20, 2, 0x1, 0x1, 2, 0x4, 0, 0x8, 0x0, 0x0, 0x11, "U0", "shift_left"},
+    {0x101320, 4, 0x135001, 0x0, 3, 0xB, 0, 0xF, 0x9060, 0x0, 0x0, "I2", "shift_left/jump_nzero"},
+    {0x101220, 4, 0x135001, 0x0, 3, 0xA, 0, 0xF, 0x9060, 0x0, 0x0, "I2", "shift_left/jump_zero"},
+    {0x12013, 1, 0x120, 0xA, 2, 0x13, 0, 0x0, 0xFF, 0xFF, 0x0, "R1", "shift_reduce"},
+    {0x22, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x22, 0, 0x100F, 0x100F, 0x100F, 0x0, "I2M1", "shift_right_s"},
+    {0x23, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x23, 0, 0x100F, 0x100F, 0x100F, 0x0, "I2M1U0", "shift_right_u"},
+    {0x23, 2, 0x1, 0x1, 2, 0x5, 0, 0x8, 0x0, 0x0, 0x11, "U0", "shift_right_u"},
+    {0x101323, 4, 0x135001, 0x0, 3, 0xD, 0, 0xF, 0x9060, 0x0, 0x0, "U0I2", "shift_right_u/jump_nzero"},
+    {0x101223, 4, 0x135001, 0x0, 3, 0xC, 0, 0xF, 0x9060, 0x0, 0x0, "U0I2", "shift_right_u/jump_zero"},
+    {0x12024, 1, 0x120, 0xA, 2, 0x24, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "shift_ss"},
+    {0x12014, 1, 0x120, 0xA, 2, 0x14, 0, 0x0, 0x906F, 0x906F, 0x0, "R1", "shift_up"},
+    {0x12025, 1, 0x120, 0xA, 2, 0x25, 0, 0x0, 0x1F00, 0x1F00, 0x0, "U0", "shift_us"},
+    {0x4, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 1, 0x4, 0, 0x7, 0x7, 0x7, 0x0, "", "sign_extend"},
+    {0x5, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x5, 0, 0x700, 0x0, 0x0, 0x0, "", "sign_extend_add"},
+    {0x1201A, 1, 0x120, 0xA, 1, 0x1A, 0, 0x0, 0xE000, 0xE000, 0x0, "", "sqrt"},
+    {0x1, 3, 0xA0900F0FA3F0, 0x0, 1, 0x1, 0, 0xF, 0x906F, 0x906F, 0x0, "M0", "store"},
+    {0x1, 2, 0x5, 0x1, 1, 0xF, 0, 0x8, 0x0, 0x0, 0x0, "M0", "store"},
+    {0x1, 1, 0x258, 0xB, 1, 0x8, 0, 0xFF00, 0xFF00, 0x0, 0x64, "M0", "store"},
+    {0x9, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x9, 0, 0xF, 0x906F, 0x906F, 0x0, "", "sub"},
+    {0x9, 2, 0x1, 0x1, 2, 0x3, 0, 0x8, 0x0, 0x0, 0x11, "", "sub"},
+    {0x9, 2, 0x2, 0x1, 2, 0xA, 0, 0x8, 0x0, 0x0, 0x0, "", "sub"},
+    {0x9, 2, 0xA, 0x1, 2, 0x16, 0, 0x0, 0x20, 0x20, 0x0, "", "sub"},
+    {0x9, 2, 0xA, 0x1, 2, 0x17, 0, 0x0, 0x40, 0x40, 0x0, "", "sub"},
+    {0x9, 1, 0x290, 0xA, 2, 0x3, 0, 0x8, 0x0, 0x0, 0x14, "", "sub"},
+    {0x101009, 4, 0x35021, 0x0, 3, 0x36, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump"},
+    {0x102009, 4, 0x135001, 0xB, 3, 0x8, 0, 0xF, 0x1000, 0x0, 0x0, "U0", "sub/jump_borrow"},
+    {0x102009, 4, 0x135001, 0xB, 3, 0x9, 0, 0xF, 0x1000, 0x0, 0x0, "U0", "sub/jump_nborrow"},
+    {0x101609, 4, 0x135001, 0xB, 3, 0x2, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_neg"},
+    {0x101709, 4, 0x135001, 0xB, 3, 0x3, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_nneg"},
+    {0x101909, 4, 0x135001, 0xB, 3, 0x7, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_noverfl"},
+    {0x101509, 4, 0x135001, 0xB, 3, 0x5, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_npos"},
+    {0x101309, 4, 0x135001, 0xB, 3, 0x1, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_nzero"},
+    {0x101809, 4, 0x135001, 0xB, 3, 0x6, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_overfl"},
+    {0x101409, 4, 0x135001, 0xB, 3, 0x4, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_pos"},
+    {0x101209, 4, 0x135001, 0xB, 3, 0x0, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_zero"},
+    {0x1201D, 1, 0x120, 0xA, 2, 0x1D, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "sub_b"},
+    {0x2001D, 2, 0xB, 0x1, 2, 0x1D, 0, 0x8, 0xFF, 0xFF, 0x0, "R0R1", "sub_cps"},
+    {0x50009, 1, 0x120, 0xA, 2, 0x31, 0, 0x0, 0x200, 0x200, 0x0, "H0", "sub_h"},
+    {0x52, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x12, "", "sub_maxlen"},
+    {0x101552, 4, 0x10001, 0x0, 3, 0x35, 0, 0xF, 0x0, 0x0, 0x12, "", "sub_maxlen/jump_npos"},
+    {0x101452, 4, 0x10001, 0x0, 3, 0x34, 0, 0xF, 0x0, 0x0, 0x12, "", "sub_maxlen/jump_pos"},
+    {0x12027, 1, 0x120, 0xA, 2, 0x27, 0, 0x0, 0xFF00, 0xFF00, 0x0, "", "sub_oc"},
+    {0xA, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0xA, 0, 0xF, 0x906F, 0x906F, 0x0, "", "sub_rev"},
+    {0x12020, 1, 0x120, 0xA, 2, 0x20, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "sub_ss"},
+    {0x12021, 1, 0x120, 0xA, 2, 0x21, 0, 0x0, 0x1F00, 0x1F00, 0x0, "U0", "sub_us"},
+    {0x4001F, 4, 0x8, 0xA, 3, 0x3F, 0, 0xF, 0x0, 0x0, 0x0, "D1", "sys_call"},
+    {0x4001F, 4, 0x8000, 0xB, 3, 0x3F, 0, 0x80F, 0x0, 0x0, 0x1A, "D0", "sys_call"},
+    {0x4001F, 4, 0x80000, 0xB, 4, 0x3F, 0, 0x80F, 0x0, 0x0, 0x1B, "D0", "sys_call"},
+    {0x4001F, 4, 0x2000000, 0xB, 3, 0x3F, 0, 0x80F, 0x0, 0x0, 0x1C, "D0", "sys_call"},
+    {0x4101E, 4, 0x80, 0xC, 0, 0x3E, 0, 0xF, 0x0, 0x0, 0x0, "D0", "sys_return"},
+    {0x50, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "test"},
+    {0x101250, 4, 0x135021, 0x0, 3, 0x2C, 0, 0xF, 0x9060, 0x0, 0x0, "D1I2", "test/jump_all1"},
+    {0x101350, 4, 0x135021, 0x0, 3, 0x2D, 0, 0xF, 0x9060, 0x0, 0x0, "D1I2", "test/jump_nall1"},
+    {0x28, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x28, 0, 0xF, 0x906F, 0x906F, 0x0, "I2M1O5", "test_bit"},
+    {0x101328, 4, 0x135021, 0x0, 3, 0x2B, 0, 0xF, 0x9060, 0x0, 0x0, "D1I2", "test_bit/jump_nzero"},
+    {0x101228, 4, 0x135021, 0x0, 3, 0x2A, 0, 0xF, 0x9060, 0x0, 0x0, "D1I2", "test_bit/jump_zero"},
+    {0x29, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x29, 0, 0xF, 0x906F, 0x906F, 0x0, "O5", "test_bits"},
+    {0x2A, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x2A, 0, 0xF, 0x906F, 0x906F, 0x0, "O5", "test_bits_all1"},
+    {0x26, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x26, 0, 0xF, 0x906F, 0x906F, 0x0, "I2M1", "toggle_bit"},
+    {0x4101F, 4, 0x40, 0xC, 1, 0x3F, 0, 0x80F, 0x0, 0x0, 0x13, "D0", "trap"},
+    {0x13019, 1, 0x130, 0xB, 3, 0x19, 0, 0x0, 0x100F, 0x100F, 0x12, "I2", "truth_tab2"},
+    {0x22603, 1, 0x227, 0xE, 4, 0x2, 1, 0x0, 0x1F00, 0x1F00, 0x13, "O5I2", "truth_tab3"},
+    {0x3F, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3F, 0, 0xF, 0xFF, 0xFF, 0x0, "D0", "undef"},
+    {0x37, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x37, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef55"},
+    {0x38, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x38, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef56"},
+    {0x39, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x39, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef57"},
+    {0x3A, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3A, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef58"},
+    {0x3B, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3B, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef59"},
+    {0x3C, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3C, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef60"},
+    {0x3D, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3D, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef61"},
+    {0x3E, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3E, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef62"},
+    {0x13001, 1, 0x130, 0xB, 1, 0x1, 0, 0x6F, 0x6F, 0x6F, 0x0, "R0", "vec2gp"},
+    {0x1203B, 1, 0x120, 0xA, 3, 0x3B, 0, 0x0, 0x100F, 0x100F, 0x0, "R2R3D0", "write_call_stack"},
+    {0x18023, 1, 0x180, 0xB, 2, 0x23, 0, 0x1708, 0x0, 0x0, 0x12, "Y2", "write_capabilities"},
+    {0x1203D, 1, 0x120, 0xA, 3, 0x3D, 0, 0x0, 0x100F, 0x100F, 0x0, "R2R3D0", "write_memory_map"},
+    {0x18021, 1, 0x180, 0xB, 2, 0x21, 0, 0x1708, 0x0, 0x0, 0x12, "Y1", "write_spec"},
+    {0x18027, 1, 0x180, 0xB, 2, 0x27, 0, 0x1708, 0x0, 0x0, 0x12, "Y4", "write_sys"},
+    {0x1F, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x1F, 0, 0xF, 0x906F, 0x906F, 0x0, "", "xor"},
+    {0x1F, 2, 0x2, 0x1, 2, 0xD, 0, 0x8, 0x0, 0x0, 0x0, "", "xor"},
+    {0x1F, 1, 0x110, 0xC, 2, 0x14, 0, 0x8, 0x0, 0x0, 0x6, "", "xor"},
+    {0x1F, 1, 0x290, 0xA, 2, 0x7, 0, 0x8, 0x0, 0x0, 0x9, "", "xor"},
+    {0x1F, 1, 0x131, 0xC, 2, 0x24, 0, 0x0, 0x200, 0x200, 0x3, "", "xor"},
+    {0x1F, 1, 0x132, 0xC, 2, 0x30, 0, 0x0, 0x400, 0x400, 0x6, "", "xor"},
+    {0x1F, 1, 0x132, 0xC, 2, 0x31, 0, 0x0, 0x800, 0x800, 0x6, "", "xor"},
+    {0x10131F, 4, 0x135021, 0x0, 3, 0x1F, 0, 0xF, 0x9060, 0x0, 0x0, "", "xor/jump_nzero"},
+    {0x10121F, 4, 0x135021, 0x0, 3, 0x1E, 0, 0xF, 0x9060, 0x0, 0x0, "", "xor/jump_zero"}
+};
+
+// Instruction records sorted by id, with an empty record at position 0. Used by assembler
+const SInstruction builtinInstructionsById[] = {
+//  id, category, format, templt, sourceoperands, op1, op2, optypesgp, optypesscalar, optypesvector, opimmediate, template_variant, name
+    {0x0, 0, 0x0, 0x0, 0, 0x0, 0, 0x0, 0x0, 0x0, 0x0, "", ""},
+    {0x1, 3, 0xA0900F0FA3F0, 0x0, 1, 0x1, 0, 0xF, 0x906F, 0x906F, 0x0, "M0", "store"},
+    {0x1, 2, 0x5, 0x1, 1, 0xF, 0, 0x8, 0x0, 0x0, 0x0, "M0", "store"},
+    {0x1, 1, 0x258, 0xB, 1, 0x8, 0, 0xFF00, 0xFF00, 0x0, 0x64, "M0", "store"},
+    {0x2, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 1, 0x2, 0, 0xF, 0x906F, 0x906F, 0x0, "", "move"},
+    {0x2, 2, 0x1, 0x1, 1, 0x1, 0, 0x8, 0x0, 0x0, 0x11, "", "move"},
+    {0x2, 2, 0x2, 0x1, 1, 0x8, 0, 0x8, 0x0, 0x0, 0x0, "", "move"},
+    {0x2, 2, 0x4, 0x1, 1, 0xE, 0, 0x8, 0x0, 0x0, 0x0, "", "move"},
+    {0x2, 2, 0xA, 0x1, 1, 0x11, 0, 0x0, 0x8, 0x8, 0x0, "D2", "move"},
+    {0x2, 2, 0x9, 0x1, 1, 0x12, 0, 0x0, 0x20, 0x0, 0x21, "", "move"},
+    {0x2, 2, 0x9, 0x1, 1, 0x13, 0, 0x0, 0x40, 0x0, 0x21, "", "move"},
+    {0x2, 1, 0x110, 0xC, 1, 0x0, 0, 0x8, 0x0, 0x0, 0x3, "", "move"},
+    {0x2, 1, 0x110, 0xC, 1, 0x10, 0, 0x8, 0x0, 0x0, 0x6, "", "move"},
+    {0x2, 1, 0x290, 0xA, 1, 0x0, 0, 0x8, 0x0, 0x0, 0x9, "", "move"},
+    {0x2, 1, 0x131, 0xC, 1, 0x20, 0, 0x0, 0x200, 0x0, 0x3, "", "move"},
+    {0x2, 1, 0x132, 0xC, 1, 0x28, 0, 0x0, 0x400, 0x0, 0x6, "", "move"},
+    {0x2, 1, 0x132, 0xC, 1, 0x29, 0, 0x0, 0x800, 0x0, 0x6, "", "move"},
+    {0x2, 1, 0x133, 0xC, 1, 0x38, 0, 0x0, 0x2000, 0x2000, 0x40, "", "move"},
+    {0x2, 1, 0x133, 0xC, 1, 0x39, 0, 0x0, 0x4000, 0x4000, 0x40, "", "move"},
+    {0x3, 3, 0xA0900F0FA3F0, 0x0, 1, 0x3, 0, 0xF, 0x906F, 0x906F, 0x0, "D04", "prefetch"},
+    {0x4, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 1, 0x4, 0, 0x7, 0x7, 0x7, 0x0, "", "sign_extend"},
+    {0x5, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x5, 0, 0x700, 0x0, 0x0, 0x0, "", "sign_extend_add"},
+    {0x7, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x7, 0, 0xF, 0x906F, 0x906F, 0x0, "O6U3", "compare"},
+    {0x8, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x8, 0, 0xF, 0x906F, 0x906F, 0x0, "", "add"},
+    {0x8, 2, 0x1, 0x1, 2, 0x2, 0, 0x8, 0x0, 0x0, 0x11, "", "add"},
+    {0x8, 2, 0x2, 0x1, 2, 0x9, 0, 0x8, 0x0, 0x0, 0x0, "", "add"},
+    {0x8, 2, 0xA, 0x1, 2, 0x14, 0, 0x0, 0x20, 0x20, 0x0, "", "add"},
+    {0x8, 2, 0xA, 0x1, 2, 0x15, 0, 0x0, 0x40, 0x40, 0x0, "", "add"},
+    {0x8, 1, 0x110, 0xC, 2, 0x2, 0, 0x8, 0x0, 0x0, 0x3, "", "add"},
+    {0x8, 1, 0x110, 0xC, 2, 0x7, 0, 0x8, 0x0, 0x0, 0x8, "", "add"},
+    {0x8, 1, 0x110, 0xC, 2, 0x11, 0, 0x8, 0x0, 0x0, 0x6, "", "add"},
+    {0x8, 1, 0x290, 0xA, 2, 0x2, 0, 0x8, 0x0, 0x0, 0x14, "", "add"},
+    {0x8, 1, 0x290, 0xA, 2, 0x4, 0, 0x8, 0x0, 0x0, 0x9, "", "add"},
+    {0x8, 1, 0x131, 0xC, 2, 0x21, 0, 0x0, 0x200, 0x200, 0x3, "", "add"},
+    {0x8, 1, 0x132, 0xC, 2, 0x2A, 0, 0x0, 0x400, 0x400, 0x6, "", "add"},
+    {0x8, 1, 0x132, 0xC, 2, 0x2B, 0, 0x0, 0x800, 0x800, 0x6, "", "add"},
+    {0x8, 1, 0x133, 0xC, 2, 0x3A, 0, 0x0, 0x2000, 0x2000, 0x40, "", "add"},
+    {0x8, 1, 0x133, 0xC, 2, 0x3B, 0, 0x0, 0x4000, 0x4000, 0x40, "", "add"},
+    {0x9, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x9, 0, 0xF, 0x906F, 0x906F, 0x0, "", "sub"},
+    {0x9, 2, 0x1, 0x1, 2, 0x3, 0, 0x8, 0x0, 0x0, 0x11, "", "sub"},
+    {0x9, 2, 0x2, 0x1, 2, 0xA, 0, 0x8, 0x0, 0x0, 0x0, "", "sub"},
+    {0x9, 2, 0xA, 0x1, 2, 0x16, 0, 0x0, 0x20, 0x20, 0x0, "", "sub"},
+    {0x9, 2, 0xA, 0x1, 2, 0x17, 0, 0x0, 0x40, 0x40, 0x0, "", "sub"},
+    {0x9, 1, 0x290, 0xA, 2, 0x3, 0, 0x8, 0x0, 0x0, 0x14, "", "sub"},
+    {0xA, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0xA, 0, 0xF, 0x906F, 0x906F, 0x0, "", "sub_rev"},
+    {0xB, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0xB, 0, 0xF, 0x906F, 0x9867, 0x0, "", "mul"},
+    {0xB, 2, 0xA, 0x1, 2, 0x18, 0, 0x0, 0x20, 0x20, 0x0, "", "mul"},
+    {0xB, 2, 0xA, 0x1, 2, 0x19, 0, 0x0, 0x40, 0x40, 0x0, "", "mul"},
+    {0xB, 1, 0x110, 0xC, 2, 0x5, 0, 0x8, 0x0, 0x0, 0x3, "", "mul"},
+    {0xB, 1, 0x133, 0xC, 2, 0x3C, 0, 0x0, 0x2000, 0x2000, 0x40, "", "mul"},
+    {0xB, 1, 0x133, 0xC, 2, 0x3D, 0, 0x0, 0x4000, 0x4000, 0x40, "", "mul"},
+    {0xC, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0xC, 0, 0xB04, 0x1B04, 0x1F00, 0x0, "", "mul_hi"},
+    {0xD, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0xD, 0, 0xB04, 0x1B04, 0x1F00, 0x0, "U0", "mul_hi_u"},
+    {0xE, 3, 0xFF000FF00C0FC, 0x0, 2, 0xE, 0, 0xB04, 0x1B04, 0x1F00, 0x0, "", "mul_ex"},
+    {0xF, 3, 0xFF000FF00C0FC, 0x0, 2, 0xF, 0, 0xB04, 0x1B04, 0x1F00, 0x0, "U0", "mul_ex_u"},
+    {0x10, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x10, 0, 0xF, 0x906F, 0xFF00, 0x0, "O4", "div"},
+    {0x10, 1, 0x110, 0xC, 2, 0x6, 0, 0x8, 0x0, 0x0, 0x3, "", "div"},
+    {0x11, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x11, 0, 0xF, 0x100F, 0x100F, 0x0, "O4U0", "div_u"},
+    {0x12, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x12, 0, 0xF, 0x906F, 0xFF00, 0x0, "O4", "div_rev"},
+    {0x14, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x14, 0, 0xF, 0x906F, 0xFF00, 0x0, "", "rem"},
+    {0x15, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x15, 0, 0xF, 0xF, 0xF00, 0x0, "U0", "rem_u"},
+    {0x16, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x16, 0, 0xF, 0x906F, 0x906F, 0x0, "", "min"},
+    {0x17, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x17, 0, 0xF, 0x100F, 0x100F, 0x0, "U0", "min_u"},
+    {0x17, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x17, 0, 0x8060, 0x8060, 0x8060, 0x0, "", "min_abs"},
+    {0x18, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x18, 0, 0xF, 0x906F, 0x906F, 0x0, "", "max"},
+    {0x19, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x19, 0, 0xF, 0x100F, 0x100F, 0x0, "U0", "max_u"},
+    {0x19, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x19, 0, 0x8060, 0x8060, 0x8060, 0x0, "", "max_abs"},
+    {0x1C, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x1C, 0, 0xF, 0x906F, 0x906F, 0x0, "", "and"},
+    {0x1C, 2, 0x2, 0x1, 2, 0xB, 0, 0x8, 0x0, 0x0, 0x0, "", "and"},
+    {0x1C, 1, 0x110, 0xC, 2, 0x12, 0, 0x8, 0x0, 0x0, 0x6, "", "and"},
+    {0x1C, 1, 0x290, 0xA, 2, 0x5, 0, 0x8, 0x0, 0x0, 0x9, "", "and"},
+    {0x1C, 1, 0x131, 0xC, 2, 0x22, 0, 0x0, 0x200, 0x200, 0x3, "", "and"},
+    {0x1C, 1, 0x132, 0xC, 2, 0x2C, 0, 0x0, 0x400, 0x400, 0x6, "", "and"},
+    {0x1C, 1, 0x132, 0xC, 2, 0x2D, 0, 0x0, 0x800, 0x800, 0x6, "", "and"},
+    {0x1D, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x1D, 0, 0xF, 0x906F, 0x906F, 0x0, "", "and_not"},
+    {0x1E, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x1E, 0, 0xF, 0x906F, 0x906F, 0x0, "", "or"},
+    {0x1E, 2, 0x2, 0x1, 2, 0xC, 0, 0x8, 0x0, 0x0, 0x0, "", "or"},
+    {0x1E, 1, 0x110, 0xC, 2, 0x13, 0, 0x8, 0x0, 0x0, 0x6, "", "or"},
+    {0x1E, 1, 0x290, 0xA, 2, 0x6, 0, 0x8, 0x0, 0x0, 0x9, "", "or"},
+    {0x1E, 1, 0x131, 0xC, 2, 0x23, 0, 0x0, 0x200, 0x200, 0x3, "", "or"},
+    {0x1E, 1, 0x132, 0xC, 2, 0x2E, 0, 0x0, 0x400, 0x400, 0x6, "", "or"},
+    {0x1E, 1, 0x132, 0xC, 2, 0x2F, 0, 0x0, 0x800, 0x800, 0x6, "", "or"},
+    {0x1F, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x1F, 0, 0xF, 0x906F, 0x906F, 0x0, "", "xor"},
+    {0x1F, 2, 0x2, 0x1, 2, 0xD, 0, 0x8, 0x0, 0x0, 0x0, "", "xor"},
+    {0x1F, 1, 0x110, 0xC, 2, 0x14, 0, 0x8, 0x0, 0x0, 0x6, "", "xor"},
+    {0x1F, 1, 0x290, 0xA, 2, 0x7, 0, 0x8, 0x0, 0x0, 0x9, "", "xor"},
+    {0x1F, 1, 0x131, 0xC, 2, 0x24, 0, 0x0, 0x200, 0x200, 0x3, "", "xor"},
+    {0x1F, 1, 0x132, 0xC, 2, 0x30, 0, 0x0, 0x400, 0x400, 0x6, "", "xor"},
+    {0x1F, 1, 0x132, 0xC, 2, 0x31, 0, 0x0, 0x800, 0x800, 0x6, "", "xor"},
+    {0x20, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x20, 0, 0x100F, 0x100F, 0x100F, 0x0, "I2M1", "shift_left"},
+    {0x20, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x20, 0, 0x0, 0x8060, 0x8060, 0x0, "I2M1", "mul_2pow"},
+    {0x20, 2, 0x1, 0x1, 2, 0x4, 0, 0x8, 0x0, 0x0, 0x11, "U0", "shift_left"},
+    {0x21, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x21, 0, 0x100F, 0x100F, 0x100F, 0x0, "I2M1", "rotate"},
+    {0x22, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x22, 0, 0x100F, 0x100F, 0x100F, 0x0, "I2M1", "shift_right_s"},
+    {0x23, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x23, 0, 0x100F, 0x100F, 0x100F, 0x0, "I2M1U0", "shift_right_u"},
+    {0x23, 2, 0x1, 0x1, 2, 0x5, 0, 0x8, 0x0, 0x0, 0x11, "U0", "shift_right_u"},
+    {0x24, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x24, 0, 0xF, 0x906F, 0x906F, 0x0, "I2M1", "set_bit"},
+    {0x25, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x25, 0, 0xF, 0x906F, 0x906F, 0x0, "I2M1", "clear_bit"},
+    {0x26, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x26, 0, 0xF, 0x906F, 0x906F, 0x0, "I2M1", "toggle_bit"},
+    {0x27, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x27, 0, 0xF, 0x906F, 0x906F, 0x0, "I2M1", "and_bit"},
+    {0x28, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x28, 0, 0xF, 0x906F, 0x906F, 0x0, "I2M1O5", "test_bit"},
+    {0x29, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x29, 0, 0xF, 0x906F, 0x906F, 0x0, "O5", "test_bits"},
+    {0x2A, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x2A, 0, 0xF, 0x906F, 0x906F, 0x0, "O5", "test_bits_all1"},
+    {0x30, 3, 0xFFFFFFFFF700F, 0x0, 3, 0x30, 0, 0xF00, 0xFF00, 0xFF00, 0x0, "O4", "mul_add"},
+    {0x31, 3, 0xFFFFFFFFF700F, 0x0, 3, 0x31, 0, 0xF00, 0xFF00, 0xFF00, 0x0, "O4", "mul_add2"},
+    {0x32, 3, 0xFFFFFFFFF700F, 0x0, 3, 0x32, 0, 0xF00, 0xFF00, 0xFF00, 0x0, "O3", "add_add"},
+    {0x37, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x37, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef55"},
+    {0x38, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x38, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef56"},
+    {0x39, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x39, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef57"},
+    {0x3A, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3A, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef58"},
+    {0x3B, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3B, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef59"},
+    {0x3C, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3C, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef60"},
+    {0x3D, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3D, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef61"},
+    {0x3E, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3E, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef62"},
+    {0x3F, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3F, 0, 0xF, 0xFF, 0xFF, 0x0, "D0", "undef"},
+    {0x50, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "test"},
+    {0x51, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "increment_compare"},
+    {0x52, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x12, "", "sub_maxlen"},
+    {0x10001, 1, 0x100, 0xA, 1, 0x1, 0, 0x1F00, 0x0, 0x0, 0x0, "", "bitscan_f"},
+    {0x10001, 1, 0x130, 0xB, 1, 0x16, 0, 0x0, 0x100F, 0x1F00, 0x0, "", "bitscan_f"},
+    {0x10002, 1, 0x100, 0xA, 1, 0x2, 0, 0x1F00, 0x0, 0x0, 0x0, "", "bitscan_r"},
+    {0x10002, 1, 0x130, 0xB, 1, 0x17, 0, 0x0, 0x100F, 0x1F00, 0x0, "", "bitscan_r"},
+    {0x10003, 1, 0x100, 0xA, 1, 0x3, 0, 0x100F, 0x0, 0x0, 0x0, "", "round_d2"},
+    {0x10004, 1, 0x100, 0xA, 1, 0x4, 0, 0x100F, 0x0, 0x0, 0x0, "", "round_u2"},
+    {0x11001, 1, 0x110, 0xC, 1, 0x1, 0, 0x8, 0x0, 0x0, 0x13, "U0", "move_u"},
+    {0x12000, 1, 0x120, 0xA, 2, 0x0, 0, 0x0, 0x906F, 0x906F, 0x0, "R1RL", "set_len"},
+    {0x12001, 1, 0x120, 0xA, 1, 0x1, 0, 0x0, 0x906F, 0x906F, 0x0, "R0", "get_len"},
+    {0x12002, 1, 0x120, 0xA, 2, 0x2, 0, 0x0, 0x906F, 0x906F, 0x0, "R1", "set_num"},
+    {0x12003, 1, 0x120, 0xA, 1, 0x3, 0, 0x0, 0x906F, 0x906F, 0x0, "R0", "get_num"},
+    {0x12004, 1, 0x120, 0xA, 2, 0x4, 0, 0x0, 0xB04E, 0xB04E, 0x0, "R1RL", "compress"},
+    {0x12005, 1, 0x120, 0xA, 2, 0x5, 0, 0x0, 0xFE00, 0xFE00, 0x0, "R1RL", "compress_ss"},
+    {0x12006, 1, 0x120, 0xA, 2, 0x6, 0, 0x0, 0xFE00, 0xFE00, 0x0, "R1RL", "compress_us"},
+    {0x12007, 1, 0x120, 0xA, 2, 0x7, 0, 0x0, 0xB04E, 0xB04E, 0x0, "R1RL", "expand"},
+    {0x12008, 1, 0x120, 0xA, 2, 0x8, 0, 0x0, 0x100E, 0x100E, 0x0, "R1RL", "expand_u"},
+    {0x12009, 1, 0x120, 0xA, 2, 0x9, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R1RL", "compress_sparse"},
+    {0x1200A, 1, 0x120, 0xA, 2, 0xA, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R1RL", "expand_sparse"},
+    {0x1200B, 1, 0x120, 0xA, 2, 0xB, 0, 0x0, 0xFF, 0xFF, 0x0, "R1", "extract"},
+    {0x1200C, 1, 0x120, 0xA, 2, 0xC, 0, 0x0, 0xFF, 0xFF, 0x0, "R1", "insert"},
+    {0x1200D, 1, 0x120, 0xA, 2, 0xD, 0, 0x0, 0xFF, 0xFF, 0x0, "R1RL", "broad"},
+    {0x1200D, 1, 0x130, 0xB, 2, 0x12, 0, 0x0, 0x906F, 0x906F, 0x2, "R1RL", "broad"},
+    {0x1200D, 1, 0x260, 0xA, 2, 0x6, 0, 0x0, 0x906F, 0x906F, 0x64, "R1RL", "broad"},
+    {0x1200E, 1, 0x120, 0xA, 2, 0xE, 0, 0x0, 0x906F, 0x906F, 0x0, "R1", "bits2bool"},
+    {0x1200F, 1, 0x120, 0xA, 2, 0xF, 0, 0x0, 0x906F, 0x906F, 0x0, "R1RL", "bool2bits"},
+    {0x12010, 1, 0x120, 0xA, 2, 0x10, 0, 0x0, 0x906F, 0x906F, 0x0, "R1RL", "bool_reduce"},
+    {0x12012, 1, 0x120, 0xA, 2, 0x12, 0, 0x0, 0xFF, 0xFF, 0x0, "R1", "shift_expand"},
+    {0x12013, 1, 0x120, 0xA, 2, 0x13, 0, 0x0, 0xFF, 0xFF, 0x0, "R1", "shift_reduce"},
+    {0x12014, 1, 0x120, 0xA, 2, 0x14, 0, 0x0, 0x906F, 0x906F, 0x0, "R1", "shift_up"},
+    {0x12015, 1, 0x120, 0xA, 2, 0x15, 0, 0x0, 0x906F, 0x906F, 0x0, "R1", "shift_down"},
+    {0x12016, 1, 0x120, 0xA, 2, 0x16, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R1", "rotate_up"},
+    {0x12017, 1, 0x120, 0xA, 2, 0x17, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R1", "rotate_down"},
+    {0x12018, 1, 0x120, 0xA, 2, 0x18, 0, 0x0, 0x1906, 0x1F00, 0x0, "", "div_ex"},
+    {0x12019, 1, 0x120, 0xA, 2, 0x19, 0, 0x0, 0x1906, 0x1F00, 0x0, "U0", "div_ex_u"},
+    {0x1201A, 1, 0x120, 0xA, 1, 0x1A, 0, 0x0, 0xE000, 0xE000, 0x0, "", "sqrt"},
+    {0x1201C, 1, 0x120, 0xA, 2, 0x1C, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "add_c"},
+    {0x1201D, 1, 0x120, 0xA, 2, 0x1D, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "sub_b"},
+    {0x1201E, 1, 0x120, 0xA, 2, 0x1E, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "add_ss"},
+    {0x1201F, 1, 0x120, 0xA, 2, 0x1F, 0, 0x0, 0x1F00, 0x1F00, 0x0, "U0", "add_us"},
+    {0x12020, 1, 0x120, 0xA, 2, 0x20, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "sub_ss"},
+    {0x12021, 1, 0x120, 0xA, 2, 0x21, 0, 0x0, 0x1F00, 0x1F00, 0x0, "U0", "sub_us"},
+    {0x12022, 1, 0x120, 0xA, 2, 0x22, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "mul_ss"},
+    {0x12023, 1, 0x120, 0xA, 2, 0x23, 0, 0x0, 0x1F00, 0x1F00, 0x0, "U0", "mul_us"},
+    {0x12024, 1, 0x120, 0xA, 2, 0x24, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "shift_ss"},
+    {0x12025, 1, 0x120, 0xA, 2, 0x25, 0, 0x0, 0x1F00, 0x1F00, 0x0, "U0", "shift_us"},
+    {0x12026, 1, 0x120, 0xA, 2, 0x26, 0, 0x0, 0xFF00, 0xFF00, 0x0, "", "add_oc"},
+    {0x12027, 1, 0x120, 0xA, 2, 0x27, 0, 0x0, 0xFF00, 0xFF00, 0x0, "", "sub_oc"},
+    {0x12029, 1, 0x120, 0xA, 2, 0x29, 0, 0x0, 0xFF00, 0xFF00, 0x0, "", "mul_oc"},
+    {0x1202A, 1, 0x120, 0xA, 2, 0x2A, 0, 0x0, 0xFF00, 0xFF00, 0x0, "", "div_oc"},
+    {0x1203A, 1, 0x120, 0xA, 2, 0x3A, 0, 0x0, 0x100F, 0x100F, 0x0, "R1R2", "read_call_stack"},
+    {0x1203B, 1, 0x120, 0xA, 3, 0x3B, 0, 0x0, 0x100F, 0x100F, 0x0, "R2R3D0", "write_call_stack"},
+    {0x1203C, 1, 0x120, 0xA, 2, 0x3C, 0, 0x0, 0x100F, 0x100F, 0x0, "R1R2", "read_memory_map"},
+    {0x1203D, 1, 0x120, 0xA, 3, 0x3D, 0, 0x0, 0x100F, 0x100F, 0x0, "R2R3D0", "write_memory_map"},
+    {0x1203E, 1, 0x120, 0xA, 2, 0x3E, 0, 0x0, 0x100F, 0x100F, 0x0, "R1R2", "input"},
+    {0x1203F, 1, 0x120, 0xA, 3, 0x3F, 0, 0x0, 0x100F, 0x100F, 0x0, "R2R3D1", "output"},
+    {0x13000, 1, 0x130, 0xB, 1, 0x0, 0, 0x6F, 0x6F, 0x0, 0x0, "R1", "gp2vec"},
+    {0x13001, 1, 0x130, 0xB, 1, 0x1, 0, 0x6F, 0x6F, 0x6F, 0x0, "R0", "vec2gp"},
+    {0x13002, 1, 0x130, 0xB, 2, 0x2, 0, 0x0, 0x100F, 0x100F, 0x12, "R1", "read_spev"},
+    {0x13004, 1, 0x130, 0xB, 2, 0x4, 0, 0x0, 0xF00F, 0xF00F, 0x2, "R1", "make_sequence"},
+    {0x1300C, 1, 0x130, 0xB, 2, 0xC, 0, 0x0, 0x8060, 0x8060, 0x12, "I2", "float2int"},
+    {0x1300D, 1, 0x130, 0xB, 1, 0xD, 0, 0x0, 0x100C, 0x100C, 0x0, "", "int2float"},
+    {0x1300E, 1, 0x130, 0xB, 2, 0xE, 0, 0x0, 0x8060, 0x8060, 0x12, "I2", "round"},
+    {0x1300F, 1, 0x130, 0xB, 2, 0xF, 0, 0x0, 0xE000, 0xE000, 0x2, "I2", "round2n"},
+    {0x13011, 1, 0x130, 0xB, 2, 0x11, 0, 0x0, 0x8060, 0x8060, 0x12, "I2", "fp_category"},
+    {0x13013, 1, 0x130, 0xB, 1, 0x13, 0, 0x0, 0x906F, 0x906F, 0x2, "", "broadcast_max"},
+    {0x13014, 1, 0x130, 0xB, 1, 0x14, 0, 0x0, 0x100F, 0x100F, 0x0, "", "byte_reverse"},
+    {0x13015, 1, 0x130, 0xB, 1, 0x15, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "bit_reverse"},
+    {0x13018, 1, 0x130, 0xB, 1, 0x18, 0, 0x0, 0x100F, 0x1F00, 0x0, "", "popcount"},
+    {0x13019, 1, 0x130, 0xB, 3, 0x19, 0, 0x0, 0x100F, 0x100F, 0x12, "I2", "truth_tab2"},
+    {0x18001, 1, 0x180, 0xB, 3, 0x1, 0, 0x100F, 0x0, 0x0, 0x12, "", "shift_add"},
+    {0x18020, 1, 0x180, 0xB, 2, 0x20, 0, 0x1708, 0x0, 0x0, 0x12, "X1", "read_spec"},
+    {0x18021, 1, 0x180, 0xB, 2, 0x21, 0, 0x1708, 0x0, 0x0, 0x12, "Y1", "write_spec"},
+    {0x18022, 1, 0x180, 0xB, 2, 0x22, 0, 0x1708, 0x0, 0x0, 0x12, "X2", "read_capabilities"},
+    {0x18023, 1, 0x180, 0xB, 2, 0x23, 0, 0x1708, 0x0, 0x0, 0x12, "Y2", "write_capabilities"},
+    {0x18024, 1, 0x180, 0xB, 2, 0x24, 0, 0x1708, 0x0, 0x0, 0x12, "X3", "read_perf"},
+    {0x18025, 1, 0x180, 0xB, 2, 0x25, 0, 0x1708, 0x0, 0x0, 0x12, "X3", "read_perfs"},
+    {0x18026, 1, 0x180, 0xB, 2, 0x26, 0, 0x1708, 0x0, 0x0, 0x12, "X4", "read_sys"},
+    {0x18027, 1, 0x180, 0xB, 2, 0x27, 0, 0x1708, 0x0, 0x0, 0x12, "Y4", "write_sys"},
+    {0x20000, 2, 0x1, 0x1, 0, 0x0, 0, 0xF, 0x0, 0x0, 0x0, "D0", "nop_t"},
+    {0x20010, 2, 0x8, 0x1, 0, 0x10, 0, 0x0, 0x8, 0x8, 0x0, "D2", "clear"},
+    {0x2001C, 2, 0xB, 0x1, 2, 0x1C, 0, 0x8, 0xFF, 0xFF, 0x0, "R0R1", "add_cps"},
+    {0x2001D, 2, 0xB, 0x1, 2, 0x1D, 0, 0x8, 0xFF, 0xFF, 0x0, "R0R1", "sub_cps"},
+    {0x2001E, 2, 0xC, 0x1, 1, 0x1E, 0, 0x0, 0xFF, 0xFF, 0x0, "D2", "restore_cp"},
+    {0x2001F, 2, 0xD, 0x1, 1, 0x1F, 0, 0x0, 0xFF, 0xFF, 0x0, "M0D2", "save_cp"},
+    {0x22600, 1, 0x226, 0xE, 3, 0x0, 1, 0x0, 0x906F, 0x906F, 0x0, "R2RL", "concatenate"},
+    {0x22601, 1, 0x226, 0xE, 3, 0x1, 1, 0x0, 0x906F, 0x906F, 0x0, "R2RL", "permute"},
+    {0x22601, 1, 0x260, 0xA, 3, 0x8, 0, 0x0, 0x906F, 0x906F, 0x14, "I2R1RL", "permute"},
+    {0x22602, 1, 0x226, 0xE, 3, 0x2, 1, 0x0, 0x0, 0xFF00, 0x0, "R2RL", "interleave"},
+    {0x22603, 1, 0x227, 0xE, 4, 0x2, 1, 0x0, 0x1F00, 0x1F00, 0x13, "O5I2", "truth_tab3"},
+    {0x22608, 1, 0x227, 0xE, 3, 0x3, 1, 0x0, 0x0, 0xFC00, 0x13, "R1RLI2", "repeat_block"},
+    {0x22609, 1, 0x227, 0xE, 3, 0x4, 1, 0x0, 0x0, 0xFC00, 0x13, "R1RLI2", "repeat_within_blocks"},
+    {0x25910, 1, 0x259, 0xA, 2, 0x10, 0, 0xFF00, 0x0, 0x0, 0x12, "D1", "fence"},
+    {0x25912, 1, 0x259, 0xA, 3, 0x12, 0, 0xFF00, 0xFF00, 0x0, 0x0, "D1", "compare_swap"},
+    {0x25A18, 1, 0x25A, 0xA, 3, 0x18, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R2", "read_insert"},
+    {0x25A20, 1, 0x25A, 0xA, 2, 0x20, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R2M0", "extract_store"},
+    {0x26000, 1, 0x260, 0xA, 1, 0x0, 0, 0x0, 0x906F, 0x906F, 0x64, "", "load_hi"},
+    {0x26002, 1, 0x260, 0xA, 2, 0x2, 0, 0x0, 0x906F, 0x906F, 0x14, "", "make_mask"},
+    {0x26004, 1, 0x260, 0xA, 2, 0x4, 0, 0x0, 0x906F, 0x906F, 0x64, "", "replace_even"},
+    {0x26005, 1, 0x260, 0xA, 2, 0x5, 0, 0x0, 0x906F, 0x906F, 0x64, "", "replace_odd"},
+    {0x26009, 1, 0x290, 0xA, 2, 0x9, 0, 0x1F00, 0x0, 0x0, 0x1D, "O6", "replace_bits"},
+    {0x26009, 1, 0x260, 0xA, 2, 0x9, 0, 0x0, 0x1F00, 0x1F00, 0x1D, "O6", "replace_bits"},
+    {0x28700, 1, 0x207, 0xE, 3, 0x0, 1, 0x1F00, 0x0, 0x0, 0x19, "O6I2", "move_bits"},
+    {0x28700, 1, 0x227, 0xE, 3, 0x0, 1, 0x0, 0x1F00, 0x1F00, 0x19, "O6I2", "move_bits"},
+    {0x28701, 1, 0x227, 0xE, 3, 0x1, 1, 0x0, 0x100F, 0x100F, 0x12, "R1RLO5", "mask_length"},
+    {0x29001, 1, 0x290, 0xA, 2, 0x1, 0, 0x8, 0x0, 0x0, 0x14, "", "insert_hi"},
+    {0x29001, 1, 0x260, 0xA, 2, 0x1, 0, 0x0, 0x906F, 0x906F, 0x64, "", "insert_hi"},
+    {0x29020, 1, 0x291, 0xA, 1, 0x20, 0, 0x8, 0x0, 0x0, 0x0, "X0", "address"},
+    {0x30000, 3, 0xFFF, 0x0, 0, 0x0, 0, 0xF, 0xFF, 0x0, 0x0, "D0", "nop"},
+    {0x30200, 3, 0xFFFFF000, 0x0, 0, 0x0, 0, 0xF, 0xFF, 0x0, 0x0, "D0", "nop2"},
+    {0x30300, 3, 0xFFFFF00000000, 0x0, 0, 0x0, 0, 0xF, 0xFF, 0x0, 0x0, "D0", "nop3"},
+    {0x4001E, 4, 0x8, 0xB, 0, 0x3E, 0, 0xF, 0x0, 0x0, 0x0, "D0", "return"},
+    {0x4001F, 4, 0x8, 0xA, 3, 0x3F, 0, 0xF, 0x0, 0x0, 0x0, "D1", "sys_call"},
+    {0x4001F, 4, 0x8000, 0xB, 3, 0x3F, 0, 0x80F, 0x0, 0x0, 0x1A, "D0", "sys_call"},
+    {0x4001F, 4, 0x80000, 0xB, 4, 0x3F, 0, 0x80F, 0x0, 0x0, 0x1B, "D0", "sys_call"},
+    {0x4001F, 4, 0x2000000, 0xB, 3, 0x3F, 0, 0x80F, 0x0, 0x0, 0x1C, "D0", "sys_call"},
+    {0x4101E, 4, 0x80, 0xC, 0, 0x3E, 0, 0xF, 0x0, 0x0, 0x0, "D0", "sys_return"},
+    {0x4101F, 4, 0x40, 0xC, 1, 0x3F, 0, 0x80F, 0x0, 0x0, 0x13, "D0", "trap"},
+    {0x4101F, 4, 0x40, 0xC, 0, 0x3F, 0, 0xFF, 0xFF, 0x0, 0x0, "D0", "filler"},
+    {0x42207, 4, 0x40000, 0xC, 2, 0x3F, 0, 0x8, 0x0, 0x0, 0x14, "D0", "compare_trap_uabove"},
+    {0x50008, 1, 0x120, 0xA, 2, 0x30, 0, 0x0, 0x200, 0x200, 0x0, "H0", "add_h"},
+    {0x50008, 1, 0x131, 0xC, 2, 0x25, 0, 0x0, 0x200, 0x200, 0x40, "H0", "add_h"},
+    {0x50009, 1, 0x120, 0xA, 2, 0x31, 0, 0x0, 0x200, 0x200, 0x0, "H0", "sub_h"},
+    {0x5000B, 1, 0x120, 0xA, 2, 0x32, 0, 0x0, 0x200, 0x200, 0x0, "H0", "mul_h"},
+    {0x5000B, 1, 0x131, 0xC, 2, 0x26, 0, 0x0, 0x200, 0x200, 0x40, "H0", "mul_h"},
+    {0x50010, 1, 0x120, 0xA, 2, 0x33, 0, 0x0, 0x200, 0x200, 0x0, "H0", "div_h"},
+    {0x50030, 1, 0x120, 0xA, 3, 0x34, 0, 0x0, 0x200, 0x200, 0x0, "H0", "mul_add_h"},
+    {0xA0000, 1, 0x180, 0xB, 2, 0x0, 0, 0x100F, 0x0, 0x0, 0x12, "", "abs"},
+    {0xA0000, 1, 0x130, 0xB, 2, 0x10, 0, 0x0, 0xF00F, 0xF00F, 0x2, "I2", "abs"},
+    {0xA0001, 1, 0x260, 0xA, 2, 0x3, 0, 0x0, 0x906F, 0x906F, 0x64, "", "replace"},
+    {0xA0001, 1, 0x318, 0xA, 2, 0x8, 0, 0x0, 0x906F, 0x906F, 0x64, "", "replace"},
+    {0x101000, 4, 0x2002, 0xB, 1, 0x3A, 0, 0xF, 0x0, 0x0, 0x0, "D0", "jump"},
+    {0x101000, 4, 0x10, 0xD, 1, 0x0, 0, 0xF, 0x0, 0x0, 0x0, "D0", "jump"},
+    {0x101000, 4, 0x10040, 0xC, 1, 0x3A, 0, 0xF, 0x0, 0x0, 0x0, "D0", "jump"},
+    {0x101000, 4, 0x100000, 0xC, 1, 0x3A, 0, 0xF, 0x0, 0x0, 0x15, "D0", "jump"},
+    {0x101000, 4, 0x2004, 0xA, 2, 0x3C, 0, 0xF, 0x0, 0x0, 0x0, "D1", "jump"},
+    {0x101000, 4, 0x80, 0xC, 1, 0x3C, 0, 0xF, 0x0, 0x0, 0x0, "D0", "jump"},
+    {0x101008, 4, 0x35021, 0x0, 3, 0x37, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump"},
+    {0x101009, 4, 0x35021, 0x0, 3, 0x36, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump"},
+    {0x101100, 4, 0x2002, 0xB, 1, 0x3B, 0, 0xF, 0x0, 0x0, 0x0, "D0", "call"},
+    {0x101100, 4, 0x10, 0xD, 1, 0x8, 0, 0xF, 0x0, 0x0, 0x0, "D0", "call"},
+    {0x101100, 4, 0x10040, 0xC, 1, 0x3B, 0, 0xF, 0x0, 0x0, 0x0, "D0", "call"},
+    {0x101100, 4, 0x100000, 0xC, 1, 0x3B, 0, 0xF, 0x0, 0x0, 0x15, "D0", "call"},
+    {0x101100, 4, 0x2004, 0xA, 2, 0x3D, 0, 0xF, 0x0, 0x0, 0x0, "D1", "call"},
+    {0x101100, 4, 0x80, 0xC, 1, 0x3D, 0, 0xF, 0x0, 0x0, 0x0, "D0", "call"},
+    {0x101200, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_zero"},
+    {0x101200, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_eq"},
+    {0x101200, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_equal"},
+    {0x101200, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_all1"},
+    {0x101207, 4, 0x135021, 0x0, 3, 0x20, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_eq"},
+    {0x101208, 4, 0x135021, 0x0, 3, 0x10, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_zero"},
+    {0x101209, 4, 0x135001, 0xB, 3, 0x0, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_zero"},
+    {0x10121C, 4, 0x135021, 0x0, 3, 0x1A, 0, 0xF, 0x9060, 0x0, 0x0, "", "and/jump_zero"},
+    {0x10121E, 4, 0x135021, 0x0, 3, 0x1C, 0, 0xF, 0x9060, 0x0, 0x0, "", "or/jump_zero"},
+    {0x10121F, 4, 0x135021, 0x0, 3, 0x1E, 0, 0xF, 0x9060, 0x0, 0x0, "", "xor/jump_zero"},
+    {0x101220, 4, 0x135001, 0x0, 3, 0xA, 0, 0xF, 0x9060, 0x0, 0x0, "I2", "shift_left/jump_zero"},
+    {0x101223, 4, 0x135001, 0x0, 3, 0xC, 0, 0xF, 0x9060, 0x0, 0x0, "U0I2", "shift_right_u/jump_zero"},
+    {0x101228, 4, 0x135021, 0x0, 3, 0x2A, 0, 0xF, 0x9060, 0x0, 0x0, "D1I2", "test_bit/jump_zero"},
+    {0x101250, 4, 0x135021, 0x0, 3, 0x2C, 0, 0xF, 0x9060, 0x0, 0x0, "D1I2", "test/jump_all1"},
+    {0x101300, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_nzero"},
+    {0x101300, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_neq"},
+    {0x101300, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_notequal"},
+    {0x101300, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_nall1"},
+    {0x101307, 4, 0x135021, 0x0, 3, 0x21, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_neq"},
+    {0x101308, 4, 0x135021, 0x0, 3, 0x11, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_nzero"},
+    {0x101309, 4, 0x135001, 0xB, 3, 0x1, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_nzero"},
+    {0x10131C, 4, 0x135021, 0x0, 3, 0x1B, 0, 0xF, 0x9060, 0x0, 0x0, "", "and/jump_nzero"},
+    {0x10131E, 4, 0x135021, 0x0, 3, 0x1D, 0, 0xF, 0x9060, 0x0, 0x0, "", "or/jump_nzero"},
+    {0x10131F, 4, 0x135021, 0x0, 3, 0x1F, 0, 0xF, 0x9060, 0x0, 0x0, "", "xor/jump_nzero"},
+    {0x101320, 4, 0x135001, 0x0, 3, 0xB, 0, 0xF, 0x9060, 0x0, 0x0, "I2", "shift_left/jump_nzero"},
+    {0x101323, 4, 0x135001, 0x0, 3, 0xD, 0, 0xF, 0x9060, 0x0, 0x0, "U0I2", "shift_right_u/jump_nzero"},
+    {0x101328, 4, 0x135021, 0x0, 3, 0x2B, 0, 0xF, 0x9060, 0x0, 0x0, "D1I2", "test_bit/jump_nzero"},
+    {0x101350, 4, 0x135021, 0x0, 3, 0x2D, 0, 0xF, 0x9060, 0x0, 0x0, "D1I2", "test/jump_nall1"},
+    {0x101400, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_pos"},
+    {0x101400, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_sabove"},
+    {0x101400, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_above"},
+    {0x101407, 4, 0x135021, 0x0, 3, 0x24, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_sabove"},
+    {0x101408, 4, 0x135021, 0x0, 3, 0x14, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_pos"},
+    {0x101409, 4, 0x135001, 0xB, 3, 0x4, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_pos"},
+    {0x101451, 4, 0x135021, 0x0, 3, 0x32, 0, 0xF, 0x1000, 0x0, 0x0, "O4", "increment_compare/jump_sabove"},
+    {0x101452, 4, 0x10001, 0x0, 3, 0x34, 0, 0xF, 0x0, 0x0, 0x12, "", "sub_maxlen/jump_pos"},
+    {0x101500, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_npos"},
+    {0x101500, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_sbeloweq"},
+    {0x101500, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_beloweq"},
+    {0x101507, 4, 0x135021, 0x0, 3, 0x25, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_sbeloweq"},
+    {0x101508, 4, 0x135021, 0x0, 3, 0x15, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_npos"},
+    {0x101509, 4, 0x135001, 0xB, 3, 0x5, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_npos"},
+    {0x101551, 4, 0x135021, 0x0, 3, 0x33, 0, 0xF, 0x1000, 0x0, 0x0, "O4", "increment_compare/jump_sbeloweq"},
+    {0x101552, 4, 0x10001, 0x0, 3, 0x35, 0, 0xF, 0x0, 0x0, 0x12, "", "sub_maxlen/jump_npos"},
+    {0x101600, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_neg"},
+    {0x101600, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_sbelow"},
+    {0x101600, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_below"},
+    {0x101607, 4, 0x135021, 0x0, 3, 0x22, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_sbelow"},
+    {0x101608, 4, 0x135021, 0x0, 3, 0x12, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_neg"},
+    {0x101609, 4, 0x135001, 0xB, 3, 0x2, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_neg"},
+    {0x101700, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_nneg"},
+    {0x101700, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_saboveeq"},
+    {0x101700, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_aboveeq"},
+    {0x101707, 4, 0x135021, 0x0, 3, 0x23, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_saboveeq"},
+    {0x101708, 4, 0x135021, 0x0, 3, 0x13, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_nneg"},
+    {0x101709, 4, 0x135001, 0xB, 3, 0x3, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_nneg"},
+    {0x101800, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_overfl"},
+    {0x101808, 4, 0x135021, 0x0, 3, 0x16, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_overfl"},
+    {0x101809, 4, 0x135001, 0xB, 3, 0x6, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_overfl"},
+    {0x101900, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_noverfl"},
+    {0x101908, 4, 0x135021, 0x0, 3, 0x17, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_noverfl"},
+    {0x101909, 4, 0x135001, 0xB, 3, 0x7, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_noverfl"},
+    {0x102000, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "U0", "jump_borrow"},
+    {0x102000, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "U0", "jump_nborrow"},
+    {0x102000, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_carry"},
+    {0x102000, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1U0", "jump_ubelow"},
+    {0x102000, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_absbelow"},
+    {0x102007, 4, 0x135021, 0x0, 3, 0x26, 0, 0xF, 0x1000, 0x0, 0x0, "D1U0O4", "compare/jump_ubelow"},
+    {0x102007, 4, 0x135021, 0x0, 3, 0x26, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_absbelow"},
+    {0x102008, 4, 0x135021, 0x0, 3, 0x18, 0, 0xF, 0x1000, 0x0, 0x0, "U0", "add/jump_carry"},
+    {0x102009, 4, 0x135001, 0xB, 3, 0x8, 0, 0xF, 0x1000, 0x0, 0x0, "U0", "sub/jump_borrow"},
+    {0x102009, 4, 0x135001, 0xB, 3, 0x9, 0, 0xF, 0x1000, 0x0, 0x0, "U0", "sub/jump_nborrow"},
+    {0x102021, 4, 0x135001, 0x0, 3, 0xE, 0, 0xF, 0x9060, 0x0, 0x0, "I2", "rotate/jump_carry"},
+    {0x102100, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_ncarry"},
+    {0x102100, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1U0", "jump_uaboveeq"},
+    {0x102100, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_absaboveeq"},
+    {0x102107, 4, 0x135021, 0x0, 3, 0x27, 0, 0xF, 0x1000, 0x0, 0x0, "D1U0O4", "compare/jump_uaboveeq"},
+    {0x102107, 4, 0x135021, 0x0, 3, 0x27, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_absaboveeq"},
+    {0x102108, 4, 0x135021, 0x0, 3, 0x19, 0, 0xF, 0x1000, 0x0, 0x0, "U0", "add/jump_ncarry"},
+    {0x102121, 4, 0x135001, 0x0, 3, 0xF, 0, 0xF, 0x9060, 0x0, 0x0, "I2", "rotate/jump_ncarry"},
+    {0x102200, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1U0", "jump_uabove"},
+    {0x102200, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_absabove"},
+    {0x102207, 4, 0x135021, 0x0, 3, 0x28, 0, 0xF, 0x1000, 0x0, 0x0, "D1U0O4", "compare/jump_uabove"},
+    {0x102207, 4, 0x135021, 0x0, 3, 0x28, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_absabove"},
+    {0x102300, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1U0", "jump_ubeloweq"},
+    {0x102300, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_absbeloweq"},
+    {0x102307, 4, 0x135021, 0x0, 3, 0x29, 0, 0xF, 0x1000, 0x0, 0x0, "D1U0O4", "compare/jump_ubeloweq"},
+    {0x102307, 4, 0x135021, 0x0, 3, 0x29, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_absbeloweq"},
+    {0x102600, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_nfinite"},
+    {0x102607, 4, 0x1001, 0x0, 3, 0x18, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_nfinite"},
+    {0x102700, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_finite"},
+    {0x102707, 4, 0x1001, 0x0, 3, 0x19, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_finite"}
+};
+
+// Instruction records sorted by category, format, and operation codes. Used by disassembler
+const SInstruction builtinInstructionsByFormat[] = {
+//  id, category, format, templt, sourceoperands, op1, op2, optypesgp, optypesscalar, optypesvector, opimmediate, template_variant, name
+    {0x10001, 1, 0x100, 0xA, 1, 0x1, 0, 0x1F00, 0x0, 0x0, 0x0, "", "bitscan_f"},
+    {0x10002, 1, 0x100, 0xA, 1, 0x2, 0, 0x1F00, 0x0, 0x0, 0x0, "", "bitscan_r"},
+    {0x10003, 1, 0x100, 0xA, 1, 0x3, 0, 0x100F, 0x0, 0x0, 0x0, "", "round_d2"},
+    {0x10004, 1, 0x100, 0xA, 1, 0x4, 0, 0x100F, 0x0, 0x0, 0x0, "", "round_u2"},
+    {0x2, 1, 0x110, 0xC, 1, 0x0, 0, 0x8, 0x0, 0x0, 0x3, "", "move"},
+    {0x11001, 1, 0x110, 0xC, 1, 0x1, 0, 0x8, 0x0, 0x0, 0x13, "U0", "move_u"},
+    {0x8, 1, 0x110, 0xC, 2, 0x2, 0, 0x8, 0x0, 0x0, 0x3, "", "add"},
+    {0xB, 1, 0x110, 0xC, 2, 0x5, 0, 0x8, 0x0, 0x0, 0x3, "", "mul"},
+    {0x10, 1, 0x110, 0xC, 2, 0x6, 0, 0x8, 0x0, 0x0, 0x3, "", "div"},
+    {0x8, 1, 0x110, 0xC, 2, 0x7, 0, 0x8, 0x0, 0x0, 0x8, "", "add"},
+    {0x2, 1, 0x110, 0xC, 1, 0x10, 0, 0x8, 0x0, 0x0, 0x6, "", "move"},
+    {0x8, 1, 0x110, 0xC, 2, 0x11, 0, 0x8, 0x0, 0x0, 0x6, "", "add"},
+    {0x1C, 1, 0x110, 0xC, 2, 0x12, 0, 0x8, 0x0, 0x0, 0x6, "", "and"},
+    {0x1E, 1, 0x110, 0xC, 2, 0x13, 0, 0x8, 0x0, 0x0, 0x6, "", "or"},
+    {0x1F, 1, 0x110, 0xC, 2, 0x14, 0, 0x8, 0x0, 0x0, 0x6, "", "xor"},
+    {0x12000, 1, 0x120, 0xA, 2, 0x0, 0, 0x0, 0x906F, 0x906F, 0x0, "R1RL", "set_len"},
+    {0x12001, 1, 0x120, 0xA, 1, 0x1, 0, 0x0, 0x906F, 0x906F, 0x0, "R0", "get_len"},
+    {0x12002, 1, 0x120, 0xA, 2, 0x2, 0, 0x0, 0x906F, 0x906F, 0x0, "R1", "set_num"},
+    {0x12003, 1, 0x120, 0xA, 1, 0x3, 0, 0x0, 0x906F, 0x906F, 0x0, "R0", "get_num"},
+    {0x12004, 1, 0x120, 0xA, 2, 0x4, 0, 0x0, 0xB04E, 0xB04E, 0x0, "R1RL", "compress"},
+    {0x12005, 1, 0x120, 0xA, 2, 0x5, 0, 0x0, 0xFE00, 0xFE00, 0x0, "R1RL", "compress_ss"},
+    {0x12006, 1, 0x120, 0xA, 2, 0x6, 0, 0x0, 0xFE00, 0xFE00, 0x0, "R1RL", "compress_us"},
+    {0x12007, 1, 0x120, 0xA, 2, 0x7, 0, 0x0, 0xB04E, 0xB04E, 0x0, "R1RL", "expand"},
+    {0x12008, 1, 0x120, 0xA, 2, 0x8, 0, 0x0, 0x100E, 0x100E, 0x0, "R1RL", "expand_u"},
+    {0x12009, 1, 0x120, 0xA, 2, 0x9, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R1RL", "compress_sparse"},
+    {0x1200A, 1, 0x120, 0xA, 2, 0xA, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R1RL", "expand_sparse"},
+    {0x1200B, 1, 0x120, 0xA, 2, 0xB, 0, 0x0, 0xFF, 0xFF, 0x0, "R1", "extract"},
+    {0x1200C, 1, 0x120, 0xA, 2, 0xC, 0, 0x0, 0xFF, 0xFF, 0x0, "R1", "insert"},
+    {0x1200D, 1, 0x120, 0xA, 2, 0xD, 0, 0x0, 0xFF, 0xFF, 0x0, "R1RL", "broad"},
+    {0x1200E, 1, 0x120, 0xA, 2, 0xE, 0, 0x0, 0x906F, 0x906F, 0x0, "R1", "bits2bool"},
+    {0x1200F, 1, 0x120, 0xA, 2, 0xF, 0, 0x0, 0x906F, 0x906F, 0x0, "R1RL", "bool2bits"},
+    {0x12010, 1, 0x120, 0xA, 2, 0x10, 0, 0x0, 0x906F, 0x906F, 0x0, "R1RL", "bool_reduce"},
+    {0x12012, 1, 0x120, 0xA, 2, 0x12, 0, 0x0, 0xFF, 0xFF, 0x0, "R1", "shift_expand"},
+    {0x12013, 1, 0x120, 0xA, 2, 0x13, 0, 0x0, 0xFF, 0xFF, 0x0, "R1", "shift_reduce"},
+    {0x12014, 1, 0x120, 0xA, 2, 0x14, 0, 0x0, 0x906F, 0x906F, 0x0, "R1", "shift_up"},
+    {0x12015, 1, 0x120, 0xA, 2, 0x15, 0, 0x0, 0x906F, 0x906F, 0x0, "R1", "shift_down"},
+    {0x12016, 1, 0x120, 0xA, 2, 0x16, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R1", "rotate_up"},
+    {0x12017, 1, 0x120, 0xA, 2, 0x17, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R1", "rotate_down"},
+    {0x12018, 1, 0x120, 0xA, 2, 0x18, 0, 0x0, 0x1906, 0x1F00, 0x0, "", "div_ex"},
+    {0x12019, 1, 0x120, 0xA, 2, 0x19, 0, 0x0, 0x1906, 0x1F00, 0x0, "U0", "div_ex_u"},
+    {0x1201A, 1, 0x120, 0xA, 1, 0x1A, 0, 0x0, 0xE000, 0xE000, 0x0, "", "sqrt"},
+    {0x1201C, 1, 0x120, 0xA, 2, 0x1C, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "add_c"},
+    {0x1201D, 1, 0x120, 0xA, 2, 0x1D, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "sub_b"},
+    {0x1201E, 1, 0x120, 0xA, 2, 0x1E, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "add_ss"},
+    {0x1201F, 1, 0x120, 0xA, 2, 0x1F, 0, 0x0, 0x1F00, 0x1F00, 0x0, "U0", "add_us"},
+    {0x12020, 1, 0x120, 0xA, 2, 0x20, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "sub_ss"},
+    {0x12021, 1, 0x120, 0xA, 2, 0x21, 0, 0x0, 0x1F00, 0x1F00, 0x0, "U0", "sub_us"},
+    {0x12022, 1, 0x120, 0xA, 2, 0x22, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "mul_ss"},
+    {0x12023, 1, 0x120, 0xA, 2, 0x23, 0, 0x0, 0x1F00, 0x1F00, 0x0, "U0", "mul_us"},
+    {0x12024, 1, 0x120, 0xA, 2, 0x24, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "shift_ss"},
+    {0x12025, 1, 0x120, 0xA, 2, 0x25, 0, 0x0, 0x1F00, 0x1F00, 0x0, "U0", "shift_us"},
+    {0x12026, 1, 0x120, 0xA, 2, 0x26, 0, 0x0, 0xFF00, 0xFF00, 0x0, "", "add_oc"},
+    {0x12027, 1, 0x120, 0xA, 2, 0x27, 0, 0x0, 0xFF00, 0xFF00, 0x0, "", "sub_oc"},
+    {0x12029, 1, 0x120, 0xA, 2, 0x29, 0, 0x0, 0xFF00, 0xFF00, 0x0, "", "mul_oc"},
+    {0x1202A, 1, 0x120, 0xA, 2, 0x2A, 0, 0x0, 0xFF00, 0xFF00, 0x0, "", "div_oc"},
+    {0x50008, 1, 0x120, 0xA, 2, 0x30, 0, 0x0, 0x200, 0x200, 0x0, "H0", "add_h"},
+    {0x50009, 1, 0x120, 0xA, 2, 0x31, 0, 0x0, 0x200, 0x200, 0x0, "H0", "sub_h"},
+    {0x5000B, 1, 0x120, 0xA, 2, 0x32, 0, 0x0, 0x200, 0x200, 0x0, "H0", "mul_h"},
+    {0x50010, 1, 0x120, 0xA, 2, 0x33, 0, 0x0, 0x200, 0x200, 0x0, "H0", "div_h"},
+    {0x50030, 1, 0x120, 0xA, 3, 0x34, 0, 0x0, 0x200, 0x200, 0x0, "H0", "mul_add_h"},
+    {0x1203A, 1, 0x120, 0xA, 2, 0x3A, 0, 0x0, 0x100F, 0x100F, 0x0, "R1R2", "read_call_stack"},
+    {0x1203B, 1, 0x120, 0xA, 3, 0x3B, 0, 0x0, 0x100F, 0x100F, 0x0, "R2R3D0", "write_call_stack"},
+    {0x1203C, 1, 0x120, 0xA, 2, 0x3C, 0, 0x0, 0x100F, 0x100F, 0x0, "R1R2", "read_memory_map"},
+    {0x1203D, 1, 0x120, 0xA, 3, 0x3D, 0, 0x0, 0x100F, 0x100F, 0x0, "R2R3D0", "write_memory_map"},
+    {0x1203E, 1, 0x120, 0xA, 2, 0x3E, 0, 0x0, 0x100F, 0x100F, 0x0, "R1R2", "input"},
+    {0x1203F, 1, 0x120, 0xA, 3, 0x3F, 0, 0x0, 0x100F, 0x100F, 0x0, "R2R3D1", "output"},
+    {0x13000, 1, 0x130, 0xB, 1, 0x0, 0, 0x6F, 0x6F, 0x0, 0x0, "R1", "gp2vec"},
+    {0x13001, 1, 0x130, 0xB, 1, 0x1, 0, 0x6F, 0x6F, 0x6F, 0x0, "R0", "vec2gp"},
+    {0x13002, 1, 0x130, 0xB, 2, 0x2, 0, 0x0, 0x100F, 0x100F, 0x12, "R1", "read_spev"},
+    {0x13004, 1, 0x130, 0xB, 2, 0x4, 0, 0x0, 0xF00F, 0xF00F, 0x2, "R1", "make_sequence"},
+    {0x1300C, 1, 0x130, 0xB, 2, 0xC, 0, 0x0, 0x8060, 0x8060, 0x12, "I2", "float2int"},
+    {0x1300D, 1, 0x130, 0xB, 1, 0xD, 0, 0x0, 0x100C, 0x100C, 0x0, "", "int2float"},
+    {0x1300E, 1, 0x130, 0xB, 2, 0xE, 0, 0x0, 0x8060, 0x8060, 0x12, "I2", "round"},
+    {0x1300F, 1, 0x130, 0xB, 2, 0xF, 0, 0x0, 0xE000, 0xE000, 0x2, "I2", "round2n"},
+    {0xA0000, 1, 0x130, 0xB, 2, 0x10, 0, 0x0, 0xF00F, 0xF00F, 0x2, "I2", "abs"},
+    {0x13011, 1, 0x130, 0xB, 2, 0x11, 0, 0x0, 0x8060, 0x8060, 0x12, "I2", "fp_category"},
+    {0x1200D, 1, 0x130, 0xB, 2, 0x12, 0, 0x0, 0x906F, 0x906F, 0x2, "R1RL", "broad"},
+    {0x13013, 1, 0x130, 0xB, 1, 0x13, 0, 0x0, 0x906F, 0x906F, 0x2, "", "broadcast_max"},
+    {0x13014, 1, 0x130, 0xB, 1, 0x14, 0, 0x0, 0x100F, 0x100F, 0x0, "", "byte_reverse"},
+    {0x13015, 1, 0x130, 0xB, 1, 0x15, 0, 0x0, 0x1F00, 0x1F00, 0x0, "", "bit_reverse"},
+    {0x10001, 1, 0x130, 0xB, 1, 0x16, 0, 0x0, 0x100F, 0x1F00, 0x0, "", "bitscan_f"},
+    {0x10002, 1, 0x130, 0xB, 1, 0x17, 0, 0x0, 0x100F, 0x1F00, 0x0, "", "bitscan_r"},
+    {0x13018, 1, 0x130, 0xB, 1, 0x18, 0, 0x0, 0x100F, 0x1F00, 0x0, "", "popcount"},
+    {0x13019, 1, 0x130, 0xB, 3, 0x19, 0, 0x0, 0x100F, 0x100F, 0x12, "I2", "truth_tab2"},
+    {0x2, 1, 0x131, 0xC, 1, 0x20, 0, 0x0, 0x200, 0x0, 0x3, "", "move"},
+    {0x8, 1, 0x131, 0xC, 2, 0x21, 0, 0x0, 0x200, 0x200, 0x3, "", "add"},
+    {0x1C, 1, 0x131, 0xC, 2, 0x22, 0, 0x0, 0x200, 0x200, 0x3, "", "and"},
+    {0x1E, 1, 0x131, 0xC, 2, 0x23, 0, 0x0, 0x200, 0x200, 0x3, "", "or"},
+    {0x1F, 1, 0x131, 0xC, 2, 0x24, 0, 0x0, 0x200, 0x200, 0x3, "", "xor"},
+    {0x50008, 1, 0x131, 0xC, 2, 0x25, 0, 0x0, 0x200, 0x200, 0x40, "H0", "add_h"},
+    {0x5000B, 1, 0x131, 0xC, 2, 0x26, 0, 0x0, 0x200, 0x200, 0x40, "H0", "mul_h"},
+    {0x2, 1, 0x132, 0xC, 1, 0x28, 0, 0x0, 0x400, 0x0, 0x6, "", "move"},
+    {0x2, 1, 0x132, 0xC, 1, 0x29, 0, 0x0, 0x800, 0x0, 0x6, "", "move"},
+    {0x8, 1, 0x132, 0xC, 2, 0x2A, 0, 0x0, 0x400, 0x400, 0x6, "", "add"},
+    {0x8, 1, 0x132, 0xC, 2, 0x2B, 0, 0x0, 0x800, 0x800, 0x6, "", "add"},
+    {0x1C, 1, 0x132, 0xC, 2, 0x2C, 0, 0x0, 0x400, 0x400, 0x6, "", "and"},
+    {0x1C, 1, 0x132, 0xC, 2, 0x2D, 0, 0x0, 0x800, 0x800, 0x6, "", "and"},
+    {0x1E, 1, 0x132, 0xC, 2, 0x2E, 0, 0x0, 0x400, 0x400, 0x6, "", "or"},
+    {0x1E, 1, 0x132, 0xC, 2, 0x2F, 0, 0x0, 0x800, 0x800, 0x6, "", "or"},
+    {0x1F, 1, 0x132, 0xC, 2, 0x30, 0, 0x0, 0x400, 0x400, 0x6, "", "xor"},
+    {0x1F, 1, 0x132, 0xC, 2, 0x31, 0, 0x0, 0x800, 0x800, 0x6, "", "xor"},
+    {0x2, 1, 0x133, 0xC, 1, 0x38, 0, 0x0, 0x2000, 0x2000, 0x40, "", "move"},
+    {0x2, 1, 0x133, 0xC, 1, 0x39, 0, 0x0, 0x4000, 0x4000, 0x40, "", "move"},
+    {0x8, 1, 0x133, 0xC, 2, 0x3A, 0, 0x0, 0x2000, 0x2000, 0x40, "", "add"},
+    {0x8, 1, 0x133, 0xC, 2, 0x3B, 0, 0x0, 0x4000, 0x4000, 0x40, "", "add"},
+    {0xB, 1, 0x133, 0xC, 2, 0x3C, 0, 0x0, 0x2000, 0x2000, 0x40, "", "mul"},
+    {0xB, 1, 0x133, 0xC, 2, 0x3D, 0, 0x0, 0x4000, 0x4000, 0x40, "", "mul"},
+    {0xA0000, 1, 0x180, 0xB, 2, 0x0, 0, 0x100F, 0x0, 0x0, 0x12, "", "abs"},
+    {0x18001, 1, 0x180, 0xB, 3, 0x1, 0, 0x100F, 0x0, 0x0, 0x12, "", "shift_add"},
+    {0x18020, 1, 0x180, 0xB, 2, 0x20, 0, 0x1708, 0x0, 0x0, 0x12, "X1", "read_spec"},
+    {0x18021, 1, 0x180, 0xB, 2, 0x21, 0, 0x1708, 0x0, 0x0, 0x12, "Y1", "write_spec"},
+    {0x18022, 1, 0x180, 0xB, 2, 0x22, 0, 0x1708, 0x0, 0x0, 0x12, "X2", "read_capabilities"},
+    {0x18023, 1, 0x180, 0xB, 2, 0x23, 0, 0x1708, 0x0, 0x0, 0x12, "Y2", "write_capabilities"},
+    {0x18024, 1, 0x180, 0xB, 2, 0x24, 0, 0x1708, 0x0, 0x0, 0x12, "X3", "read_perf"},
+    {0x18025, 1, 0x180, 0xB, 2, 0x25, 0, 0x1708, 0x0, 0x0, 0x12, "X3", "read_perfs"},
+    {0x18026, 1, 0x180, 0xB, 2, 0x26, 0, 0x1708, 0x0, 0x0, 0x12, "X4", "read_sys"},
+    {0x18027, 1, 0x180, 0xB, 2, 0x27, 0, 0x1708, 0x0, 0x0, 0x12, "Y4", "write_sys"},
+    {0x28700, 1, 0x207, 0xE, 3, 0x0, 1, 0x1F00, 0x0, 0x0, 0x19, "O6I2", "move_bits"},
+    {0x22600, 1, 0x226, 0xE, 3, 0x0, 1, 0x0, 0x906F, 0x906F, 0x0, "R2RL", "concatenate"},
+    {0x22601, 1, 0x226, 0xE, 3, 0x1, 1, 0x0, 0x906F, 0x906F, 0x0, "R2RL", "permute"},
+    {0x22602, 1, 0x226, 0xE, 3, 0x2, 1, 0x0, 0x0, 0xFF00, 0x0, "R2RL", "interleave"},
+    {0x28700, 1, 0x227, 0xE, 3, 0x0, 1, 0x0, 0x1F00, 0x1F00, 0x19, "O6I2", "move_bits"},
+    {0x28701, 1, 0x227, 0xE, 3, 0x1, 1, 0x0, 0x100F, 0x100F, 0x12, "R1RLO5", "mask_length"},
+    {0x22603, 1, 0x227, 0xE, 4, 0x2, 1, 0x0, 0x1F00, 0x1F00, 0x13, "O5I2", "truth_tab3"},
+    {0x22608, 1, 0x227, 0xE, 3, 0x3, 1, 0x0, 0x0, 0xFC00, 0x13, "R1RLI2", "repeat_block"},
+    {0x22609, 1, 0x227, 0xE, 3, 0x4, 1, 0x0, 0x0, 0xFC00, 0x13, "R1RLI2", "repeat_within_blocks"},
+    {0x1, 1, 0x258, 0xB, 1, 0x8, 0, 0xFF00, 0xFF00, 0x0, 0x64, "M0", "store"},
+    {0x25910, 1, 0x259, 0xA, 2, 0x10, 0, 0xFF00, 0x0, 0x0, 0x12, "D1", "fence"},
+    {0x25912, 1, 0x259, 0xA, 3, 0x12, 0, 0xFF00, 0xFF00, 0x0, 0x0, "D1", "compare_swap"},
+    {0x25A18, 1, 0x25A, 0xA, 3, 0x18, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R2", "read_insert"},
+    {0x25A20, 1, 0x25A, 0xA, 2, 0x20, 0, 0x0, 0xFF00, 0xFF00, 0x0, "R2M0", "extract_store"},
+    {0x26000, 1, 0x260, 0xA, 1, 0x0, 0, 0x0, 0x906F, 0x906F, 0x64, "", "load_hi"},
+    {0x29001, 1, 0x260, 0xA, 2, 0x1, 0, 0x0, 0x906F, 0x906F, 0x64, "", "insert_hi"},
+    {0x26002, 1, 0x260, 0xA, 2, 0x2, 0, 0x0, 0x906F, 0x906F, 0x14, "", "make_mask"},
+    {0xA0001, 1, 0x260, 0xA, 2, 0x3, 0, 0x0, 0x906F, 0x906F, 0x64, "", "replace"},
+    {0x26004, 1, 0x260, 0xA, 2, 0x4, 0, 0x0, 0x906F, 0x906F, 0x64, "", "replace_even"},
+    {0x26005, 1, 0x260, 0xA, 2, 0x5, 0, 0x0, 0x906F, 0x906F, 0x64, "", "replace_odd"},
+    {0x1200D, 1, 0x260, 0xA, 2, 0x6, 0, 0x0, 0x906F, 0x906F, 0x64, "R1RL", "broad"},
+    {0x22601, 1, 0x260, 0xA, 3, 0x8, 0, 0x0, 0x906F, 0x906F, 0x14, "I2R1RL", "permute"},
+    {0x26009, 1, 0x260, 0xA, 2, 0x9, 0, 0x0, 0x1F00, 0x1F00, 0x1D, "O6", "replace_bits"},
+    {0x2, 1, 0x290, 0xA, 1, 0x0, 0, 0x8, 0x0, 0x0, 0x9, "", "move"},
+    {0x29001, 1, 0x290, 0xA, 2, 0x1, 0, 0x8, 0x0, 0x0, 0x14, "", "insert_hi"},
+    {0x8, 1, 0x290, 0xA, 2, 0x2, 0, 0x8, 0x0, 0x0, 0x14, "", "add"},
+    {0x9, 1, 0x290, 0xA, 2, 0x3, 0, 0x8, 0x0, 0x0, 0x14, "", "sub"},
+    {0x8, 1, 0x290, 0xA, 2, 0x4, 0, 0x8, 0x0, 0x0, 0x9, "", "add"},
+    {0x1C, 1, 0x290, 0xA, 2, 0x5, 0, 0x8, 0x0, 0x0, 0x9, "", "and"},
+    {0x1E, 1, 0x290, 0xA, 2, 0x6, 0, 0x8, 0x0, 0x0, 0x9, "", "or"},
+    {0x1F, 1, 0x290, 0xA, 2, 0x7, 0, 0x8, 0x0, 0x0, 0x9, "", "xor"},
+    {0x26009, 1, 0x290, 0xA, 2, 0x9, 0, 0x1F00, 0x0, 0x0, 0x1D, "O6", "replace_bits"},
+    {0x29020, 1, 0x291, 0xA, 1, 0x20, 0, 0x8, 0x0, 0x0, 0x0, "X0", "address"},
+    {0xA0001, 1, 0x318, 0xA, 2, 0x8, 0, 0x0, 0x906F, 0x906F, 0x64, "", "replace"},
+    {0x20000, 2, 0x1, 0x1, 0, 0x0, 0, 0xF, 0x0, 0x0, 0x0, "D0", "nop_t"},
+    {0x2, 2, 0x1, 0x1, 1, 0x1, 0, 0x8, 0x0, 0x0, 0x11, "", "move"},
+    {0x8, 2, 0x1, 0x1, 2, 0x2, 0, 0x8, 0x0, 0x0, 0x11, "", "add"},
+    {0x9, 2, 0x1, 0x1, 2, 0x3, 0, 0x8, 0x0, 0x0, 0x11, "", "sub"},
+    {0x20, 2, 0x1, 0x1, 2, 0x4, 0, 0x8, 0x0, 0x0, 0x11, "U0", "shift_left"},
+    {0x23, 2, 0x1, 0x1, 2, 0x5, 0, 0x8, 0x0, 0x0, 0x11, "U0", "shift_right_u"},
+    {0x2, 2, 0x2, 0x1, 1, 0x8, 0, 0x8, 0x0, 0x0, 0x0, "", "move"},
+    {0x8, 2, 0x2, 0x1, 2, 0x9, 0, 0x8, 0x0, 0x0, 0x0, "", "add"},
+    {0x9, 2, 0x2, 0x1, 2, 0xA, 0, 0x8, 0x0, 0x0, 0x0, "", "sub"},
+    {0x1C, 2, 0x2, 0x1, 2, 0xB, 0, 0x8, 0x0, 0x0, 0x0, "", "and"},
+    {0x1E, 2, 0x2, 0x1, 2, 0xC, 0, 0x8, 0x0, 0x0, 0x0, "", "or"},
+    {0x1F, 2, 0x2, 0x1, 2, 0xD, 0, 0x8, 0x0, 0x0, 0x0, "", "xor"},
+    {0x2, 2, 0x4, 0x1, 1, 0xE, 0, 0x8, 0x0, 0x0, 0x0, "", "move"},
+    {0x1, 2, 0x5, 0x1, 1, 0xF, 0, 0x8, 0x0, 0x0, 0x0, "M0", "store"},
+    {0x20010, 2, 0x8, 0x1, 0, 0x10, 0, 0x0, 0x8, 0x8, 0x0, "D2", "clear"},
+    {0x2, 2, 0xA, 0x1, 1, 0x11, 0, 0x0, 0x8, 0x8, 0x0, "D2", "move"},
+    {0x2, 2, 0x9, 0x1, 1, 0x12, 0, 0x0, 0x20, 0x0, 0x21, "", "move"},
+    {0x2, 2, 0x9, 0x1, 1, 0x13, 0, 0x0, 0x40, 0x0, 0x21, "", "move"},
+    {0x8, 2, 0xA, 0x1, 2, 0x14, 0, 0x0, 0x20, 0x20, 0x0, "", "add"},
+    {0x8, 2, 0xA, 0x1, 2, 0x15, 0, 0x0, 0x40, 0x40, 0x0, "", "add"},
+    {0x9, 2, 0xA, 0x1, 2, 0x16, 0, 0x0, 0x20, 0x20, 0x0, "", "sub"},
+    {0x9, 2, 0xA, 0x1, 2, 0x17, 0, 0x0, 0x40, 0x40, 0x0, "", "sub"},
+    {0xB, 2, 0xA, 0x1, 2, 0x18, 0, 0x0, 0x20, 0x20, 0x0, "", "mul"},
+    {0xB, 2, 0xA, 0x1, 2, 0x19, 0, 0x0, 0x40, 0x40, 0x0, "", "mul"},
+    {0x2001C, 2, 0xB, 0x1, 2, 0x1C, 0, 0x8, 0xFF, 0xFF, 0x0, "R0R1", "add_cps"},
+    {0x2001D, 2, 0xB, 0x1, 2, 0x1D, 0, 0x8, 0xFF, 0xFF, 0x0, "R0R1", "sub_cps"},
+    {0x2001E, 2, 0xC, 0x1, 1, 0x1E, 0, 0x0, 0xFF, 0xFF, 0x0, "D2", "restore_cp"},
+    {0x2001F, 2, 0xD, 0x1, 1, 0x1F, 0, 0x0, 0xFF, 0xFF, 0x0, "M0D2", "save_cp"},
+    {0x30000, 3, 0xFFF, 0x0, 0, 0x0, 0, 0xF, 0xFF, 0x0, 0x0, "D0", "nop"},
+    {0x30200, 3, 0xFFFFF000, 0x0, 0, 0x0, 0, 0xF, 0xFF, 0x0, 0x0, "D0", "nop2"},
+    {0x30300, 3, 0xFFFFF00000000, 0x0, 0, 0x0, 0, 0xF, 0xFF, 0x0, 0x0, "D0", "nop3"},
+    {0x1, 3, 0xA0900F0FA3F0, 0x0, 1, 0x1, 0, 0xF, 0x906F, 0x906F, 0x0, "M0", "store"},
+    {0x2, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 1, 0x2, 0, 0xF, 0x906F, 0x906F, 0x0, "", "move"},
+    {0x3, 3, 0xA0900F0FA3F0, 0x0, 1, 0x3, 0, 0xF, 0x906F, 0x906F, 0x0, "D04", "prefetch"},
+    {0x4, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 1, 0x4, 0, 0x7, 0x7, 0x7, 0x0, "", "sign_extend"},
+    {0x5, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x5, 0, 0x700, 0x0, 0x0, 0x0, "", "sign_extend_add"},
+    {0x7, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x7, 0, 0xF, 0x906F, 0x906F, 0x0, "O6U3", "compare"},
+    {0x8, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x8, 0, 0xF, 0x906F, 0x906F, 0x0, "", "add"},
+    {0x9, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x9, 0, 0xF, 0x906F, 0x906F, 0x0, "", "sub"},
+    {0xA, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0xA, 0, 0xF, 0x906F, 0x906F, 0x0, "", "sub_rev"},
+    {0xB, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0xB, 0, 0xF, 0x906F, 0x9867, 0x0, "", "mul"},
+    {0xC, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0xC, 0, 0xB04, 0x1B04, 0x1F00, 0x0, "", "mul_hi"},
+    {0xD, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0xD, 0, 0xB04, 0x1B04, 0x1F00, 0x0, "U0", "mul_hi_u"},
+    {0xE, 3, 0xFF000FF00C0FC, 0x0, 2, 0xE, 0, 0xB04, 0x1B04, 0x1F00, 0x0, "", "mul_ex"},
+    {0xF, 3, 0xFF000FF00C0FC, 0x0, 2, 0xF, 0, 0xB04, 0x1B04, 0x1F00, 0x0, "U0", "mul_ex_u"},
+    {0x10, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x10, 0, 0xF, 0x906F, 0xFF00, 0x0, "O4", "div"},
+    {0x11, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x11, 0, 0xF, 0x100F, 0x100F, 0x0, "O4U0", "div_u"},
+    {0x12, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x12, 0, 0xF, 0x906F, 0xFF00, 0x0, "O4", "div_rev"},
+    {0x14, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x14, 0, 0xF, 0x906F, 0xFF00, 0x0, "", "rem"},
+    {0x15, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x15, 0, 0xF, 0xF, 0xF00, 0x0, "U0", "rem_u"},
+    {0x16, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x16, 0, 0xF, 0x906F, 0x906F, 0x0, "", "min"},
+    {0x17, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x17, 0, 0xF, 0x100F, 0x100F, 0x0, "U0", "min_u"},
+    {0x17, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x17, 0, 0x8060, 0x8060, 0x8060, 0x0, "", "min_abs"},
+    {0x18, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x18, 0, 0xF, 0x906F, 0x906F, 0x0, "", "max"},
+    {0x19, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x19, 0, 0xF, 0x100F, 0x100F, 0x0, "U0", "max_u"},
+    {0x19, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x19, 0, 0x8060, 0x8060, 0x8060, 0x0, "", "max_abs"},
+    {0x1C, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x1C, 0, 0xF, 0x906F, 0x906F, 0x0, "", "and"},
+    {0x1D, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x1D, 0, 0xF, 0x906F, 0x906F, 0x0, "", "and_not"},
+    {0x1E, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x1E, 0, 0xF, 0x906F, 0x906F, 0x0, "", "or"},
+    {0x1F, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x1F, 0, 0xF, 0x906F, 0x906F, 0x0, "", "xor"},
+    {0x20, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x20, 0, 0x100F, 0x100F, 0x100F, 0x0, "I2M1", "shift_left"},
+    {0x20, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x20, 0, 0x0, 0x8060, 0x8060, 0x0, "I2M1", "mul_2pow"},
+    {0x21, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x21, 0, 0x100F, 0x100F, 0x100F, 0x0, "I2M1", "rotate"},
+    {0x22, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x22, 0, 0x100F, 0x100F, 0x100F, 0x0, "I2M1", "shift_right_s"},
+    {0x23, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x23, 0, 0x100F, 0x100F, 0x100F, 0x0, "I2M1U0", "shift_right_u"},
+    {0x24, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x24, 0, 0xF, 0x906F, 0x906F, 0x0, "I2M1", "set_bit"},
+    {0x25, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x25, 0, 0xF, 0x906F, 0x906F, 0x0, "I2M1", "clear_bit"},
+    {0x26, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x26, 0, 0xF, 0x906F, 0x906F, 0x0, "I2M1", "toggle_bit"},
+    {0x27, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x27, 0, 0xF, 0x906F, 0x906F, 0x0, "I2M1", "and_bit"},
+    {0x28, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x28, 0, 0xF, 0x906F, 0x906F, 0x0, "I2M1O5", "test_bit"},
+    {0x29, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x29, 0, 0xF, 0x906F, 0x906F, 0x0, "O5", "test_bits"},
+    {0x2A, 3, 0x7F7F0FFFFAFFF, 0x0, 2, 0x2A, 0, 0xF, 0x906F, 0x906F, 0x0, "O5", "test_bits_all1"},
+    {0x30, 3, 0xFFFFFFFFF700F, 0x0, 3, 0x30, 0, 0xF00, 0xFF00, 0xFF00, 0x0, "O4", "mul_add"},
+    {0x31, 3, 0xFFFFFFFFF700F, 0x0, 3, 0x31, 0, 0xF00, 0xFF00, 0xFF00, 0x0, "O4", "mul_add2"},
+    {0x32, 3, 0xFFFFFFFFF700F, 0x0, 3, 0x32, 0, 0xF00, 0xFF00, 0xFF00, 0x0, "O3", "add_add"},
+    {0x37, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x37, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef55"},
+    {0x38, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x38, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef56"},
+    {0x39, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x39, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef57"},
+    {0x3A, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3A, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef58"},
+    {0x3B, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3B, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef59"},
+    {0x3C, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3C, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef60"},
+    {0x3D, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3D, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef61"},
+    {0x3E, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3E, 0, 0xF, 0x906F, 0x906F, 0x0, "", "userdef62"},
+    {0x3F, 3, 0xFFFFFFFFFFFFFFFF, 0x0, 2, 0x3F, 0, 0xF, 0xFF, 0xFF, 0x0, "D0", "undef"},
+    {0x101209, 4, 0x135001, 0xB, 3, 0x0, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_zero"},
+    {0x101000, 4, 0x10, 0xD, 1, 0x0, 0, 0xF, 0x0, 0x0, 0x0, "D0", "jump"},
+    {0x101309, 4, 0x135001, 0xB, 3, 0x1, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_nzero"},
+    {0x101609, 4, 0x135001, 0xB, 3, 0x2, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_neg"},
+    {0x101709, 4, 0x135001, 0xB, 3, 0x3, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_nneg"},
+    {0x101409, 4, 0x135001, 0xB, 3, 0x4, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_pos"},
+    {0x101509, 4, 0x135001, 0xB, 3, 0x5, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_npos"},
+    {0x101809, 4, 0x135001, 0xB, 3, 0x6, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_overfl"},
+    {0x101909, 4, 0x135001, 0xB, 3, 0x7, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump_noverfl"},
+    {0x102009, 4, 0x135001, 0xB, 3, 0x8, 0, 0xF, 0x1000, 0x0, 0x0, "U0", "sub/jump_borrow"},
+    {0x101100, 4, 0x10, 0xD, 1, 0x8, 0, 0xF, 0x0, 0x0, 0x0, "D0", "call"},
+    {0x102009, 4, 0x135001, 0xB, 3, 0x9, 0, 0xF, 0x1000, 0x0, 0x0, "U0", "sub/jump_nborrow"},
+    {0x101220, 4, 0x135001, 0x0, 3, 0xA, 0, 0xF, 0x9060, 0x0, 0x0, "I2", "shift_left/jump_zero"},
+    {0x101320, 4, 0x135001, 0x0, 3, 0xB, 0, 0xF, 0x9060, 0x0, 0x0, "I2", "shift_left/jump_nzero"},
+    {0x101223, 4, 0x135001, 0x0, 3, 0xC, 0, 0xF, 0x9060, 0x0, 0x0, "U0I2", "shift_right_u/jump_zero"},
+    {0x101323, 4, 0x135001, 0x0, 3, 0xD, 0, 0xF, 0x9060, 0x0, 0x0, "U0I2", "shift_right_u/jump_nzero"},
+    {0x102021, 4, 0x135001, 0x0, 3, 0xE, 0, 0xF, 0x9060, 0x0, 0x0, "I2", "rotate/jump_carry"},
+    {0x102121, 4, 0x135001, 0x0, 3, 0xF, 0, 0xF, 0x9060, 0x0, 0x0, "I2", "rotate/jump_ncarry"},
+    {0x101208, 4, 0x135021, 0x0, 3, 0x10, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_zero"},
+    {0x101308, 4, 0x135021, 0x0, 3, 0x11, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_nzero"},
+    {0x101608, 4, 0x135021, 0x0, 3, 0x12, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_neg"},
+    {0x101708, 4, 0x135021, 0x0, 3, 0x13, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_nneg"},
+    {0x101408, 4, 0x135021, 0x0, 3, 0x14, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_pos"},
+    {0x101508, 4, 0x135021, 0x0, 3, 0x15, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_npos"},
+    {0x101808, 4, 0x135021, 0x0, 3, 0x16, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_overfl"},
+    {0x101908, 4, 0x135021, 0x0, 3, 0x17, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump_noverfl"},
+    {0x102008, 4, 0x135021, 0x0, 3, 0x18, 0, 0xF, 0x1000, 0x0, 0x0, "U0", "add/jump_carry"},
+    {0x102607, 4, 0x1001, 0x0, 3, 0x18, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_nfinite"},
+    {0x102108, 4, 0x135021, 0x0, 3, 0x19, 0, 0xF, 0x1000, 0x0, 0x0, "U0", "add/jump_ncarry"},
+    {0x102707, 4, 0x1001, 0x0, 3, 0x19, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_finite"},
+    {0x10121C, 4, 0x135021, 0x0, 3, 0x1A, 0, 0xF, 0x9060, 0x0, 0x0, "", "and/jump_zero"},
+    {0x10131C, 4, 0x135021, 0x0, 3, 0x1B, 0, 0xF, 0x9060, 0x0, 0x0, "", "and/jump_nzero"},
+    {0x10121E, 4, 0x135021, 0x0, 3, 0x1C, 0, 0xF, 0x9060, 0x0, 0x0, "", "or/jump_zero"},
+    {0x10131E, 4, 0x135021, 0x0, 3, 0x1D, 0, 0xF, 0x9060, 0x0, 0x0, "", "or/jump_nzero"},
+    {0x10121F, 4, 0x135021, 0x0, 3, 0x1E, 0, 0xF, 0x9060, 0x0, 0x0, "", "xor/jump_zero"},
+    {0x10131F, 4, 0x135021, 0x0, 3, 0x1F, 0, 0xF, 0x9060, 0x0, 0x0, "", "xor/jump_nzero"},
+    {0x101207, 4, 0x135021, 0x0, 3, 0x20, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_eq"},
+    {0x101307, 4, 0x135021, 0x0, 3, 0x21, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_neq"},
+    {0x101607, 4, 0x135021, 0x0, 3, 0x22, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_sbelow"},
+    {0x101707, 4, 0x135021, 0x0, 3, 0x23, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_saboveeq"},
+    {0x101407, 4, 0x135021, 0x0, 3, 0x24, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_sabove"},
+    {0x101507, 4, 0x135021, 0x0, 3, 0x25, 0, 0xF, 0x9060, 0x0, 0x0, "D1O4", "compare/jump_sbeloweq"},
+    {0x102007, 4, 0x135021, 0x0, 3, 0x26, 0, 0xF, 0x1000, 0x0, 0x0, "D1U0O4", "compare/jump_ubelow"},
+    {0x102007, 4, 0x135021, 0x0, 3, 0x26, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_absbelow"},
+    {0x102107, 4, 0x135021, 0x0, 3, 0x27, 0, 0xF, 0x1000, 0x0, 0x0, "D1U0O4", "compare/jump_uaboveeq"},
+    {0x102107, 4, 0x135021, 0x0, 3, 0x27, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_absaboveeq"},
+    {0x102207, 4, 0x135021, 0x0, 3, 0x28, 0, 0xF, 0x1000, 0x0, 0x0, "D1U0O4", "compare/jump_uabove"},
+    {0x102207, 4, 0x135021, 0x0, 3, 0x28, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_absabove"},
+    {0x102307, 4, 0x135021, 0x0, 3, 0x29, 0, 0xF, 0x1000, 0x0, 0x0, "D1U0O4", "compare/jump_ubeloweq"},
+    {0x102307, 4, 0x135021, 0x0, 3, 0x29, 0, 0x0, 0x8060, 0x0, 0x0, "D1O4", "compare/jump_absbeloweq"},
+    {0x101228, 4, 0x135021, 0x0, 3, 0x2A, 0, 0xF, 0x9060, 0x0, 0x0, "D1I2", "test_bit/jump_zero"},
+    {0x101328, 4, 0x135021, 0x0, 3, 0x2B, 0, 0xF, 0x9060, 0x0, 0x0, "D1I2", "test_bit/jump_nzero"},
+    {0x101250, 4, 0x135021, 0x0, 3, 0x2C, 0, 0xF, 0x9060, 0x0, 0x0, "D1I2", "test/jump_all1"},
+    {0x101350, 4, 0x135021, 0x0, 3, 0x2D, 0, 0xF, 0x9060, 0x0, 0x0, "D1I2", "test/jump_nall1"},
+    {0x101451, 4, 0x135021, 0x0, 3, 0x32, 0, 0xF, 0x1000, 0x0, 0x0, "O4", "increment_compare/jump_sabove"},
+    {0x101551, 4, 0x135021, 0x0, 3, 0x33, 0, 0xF, 0x1000, 0x0, 0x0, "O4", "increment_compare/jump_sbeloweq"},
+    {0x101452, 4, 0x10001, 0x0, 3, 0x34, 0, 0xF, 0x0, 0x0, 0x12, "", "sub_maxlen/jump_pos"},
+    {0x101552, 4, 0x10001, 0x0, 3, 0x35, 0, 0xF, 0x0, 0x0, 0x12, "", "sub_maxlen/jump_npos"},
+    {0x101009, 4, 0x35021, 0x0, 3, 0x36, 0, 0xF, 0x1000, 0x0, 0x0, "", "sub/jump"},
+    {0x101008, 4, 0x35021, 0x0, 3, 0x37, 0, 0xF, 0x1000, 0x0, 0x0, "", "add/jump"},
+    {0x101000, 4, 0x2002, 0xB, 1, 0x3A, 0, 0xF, 0x0, 0x0, 0x0, "D0", "jump"},
+    {0x101000, 4, 0x10040, 0xC, 1, 0x3A, 0, 0xF, 0x0, 0x0, 0x0, "D0", "jump"},
+    {0x101000, 4, 0x100000, 0xC, 1, 0x3A, 0, 0xF, 0x0, 0x0, 0x15, "D0", "jump"},
+    {0x101100, 4, 0x2002, 0xB, 1, 0x3B, 0, 0xF, 0x0, 0x0, 0x0, "D0", "call"},
+    {0x101100, 4, 0x10040, 0xC, 1, 0x3B, 0, 0xF, 0x0, 0x0, 0x0, "D0", "call"},
+    {0x101100, 4, 0x100000, 0xC, 1, 0x3B, 0, 0xF, 0x0, 0x0, 0x15, "D0", "call"},
+    {0x101000, 4, 0x2004, 0xA, 2, 0x3C, 0, 0xF, 0x0, 0x0, 0x0, "D1", "jump"},
+    {0x101000, 4, 0x80, 0xC, 1, 0x3C, 0, 0xF, 0x0, 0x0, 0x0, "D0", "jump"},
+    {0x101100, 4, 0x2004, 0xA, 2, 0x3D, 0, 0xF, 0x0, 0x0, 0x0, "D1", "call"},
+    {0x101100, 4, 0x80, 0xC, 1, 0x3D, 0, 0xF, 0x0, 0x0, 0x0, "D0", "call"},
+    {0x4001E, 4, 0x8, 0xB, 0, 0x3E, 0, 0xF, 0x0, 0x0, 0x0, "D0", "return"},
+    {0x4101E, 4, 0x80, 0xC, 0, 0x3E, 0, 0xF, 0x0, 0x0, 0x0, "D0", "sys_return"},
+    {0x4001F, 4, 0x8, 0xA, 3, 0x3F, 0, 0xF, 0x0, 0x0, 0x0, "D1", "sys_call"},
+    {0x4001F, 4, 0x8000, 0xB, 3, 0x3F, 0, 0x80F, 0x0, 0x0, 0x1A, "D0", "sys_call"},
+    {0x4001F, 4, 0x80000, 0xB, 4, 0x3F, 0, 0x80F, 0x0, 0x0, 0x1B, "D0", "sys_call"},
+    {0x4001F, 4, 0x2000000, 0xB, 3, 0x3F, 0, 0x80F, 0x0, 0x0, 0x1C, "D0", "sys_call"},
+    {0x4101F, 4, 0x40, 0xC, 1, 0x3F, 0, 0x80F, 0x0, 0x0, 0x13, "D0", "trap"},
+    {0x4101F, 4, 0x40, 0xC, 0, 0x3F, 0, 0xFF, 0xFF, 0x0, 0x0, "D0", "filler"},
+    {0x42207, 4, 0x40000, 0xC, 2, 0x3F, 0, 0x8, 0x0, 0x0, 0x14, "D0", "compare_trap_uabove"},
+    {0x50, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "test"},
+    {0x51, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "increment_compare"},
+    {0x52, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x12, "", "sub_maxlen"},
+    {0x101200, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_zero"},
+    {0x101300, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_nzero"},
+    {0x101600, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_neg"},
+    {0x101700, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_nneg"},
+    {0x101400, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_pos"},
+    {0x101500, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_npos"},
+    {0x101800, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_overfl"},
+    {0x101900, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_noverfl"},
+    {0x102000, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "U0", "jump_borrow"},
+    {0x102000, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "U0", "jump_nborrow"},
+    {0x102000, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_carry"},
+    {0x102100, 4, 0x0, 0x0, 3, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "", "jump_ncarry"},
+    {0x102600, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_nfinite"},
+    {0x102700, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_finite"},
+    {0x101200, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_eq"},
+    {0x101200, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_equal"},
+    {0x101300, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_neq"},
+    {0x101300, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_notequal"},
+    {0x101600, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_sbelow"},
+    {0x101700, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_saboveeq"},
+    {0x101400, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_sabove"},
+    {0x101500, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_sbeloweq"},
+    {0x101600, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_below"},
+    {0x101700, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_aboveeq"},
+    {0x101400, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_above"},
+    {0x101500, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_beloweq"},
+    {0x102000, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1U0", "jump_ubelow"},
+    {0x102100, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1U0", "jump_uaboveeq"},
+    {0x102200, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1U0", "jump_uabove"},
+    {0x102300, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1U0", "jump_ubeloweq"},
+    {0x102000, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_absbelow"},
+    {0x102100, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_absaboveeq"},
+    {0x102200, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_absabove"},
+    {0x102300, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_absbeloweq"},
+    {0x101200, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_all1"},
+    {0x101300, 4, 0x0, 0x0, 2, 0xFFFFFFFF, 0, 0x0, 0x0, 0x0, 0x0, "D1", "jump_nall1"}
+};
+
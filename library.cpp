@@ -0,0 +1,444 @@
+/****************************    library.cpp    *******************************
+* Author:        Agner Fog
+* Date created:  2017-11-20
+* Last modified: 2017-11-20
+* Version:       1.00
+* Project:       Binary tools for ForwardCom instruction set
+* Module:        library.cpp
+* Description:
+* Library manager. Builds and modifies ForwardCom function libraries
+*
+* Commands:
+* forw -lib library.li file1.ob file2.ob      Add or replace members
+* forw -lib library.li -d member.ob           Delete member
+* forw -lib library.li -x member.ob           Extract member
+* forw -lib library.li -xall                  Extract all members
+* forw -lib library.li -l                     List members and public symbols
+*
+* The format of the library file is described in library.h
+*
+* Copyright 2017 GNU General Public License http://www.gnu.org/licenses
+*****************************************************************************/
+#include "stdafx.h"
+
+// Get file name without path
+const char * removePath(const char * fileName) {
+    const char * name = fileName;
+    for (const char * p = fileName; *p; p++) {
+        if (*p == '/' || *p == '\\' || *p == ':') name = p + 1;
+    }
+    return name;
+}
+
+CLibrary::CLibrary() {
+    // Constructor
+    header = 0;
+    memberTable = 0;
+    symbolList = 0;
+    hashTable = 0;
+    stringTable = 0;
+    unusedSize = 0;
+    modified = false;
+}
+
+// Do the library commands from the command line
+void CLibrary::go() {
+    uint32_t i;                                  // loop counter
+    if (dataSize()) {
+        // Existing library. Make list of old members
+        if (!parse()) return;
+        for (i = 0; i < header->numMembers; i++) {
+            SLibraryItem item;
+            item.offset = item.newOffset = memberTable[i].offset;
+            item.size = memberTable[i].size;
+            item.name = (uint32_t)itemNames.pushString(stringTable + memberTable[i].name);
+            item.source = 0;
+            item.oldMember = i;
+            items.push(item);
+        }
+        unusedSize = header->unusedSize;
+    }
+    else {
+        modified = true;                         // make new library
+    }
+
+    // Do commands in the order they appear on the command line
+    for (i = 0; i < cmd.libraryCommands.numEntries(); i++) {
+        SLibraryCommand & command = cmd.libraryCommands[i];
+        switch (command.command) {
+        case CMDL_LIBRARY_ADDMEMBER:
+            addMember(command.name);  break;
+        case CMDL_LIBRARY_DELETEMEM:
+            deleteMember(command.name);  break;
+        case CMDL_LIBRARY_EXTRACTMEM: {
+            uint32_t m = findItem(removePath(command.name));
+            if (m == LIBRARY_NOT_FOUND) err.submit(ERR_LIBRARY_MEMBER_NOT_FOUND, command.name);
+            else extractMember(m);
+            break;}
+        }
+        if (err.number()) return;
+    }
+    if ((cmd.libraryOptions & CMDL_LIBRARY_EXTRACTALL) == CMDL_LIBRARY_EXTRACTALL) {
+        for (i = 0; i < items.numEntries(); i++) extractMember(i);
+    }
+
+    if (modified) {
+        // Update the library in place if it exists and is not too fragmented. Otherwise make a new file
+        if (header && strcmp(cmd.outputFile, fileName) == 0 && (unusedSize + header->directorySize) * 2 <= dataSize()) {
+            updateLibrary();
+        }
+        else {
+            makeLibrary();
+            if (err.number()) return;
+            write();
+        }
+        if (err.number()) return;
+        if (cmd.verbose) {
+            printf("\nWriting library %s with %u members", cmd.outputFile, (uint32_t)newMembers.numEntries());
+        }
+    }
+    if ((cmd.libraryOptions & CMDL_LIBRARY_LIST) || cmd.libraryOptions == 0) {
+        listMembers();
+    }
+}
+
+// Check that a table or member of the given length at the given offset is inside a file of the given size.
+// Written so that a huge offset or length cannot wrap around
+static inline bool insideFile(uint64_t offset, uint64_t length, uint64_t size) {
+    return offset <= size && length <= size - offset;
+}
+
+// Check library file and find the tables. Return false if invalid
+bool CLibrary::parse() {
+    header = 0;
+    uint64_t size = dataSize();
+    if (size < sizeof(SLibraryHeader) || memcmp(buf(), LIBRARY_SIGNATURE, sizeof(LIBRARY_SIGNATURE)) != 0) {
+        err.submit(ERR_LIBRARY_FILE_TYPE, fileName);  return false;
+    }
+    SLibraryHeader * h = (SLibraryHeader*)buf();
+    // check that tables are inside the file
+    if (h->version != LIBRARY_VERSION
+    || !insideFile(h->memberTableOffset, (uint64_t)h->numMembers * sizeof(SLibraryMember), size)
+    || !insideFile(h->symbolListOffset, (uint64_t)h->numNames * sizeof(SStringEntry), size)
+    || !insideFile(h->hashTableOffset, (uint64_t)h->hashTableSize * sizeof(SLibraryHashEntry), size)
+    || (h->hashTableSize & (h->hashTableSize - 1)) != 0
+    || h->stringTableSize == 0 || !insideFile(h->stringTableOffset, h->stringTableSize, size)
+    || h->directorySize > size || h->unusedSize > size
+    || buf()[h->stringTableOffset + h->stringTableSize - 1] != 0) {
+        err.submit(ERR_LIBRARY_FILE_TYPE, fileName);  return false;
+    }
+    memberTable = (SLibraryMember*)(buf() + h->memberTableOffset);
+    symbolList = (SStringEntry*)(buf() + h->symbolListOffset);
+    hashTable = (SLibraryHashEntry*)(buf() + h->hashTableOffset);
+    stringTable = (const char*)buf() + h->stringTableOffset;
+    for (uint32_t m = 0; m < h->numMembers; m++) {
+        SLibraryMember & member = memberTable[m];
+        if (!insideFile(member.offset, member.size, size) || member.name >= h->stringTableSize
+        || (uint64_t)member.firstSymbol + member.numSymbols > h->numNames) {
+            err.submit(ERR_LIBRARY_FILE_TYPE, fileName);  return false;
+        }
+    }
+    for (uint32_t n = 0; n < h->numNames; n++) {
+        if (symbolList[n].string >= h->stringTableSize) {
+            err.submit(ERR_LIBRARY_FILE_TYPE, fileName);  return false;
+        }
+    }
+    header = h;
+    return true;
+}
+
+// Number of members
+uint32_t CLibrary::numMembers() {
+    return header ? header->numMembers : 0;
+}
+
+// Name of member
+const char * CLibrary::memberName(uint32_t m) {
+    if (header == 0 || m >= header->numMembers) return "?";
+    return stringTable + memberTable[m].name;
+}
+
+// Find member that defines symbol. hash = linkNameHash(name). 
+// Returns LIBRARY_NOT_FOUND if the symbol is not in the index
+uint32_t CLibrary::findSymbol(const char * name, uint32_t hash) {
+    if (header == 0 || header->hashTableSize == 0) return LIBRARY_NOT_FOUND;
+    uint32_t mask = header->hashTableSize - 1;
+    uint32_t h = hash & mask;
+    for (uint32_t n = 0; n <= mask; n++) {
+        SLibraryHashEntry & entry = hashTable[h];
+        if (entry.name == 0) break;              // vacant. not found
+        if (entry.hash == hash && entry.name < header->stringTableSize && strcmp(stringTable + entry.name, name) == 0) {
+            return entry.member < header->numMembers ? entry.member : LIBRARY_NOT_FOUND;
+        }
+        h = (h + 1) & mask;                      // linear probing
+    }
+    return LIBRARY_NOT_FOUND;
+}
+
+// Use member in place. The library must not be modified or deallocated while member is in use
+void CLibrary::getMember(uint32_t m, CFileBuffer & member) {
+    if (header == 0 || m >= header->numMembers) {
+        err.submit(ERR_INDEX_OUT_OF_RANGE);  return;
+    }
+    member.share(*this, memberTable[m].offset, memberTable[m].size);
+    member.fileName = memberName(m);
+}
+
+// Find member of new library by name
+uint32_t CLibrary::findItem(const char * name) {
+    for (uint32_t i = 0; i < items.numEntries(); i++) {
+        if (strcmp((const char*)itemNames.buf() + items[i].name, name) == 0) return i;
+    }
+    return LIBRARY_NOT_FOUND;
+}
+
+// Add or replace member
+void CLibrary::addMember(const char * fileName) {
+    CELF member;
+    member.fileName = fileName;
+    member.read();
+    if (err.number()) return;
+    if (member.getFileType() != FILETYPE_ELF || member.executable || member.machineType != EM_FORWARDCOM) {
+        err.submit(ERR_LIBRARY_MEMBER_TYPE, fileName);  return;
+    }
+    const char * name = removePath(fileName);
+    SLibraryItem item;
+    item.offset = newData.push(member.buf(), member.dataSize());
+    item.size = member.dataSize();
+    item.newOffset = 0;
+    item.source = 1;
+    item.oldMember = 0;
+    uint32_t i = findItem(name);
+    if (i == LIBRARY_NOT_FOUND) {
+        item.name = (uint32_t)itemNames.pushString(name);
+        items.push(item);
+    }
+    else {
+        if (items[i].source == 0) unusedSize += items[i].size;
+        item.name = items[i].name;               // replace member with same name
+        items[i] = item;
+    }
+    modified = true;
+}
+
+// Remove member
+void CLibrary::deleteMember(const char * name) {
+    uint32_t i = findItem(removePath(name));
+    if (i == LIBRARY_NOT_FOUND) {
+        err.submit(ERR_LIBRARY_MEMBER_NOT_FOUND, name);  return;
+    }
+    if (items[i].source == 0) unusedSize += items[i].size;
+    uint32_t num = items.numEntries();
+    for (; i + 1 < num; i++) items[i] = items[i + 1];
+    items.setNum(num - 1);
+    modified = true;
+}
+
+// Write member to file with the same name
+void CLibrary::extractMember(uint32_t i) {
+    SLibraryItem & item = items[i];
+    CFileBuffer member;
+    member.share(item.source ? newData : (CMemoryBuffer&)*this, item.offset, item.size);
+    member.outputFileName = (const char*)itemNames.buf() + item.name;
+    if (cmd.verbose) printf("\nExtracting %s", member.outputFileName);
+    member.write();
+}
+
+// Print list of members and public symbols
+void CLibrary::listMembers() {
+    printf("\nLibrary %s: %u members, %u public symbols", fileName, numMembers(), header ? header->numSymbols : 0);
+    if (header == 0) return;
+    for (uint32_t m = 0; m < header->numMembers; m++) {
+        SLibraryMember & member = memberTable[m];
+        printf("\n%s, size 0x%llX", memberName(m), (unsigned long long)member.size);
+        for (uint32_t n = member.firstSymbol; n < member.firstSymbol + member.numSymbols; n++) {
+            printf("\n    %s", stringTable + symbolList[n].string);
+        }
+    }
+}
+
+// Make new directory. The public names of old members are taken from the old directory,
+// so that only the new members need to be parsed. items[].newOffset must be set
+void CLibrary::makeDirectory() {
+    uint32_t i, n;                               // member index, name index
+    uint32_t numItems = items.numEntries();
+    newStrings.pushString("");                   // name offset 0 means vacant hash entry
+
+    // make member table and symbol list
+    for (i = 0; i < numItems; i++) {
+        SLibraryItem & item = items[i];
+        SLibraryMember member;
+        memset(&member, 0, sizeof(member));
+        member.offset = item.newOffset;
+        member.size = item.size;
+        member.name = (uint32_t)newStrings.pushString((const char*)itemNames.buf() + item.name);
+        member.firstSymbol = newNames.numEntries();
+        if (item.source == 0) {
+            // copy public names of old member
+            SLibraryMember & oldMember = memberTable[item.oldMember];
+            for (n = oldMember.firstSymbol; n < oldMember.firstSymbol + oldMember.numSymbols; n++) {
+                SStringEntry se = {(uint32_t)newStrings.pushString(stringTable + symbolList[n].string), i};
+                newNames.push(se);
+            }
+        }
+        else {
+            // find public names of new member
+            CELF elf;
+            elf.share(newData, item.offset, item.size);
+            elf.fileName = (const char*)itemNames.buf() + item.name;
+            elf.publicNames(&newStrings, &newNames, i);
+        }
+        member.numSymbols = newNames.numEntries() - member.firstSymbol;
+        newMembers.push(member);
+    }
+    if (err.number()) return;
+
+    // make hash table. The size is a power of 2, at least twice the number of names
+    uint32_t numNames = newNames.numEntries();
+    uint32_t tableSize = 16;
+    while (tableSize < numNames * 2) tableSize <<= 1;
+    newHashTable.setNum(tableSize);
+    for (n = 0; n < numNames; n++) {
+        const char * name = (const char*)newStrings.buf() + newNames[n].string;
+        uint32_t hash = linkNameHash(name);
+        uint32_t h = hash & (tableSize - 1);
+        while (true) {
+            SLibraryHashEntry & entry = newHashTable[h];
+            if (entry.name == 0) {               // vacant. insert symbol
+                entry.hash = hash;
+                entry.name = newNames[n].string;
+                entry.member = newNames[n].member;
+                break;
+            }
+            if (entry.hash == hash && strcmp((const char*)newStrings.buf() + entry.name, name) == 0) {
+                // symbol already defined in a previous member. Warn only for new members
+                if (items[newNames[n].member].source) {
+                    err.submit(ERR_LIBRARY_DUPLICATE_SYMBOL, name, (const char*)itemNames.buf() + items[newNames[n].member].name);
+                }
+                break;
+            }
+            h = (h + 1) & (tableSize - 1);       // linear probing
+        }
+    }
+}
+
+// Make file header for new directory at directoryOffset
+void CLibrary::makeHeader(SLibraryHeader & newHeader, uint64_t directoryOffset) {
+    uint32_t numSymbols = 0;                     // number of symbols in hash table
+    for (uint32_t h = 0; h < newHashTable.numEntries(); h++) {
+        if (newHashTable[h].name) numSymbols++;
+    }
+    memset(&newHeader, 0, sizeof(newHeader));
+    memcpy(newHeader.signature, LIBRARY_SIGNATURE, sizeof(LIBRARY_SIGNATURE));
+    newHeader.version = LIBRARY_VERSION;
+    newHeader.numMembers = newMembers.numEntries();
+    newHeader.numNames = newNames.numEntries();
+    newHeader.numSymbols = numSymbols;
+    newHeader.hashTableSize = newHashTable.numEntries();
+    newHeader.memberTableOffset = directoryOffset;
+    newHeader.symbolListOffset = newHeader.memberTableOffset + newMembers.dataSize();
+    newHeader.hashTableOffset = newHeader.symbolListOffset + newNames.dataSize();
+    newHeader.stringTableOffset = newHeader.hashTableOffset + newHashTable.dataSize();
+    newHeader.stringTableSize = newStrings.dataSize();
+    newHeader.directorySize = newHeader.stringTableOffset + newHeader.stringTableSize - directoryOffset;
+    newHeader.unusedSize = unusedSize;
+}
+
+// Make new library file with all members and no unused space
+void CLibrary::makeLibrary() {
+    uint32_t i;                                  // member index
+    uint32_t numItems = items.numEntries();
+    // place members at aligned offsets after the header
+    uint64_t pos = sizeof(SLibraryHeader);
+    for (i = 0; i < numItems; i++) {
+        pos = (pos + LIBRARY_MEMBER_ALIGN - 1) & ~(uint64_t)(LIBRARY_MEMBER_ALIGN - 1);
+        items[i].newOffset = pos;
+        pos += items[i].size;
+    }
+    uint64_t directoryOffset = (pos + 7) & ~(uint64_t)7;
+    unusedSize = 0;
+    makeDirectory();
+    if (err.number()) return;
+    SLibraryHeader newHeader;
+    makeHeader(newHeader, directoryOffset);
+
+    // put everything into new file buffer
+    CFileBuffer newFile;
+    newFile.setSize(directoryOffset + newHeader.directorySize);
+    newFile.push(&newHeader, sizeof(newHeader));
+    for (i = 0; i < numItems; i++) {
+        SLibraryItem & item = items[i];
+        newFile.align(LIBRARY_MEMBER_ALIGN);
+        newFile.push((item.source ? newData.buf() : buf()) + item.offset, item.size);
+    }
+    newFile.align(8);
+    newFile.push(newMembers.buf(), newMembers.dataSize());
+    newFile.push(newNames.buf(), newNames.dataSize());
+    newFile.push(newHashTable.buf(), newHashTable.dataSize());
+    newFile.push(newStrings.buf(), newStrings.dataSize());
+    // replace old library
+    items.setNum(0);
+    newFile.setFileType(FILETYPE_FWC_LIB);
+    newFile >> *this;
+    outputFileName = cmd.outputFile;
+    parse();
+}
+
+// Append new members and new directory to the existing library file, then change the header.
+// The old members are not read or written. The old header remains valid until the new
+// directory has been written.
+// Only the member data is incremental. The whole directory (member table, symbol list, hash table
+// and string table) is rebuilt and appended by every update, so the cost of an update grows with
+// the number of members and public names, and the file grows by the size of the directory until
+// the unused space is removed by a full rewrite
+void CLibrary::updateLibrary() {
+    uint32_t i;                                  // member index
+    uint32_t numItems = items.numEntries();
+    uint64_t oldSize = dataSize();
+    unusedSize += header->directorySize;         // old directory is no longer used
+    // place new members after the end of the old file
+    uint64_t pos = oldSize;
+    for (i = 0; i < numItems; i++) {
+        if (items[i].source == 0) continue;      // old member stays in place
+        pos = (pos + LIBRARY_MEMBER_ALIGN - 1) & ~(uint64_t)(LIBRARY_MEMBER_ALIGN - 1);
+        items[i].newOffset = pos;
+        pos += items[i].size;
+    }
+    uint64_t directoryOffset = (pos + 7) & ~(uint64_t)7;
+    makeDirectory();
+    if (err.number()) return;
+    SLibraryHeader newHeader;
+    makeHeader(newHeader, directoryOffset);
+
+    // make the data to append
+    CMemoryBuffer tail;
+    tail.setSize(directoryOffset + newHeader.directorySize - oldSize);
+    for (i = 0; i < numItems; i++) {
+        SLibraryItem & item = items[i];
+        if (item.source == 0) continue;
+        tail.push(0, item.newOffset - oldSize - tail.dataSize());  // alignment
+        tail.push(newData.buf() + item.offset, item.size);
+    }
+    tail.push(0, directoryOffset - oldSize - tail.dataSize());
+    tail.push(newMembers.buf(), newMembers.dataSize());
+    tail.push(newNames.buf(), newNames.dataSize());
+    tail.push(newHashTable.buf(), newHashTable.dataSize());
+    tail.push(newStrings.buf(), newStrings.dataSize());
+
+    // release the old file before writing to it
+    items.setNum(0);
+    clear();
+    header = 0;
+
+    FILE * file = fopen(fileName, "r+b");
+    bool ok = file != 0 && fseek(file, 0, SEEK_END) == 0 && fwrite(tail.buf(), 1, (size_t)tail.dataSize(), file) == tail.dataSize()
+        && fflush(file) == 0 && fseek(file, 0, SEEK_SET) == 0 && fwrite(&newHeader, 1, sizeof(newHeader), file) == sizeof(newHeader);
+    if (file && fclose(file)) ok = false;
+    if (!ok) {
+        err.submit(ERR_OUTPUT_FILE, fileName);  return;
+    }
+    if ((cmd.libraryOptions & CMDL_LIBRARY_LIST) || cmd.libraryOptions == 0) {
+        read();                                  // read the updated library for listing
+        parse();
+    }
+}
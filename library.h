@@ -0,0 +1,127 @@
+/****************************    library.h    *********************************
+* Author:        Agner Fog
+* Date created:  2017-11-20
+* Last modified: 2017-11-20
+* Version:       1.00
+* Project:       Binary tools for ForwardCom instruction set
+* Module:        library.h
+* Description:
+* Header file for library manager
+*
+* Copyright 2017 GNU General Public License http://www.gnu.org/licenses
+*****************************************************************************/
+#pragma once
+
+/* Format of ForwardCom library file:
+
+SLibraryHeader           File header
+Members                  Object files. Each member begins at a file offset divisible by
+                         LIBRARY_MEMBER_ALIGN, so that it can be used in place when the
+                         library is memory mapped
+Directory:
+SLibraryMember[]         One record for each member
+SStringEntry[]           Symbol list: public symbols of each member, in member order
+SLibraryHashEntry[]      Hash table of public symbols. The size is a power of 2
+String table             Member names and symbol names
+
+The hash table uses linkNameHash and linear probing. An entry with name = 0 is vacant.
+A linker can find the member that defines a symbol by looking up the name in the hash
+table, without reading the members. If more than one member defines the same symbol,
+only the first one is indexed.
+
+A library is updated by appending the new members and a new directory at the end of
+the file and then changing the header to point to the new directory. Unchanged members
+stay in place, and the directory is made from the old directory without reading the
+old members. The space of replaced members and old directories is counted in
+unusedSize. The library is rewritten without unused space when unusedSize exceeds
+half of the file size.
+*/
+
+const char     LIBRARY_SIGNATURE[8] = {'!','<','f','w','l','i','b','>'};
+const uint32_t LIBRARY_VERSION      = 1;
+const uint32_t LIBRARY_MEMBER_ALIGN = 4096;  // alignment of members in file
+const uint32_t LIBRARY_NOT_FOUND    = 0xFFFFFFFF; // member index if symbol not found
+
+// Library file header
+struct SLibraryHeader {
+    char     signature[8];                 // LIBRARY_SIGNATURE
+    uint32_t version;                      // LIBRARY_VERSION
+    uint32_t numMembers;                   // number of members
+    uint32_t numNames;                     // number of entries in symbol list
+    uint32_t numSymbols;                   // number of symbols in hash table
+    uint32_t hashTableSize;                // number of entries in hash table
+    uint64_t memberTableOffset;            // file offset of member table. The directory begins here
+    uint64_t symbolListOffset;             // file offset of symbol list
+    uint64_t hashTableOffset;              // file offset of hash table
+    uint64_t stringTableOffset;            // file offset of string table
+    uint64_t stringTableSize;              // size of string table
+    uint64_t directorySize;                // size of directory. The directory ends at the end of the file
+    uint64_t unusedSize;                   // size of replaced members and old directories
+};
+
+// Library member record
+struct SLibraryMember {
+    uint64_t offset;                       // file offset of member
+    uint64_t size;                         // size of member
+    uint32_t name;                         // member name, offset into string table
+    uint32_t firstSymbol;                  // index of first public symbol in symbol list
+    uint32_t numSymbols;                   // number of public symbols defined in member
+    uint32_t reserved;                     // 0
+};
+
+// Entry in hash table of public symbols
+struct SLibraryHashEntry {
+    uint32_t hash;                         // linkNameHash of name
+    uint32_t name;                         // symbol name, offset into string table. 0 if vacant
+    uint32_t member;                       // index of member that defines the symbol
+    uint32_t reserved;                     // 0
+};
+
+// Member to put into new library file
+struct SLibraryItem {
+    uint64_t offset;                       // offset of member data in source buffer
+    uint64_t size;                         // size of member
+    uint64_t newOffset;                    // offset of member in new library file
+    uint32_t name;                         // member name, offset into itemNames
+    uint32_t source;                       // 0: old library file, 1: newData
+    uint32_t oldMember;                    // index of member in old library if source = 0
+};
+
+// Library manager class. Also used by the linker for searching libraries
+class CLibrary : public CFileBuffer {
+public:
+    CLibrary();                                  // Constructor
+    void go();                                   // Do the library commands from the command line
+    bool parse();                                // Check library file. Return false if invalid
+    uint32_t numMembers();                       // Number of members
+    const char * memberName(uint32_t m);         // Name of member
+    uint32_t findSymbol(const char * name, uint32_t hash); // Find member that defines symbol
+    void getMember(uint32_t m, CFileBuffer & member); // Use member in place
+protected:
+    SLibraryHeader * header;                     // Library header in buffer
+    SLibraryMember * memberTable;                // Member table in buffer
+    SStringEntry * symbolList;                   // Symbol list in buffer
+    SLibraryHashEntry * hashTable;               // Hash table in buffer
+    const char * stringTable;                    // String table in buffer
+    CDynamicArray<SLibraryItem> items;           // Members of new library
+    CMemoryBuffer itemNames;                     // Names of new members
+    CMemoryBuffer newData;                       // Contents of added members
+    CDynamicArray<SLibraryMember> newMembers;    // Member table of new directory
+    CDynamicArray<SStringEntry> newNames;        // Symbol list of new directory
+    CDynamicArray<SLibraryHashEntry> newHashTable; // Hash table of new directory
+    CMemoryBuffer newStrings;                    // String table of new directory
+    uint64_t unusedSize;                         // Size of replaced members and old directories
+    bool modified;                               // Library must be written
+    uint32_t findItem(const char * name);        // Find member of new library by name
+    void addMember(const char * fileName);       // Add or replace member
+    void deleteMember(const char * name);        // Remove member
+    void extractMember(uint32_t i);              // Write member to file
+    void listMembers();                          // Print list of members and public symbols
+    void makeDirectory();                        // Make new directory from old directory and new members
+    void makeHeader(SLibraryHeader & newHeader, uint64_t directoryOffset); // Make header for new directory
+    void makeLibrary();                          // Make new library file with all members
+    void updateLibrary();                        // Append new members and directory to existing library file
+};
+
+// Get file name without path
+const char * removePath(const char * fileName);
@@ -0,0 +1,762 @@
+/****************************    linker.cpp    ********************************
+* Author:        Agner Fog
+* Date created:  2017-11-14
+* Last modified: 2017-11-14
+* Version:       1.00
+* Project:       Binary tools for ForwardCom instruction set
+* Module:        linker.cpp
+* Description:
+* Linker for ForwardCom. Links object files into an executable file
+*
+* The object files are split into containers and appended to common lists of
+* sections, symbols, and relocations. Public symbols are entered into a hash table
+* so that each external symbol is resolved with a single lookup. Sections are joined
+* into groups, see linker.h. The input sections occupy separate parts of the
+* output image, so they can be copied and relocated by multiple threads.
+*
+* Library members are loaded if they define a symbol that is still unresolved 
+* after all object files have been loaded. The member is found by a lookup in
+* the hash table index of the library, see library.h
+*
+* Copyright 2017 GNU General Public License http://www.gnu.org/licenses
+*****************************************************************************/
+#include "stdafx.h"
+
+// Hash function for symbol names (FNV-1a)
+uint32_t linkNameHash(const char * name) {
+    uint32_t hash = 2166136261u;
+    while (*name) {
+        hash = (hash ^ (uint8_t)*name++) * 16777619u;
+    }
+    return hash;
+}
+
+// Check if value fits into a relocation field of the specified number of bits
+static bool fitsInBits(int64_t value, uint32_t bits, bool isSigned) {
+    if (isSigned) {
+        return value >= -((int64_t)1 << (bits - 1)) && value < ((int64_t)1 << (bits - 1));
+    }
+    return ((uint64_t)value >> bits) == 0;
+}
+
+CLinker::CLinker() {
+    // Constructor
+    memset(groupBase, 0, sizeof(groupBase));
+    memset(groupSize, 0, sizeof(groupSize));
+    memset(groupFileSize, 0, sizeof(groupFileSize));
+    memset(groupAlign, 0, sizeof(groupAlign));
+    entrySymbol = 0;
+    numLibraries = 0;
+    hashedSymbols = 0;
+    numPublicSymbols = 0;
+}
+
+void CLinker::go() {
+    // Do the linking
+    uint32_t i;                                  // loop counter
+    inputStrings.pushString("");                 // name offset 0 means no name
+    SLinkSection nullSection;                    // input section 0 means no section
+    memset(&nullSection, 0, sizeof(nullSection));
+    inputSections.push(nullSection);
+    SLinkOutSection nullOutSection;              // output section 0 means not loaded
+    memset(&nullOutSection, 0, sizeof(nullOutSection));
+    outSections.push(nullOutSection);
+
+    // Read object files and libraries. The first file has been read into this buffer by CConverter
+    libraries.setSize(cmd.linkFiles.numEntries());
+    for (i = 0; i < cmd.linkFiles.numEntries(); i++) {
+        CELF module;
+        if (i == 0) *this >> module;
+        else {
+            module.fileName = cmd.linkFiles[i];
+            module.read();
+        }
+        if (err.number()) return;
+        if (module.getFileType() == FILETYPE_FWC_LIB) {
+            // library. members are loaded later if needed
+            CLibrary & library = libraries[numLibraries++];
+            module >> library;
+            library.parse();
+        }
+        else addModule(module);
+        if (err.number()) return;
+    }
+    makeSymbolTable();                           // make hash table of public symbols and search libraries
+    if (err.number()) return;
+    if (cmd.verbose) {
+        printf("\nLinking %u object files into %s", (uint32_t)modules.numEntries(), cmd.outputFile);
+    }
+    resolveSymbols();                            // find the definition of each external symbol
+    layoutSections();                            // assign addresses to sections
+    if (err.number()) return;
+    makeInitArrays();                            // make lists of constructors and destructors
+    sortRelocations();                           // order relocations by section
+    applyRelocations();                          // fill sections and insert addresses
+    if (err.number()) return;
+    makeOutput();                                // make executable file
+    if (err.number()) return;
+    fileName = cmd.outputFile;
+    write();                                     // write output file
+}
+
+// Add object file to the input lists
+void CLinker::addModule(CELF & module) {
+    uint32_t i;                                  // loop counter
+    if (module.getFileType() != FILETYPE_ELF || module.executable || module.machineType != EM_FORWARDCOM) {
+        err.submit(ERR_LINK_FILE_TYPE, module.fileName);
+        return;
+    }
+    if (module.split()) return;                  // split ELF file into containers
+    if (err.number()) return;
+
+    SLinkModule mod;                             // module record
+    mod.fileName = module.fileName;
+    mod.firstSection = inputSections.numEntries();
+    mod.numSections = module.getSectionHeaders().numEntries();
+    mod.firstSymbol = inputSymbols.numEntries();
+    mod.numSymbols = module.getSymbols().numEntries();
+    uint32_t moduleIndex = modules.push(mod);
+
+    // copy names and section data
+    uint32_t stringOffset = (uint32_t)inputStrings.push(module.getStringBuffer().buf(), module.getStringBuffer().dataSize());
+    uint64_t dataOffset = inputData.push(module.getDataBuffer().buf(), module.getDataBuffer().dataSize());
+
+    // copy section headers
+    Elf64_Shdr const * sectionHeaders = (Elf64_Shdr const *)module.getSectionHeaders().buf();
+    for (i = 0; i < mod.numSections; i++) {
+        SLinkSection sec;
+        memset(&sec, 0, sizeof(sec));
+        sec.name = stringOffset + sectionHeaders[i].sh_name;
+        sec.type = sectionHeaders[i].sh_type;
+        sec.flags = sectionHeaders[i].sh_flags;
+        sec.size = sectionHeaders[i].sh_size;
+        sec.align = sectionHeaders[i].sh_addralign ? sectionHeaders[i].sh_addralign : 1;
+        if (sec.type != SHT_NOBITS) {
+            sec.offset = dataOffset + sectionHeaders[i].sh_offset;
+            if (sectionHeaders[i].sh_offset + sec.size > module.getDataBuffer().dataSize()) {
+                err.submit(ERR_ELF_INDEX_RANGE);  sec.size = 0;
+            }
+        }
+        sec.module = moduleIndex;
+        inputSections.push(sec);
+    }
+
+    // copy symbols. Section indexes are translated to indexes into inputSections
+    ElfFWC_Sym const * symbols = (ElfFWC_Sym const *)module.getSymbols().buf();
+    for (i = 0; i < mod.numSymbols; i++) {
+        ElfFWC_Sym sym = symbols[i];
+        if (sym.st_name) sym.st_name += stringOffset;
+        if (sym.st_shndx && sym.st_shndx != SHN_ABS) {
+            if (sym.st_shndx < mod.numSections) sym.st_shndx += mod.firstSection;
+            else {
+                err.submit(ERR_ELF_INDEX_RANGE);  sym.st_shndx = 0;
+            }
+        }
+        uint32_t symi = inputSymbols.push(sym);
+        if (sym.st_shndx && (sym.st_other & (STV_CTOR | STV_DTOR))) {
+            // constructor or destructor. priority is in the low 16 bits of st_reguse1
+            SLinkInitRecord rec = {sym.st_reguse1 & 0xFFFF, symi};
+            if (sym.st_other & STV_CTOR) constructors.push(rec);
+            if (sym.st_other & STV_DTOR) destructors.push(rec);
+        }
+    }
+
+    // copy relocations. Section and symbol indexes are translated
+    ElfFWC_Rela2 const * relocations = (ElfFWC_Rela2 const *)module.getRelocations().buf();
+    uint32_t numRelocations = module.getRelocations().numEntries();
+    for (i = 0; i < numRelocations; i++) {
+        ElfFWC_Rela2 rel = relocations[i];
+        if (rel.r_section >= mod.numSections || rel.r_sym >= mod.numSymbols || rel.r_refsym >= mod.numSymbols) {
+            err.submit(ERR_ELF_INDEX_RANGE);
+            continue;
+        }
+        rel.r_section += mod.firstSection;
+        if (rel.r_sym) rel.r_sym += mod.firstSymbol;
+        if (rel.r_refsym) rel.r_refsym += mod.firstSymbol;
+        inputRelocations.push(rel);
+    }
+}
+
+// Get symbol name or section name
+const char * CLinker::inputName(uint32_t nameOffset) {
+    if (nameOffset >= inputStrings.dataSize()) return "?";
+    return (const char *)inputStrings.buf() + nameOffset;
+}
+
+// Get name of module that contains symbol
+const char * CLinker::symbolModuleName(uint32_t symi) {
+    // binary search for the last module with firstSymbol <= symi
+    uint32_t a = 0, b = modules.numEntries();
+    while (b - a > 1) {
+        uint32_t c = (a + b) / 2;
+        if (modules[c].firstSymbol <= symi) a = c; else b = c;
+    }
+    return modules[a].fileName;
+}
+
+// Make hash table of public symbols
+void CLinker::makeSymbolTable() {
+    addPublicSymbols();                          // symbols of object files
+    searchLibraries();                           // symbols of library members
+    if (modules.numEntries() == 0) {
+        err.submit(ERR_LINK_NO_INPUT);  return;
+    }
+    if (entrySymbol == 0) {
+        // no symbol marked as main entry. search for main or _main
+        entrySymbol = findSymbol("main", linkNameHash("main"));
+        if (entrySymbol == 0) entrySymbol = findSymbol("_main", linkNameHash("_main"));
+    }
+}
+
+// Enter public symbols of the modules added since last call into hash table
+void CLinker::addPublicSymbols() {
+    uint32_t symi;                               // symbol index
+    uint32_t numSymbols = inputSymbols.numEntries();
+    uint32_t numPublic = numPublicSymbols;       // number of public symbol definitions
+    for (symi = hashedSymbols; symi < numSymbols; symi++) {
+        ElfFWC_Sym & sym = inputSymbols[symi];
+        if (sym.st_bind != STB_LOCAL && sym.st_shndx && sym.st_name) numPublic++;
+    }
+    // table size is a power of 2, at least twice the number of entries
+    uint32_t tableSize = 16;
+    while (tableSize < numPublic * 2) tableSize <<= 1;
+    if (tableSize > symbolHash.numEntries()) {
+        // make bigger table and move old entries to it
+        CDynamicArray<SLinkHashEntry> newTable;
+        newTable.setNum(tableSize);
+        for (uint32_t i = 0; i < symbolHash.numEntries(); i++) {
+            if (symbolHash[i].symbol == 0) continue;
+            uint32_t h = symbolHash[i].hash & (tableSize - 1);
+            while (newTable[h].symbol) h = (h + 1) & (tableSize - 1);
+            newTable[h] = symbolHash[i];
+        }
+        newTable >> symbolHash;
+    }
+
+    for (symi = hashedSymbols; symi < numSymbols; symi++) {
+        ElfFWC_Sym & sym = inputSymbols[symi];
+        if (sym.st_bind == STB_LOCAL || sym.st_shndx == 0 || sym.st_name == 0) continue;
+        if (sym.st_type == STT_SECTION || sym.st_type == STT_FILE) continue;
+        const char * name = inputName(sym.st_name);
+        uint32_t hash = linkNameHash(name);
+        uint32_t h = hash & (tableSize - 1);
+        while (true) {
+            SLinkHashEntry & entry = symbolHash[h];
+            if (entry.symbol == 0) {                       // vacant. insert symbol
+                entry.hash = hash;  entry.symbol = symi;
+                numPublicSymbols++;
+                break;
+            }
+            if (entry.hash == hash && strcmp(inputName(inputSymbols[entry.symbol].st_name), name) == 0) {
+                // same name defined twice
+                if (inputSymbols[entry.symbol].st_bind == STB_WEAK && sym.st_bind != STB_WEAK) {
+                    entry.symbol = symi;                   // strong definition overrides weak definition
+                }
+                else if (sym.st_bind != STB_WEAK) {
+                    err.submit(ERR_LINK_DUPLICATE_SYMBOL, name, symbolModuleName(symi));
+                }
+                break;
+            }
+            h = (h + 1) & (tableSize - 1);                 // linear probing
+        }
+        if ((sym.st_other & STV_MAIN) && entrySymbol == 0) entrySymbol = symi;
+    }
+    hashedSymbols = numSymbols;
+}
+
+// Load library members that define symbols which are still unresolved.
+// Symbols referenced by the loaded members are searched for too
+void CLinker::searchLibraries() {
+    uint32_t symi;                               // symbol index
+    uint32_t lib;                                // library index
+    for (symi = 0; symi < inputSymbols.numEntries(); symi++) {
+        ElfFWC_Sym sym = inputSymbols[symi];
+        if (sym.st_shndx || sym.st_name == 0 || sym.st_bind != STB_GLOBAL) continue;  // not a strong external reference
+        const char * name = inputName(sym.st_name);
+        uint32_t hash = linkNameHash(name);
+        if (findSymbol(name, hash)) continue;    // already defined
+        for (lib = 0; lib < numLibraries; lib++) {
+            uint32_t m = libraries[lib].findSymbol(name, hash);
+            if (m == LIBRARY_NOT_FOUND) continue;
+            CELF member;
+            libraries[lib].getMember(m, member);
+            addModule(member);
+            addPublicSymbols();                  // the symbol is now defined
+            break;
+        }
+        if (err.number()) return;
+    }
+}
+
+// Find public symbol in hash table. Returns 0 if not found
+uint32_t CLinker::findSymbol(const char * name, uint32_t hash) {
+    uint32_t mask = symbolHash.numEntries() - 1;
+    uint32_t h = hash & mask;
+    while (true) {
+        SLinkHashEntry & entry = symbolHash[h];
+        if (entry.symbol == 0) return 0;
+        if (entry.hash == hash && strcmp(inputName(inputSymbols[entry.symbol].st_name), name) == 0) {
+            return entry.symbol;
+        }
+        h = (h + 1) & mask;
+    }
+}
+
+// Find the definition of each external symbol
+void CLinker::resolveSymbols() {
+    uint32_t symi;                               // symbol index
+    uint32_t reli;                               // relocation index
+    symbolTarget.setNum(inputSymbols.numEntries());
+    for (symi = 0; symi < inputSymbols.numEntries(); symi++) {
+        ElfFWC_Sym & sym = inputSymbols[symi];
+        if (sym.st_shndx) {
+            symbolTarget[symi] = symi;               // local definition
+        }
+        else if (sym.st_name && sym.st_bind != STB_LOCAL) {
+            const char * name = inputName(sym.st_name);
+            symbolTarget[symi] = findSymbol(name, linkNameHash(name));
+        }
+    }
+    // report unresolved symbols that are used in relocations. weak symbols get the value zero
+    for (reli = 0; reli < inputRelocations.numEntries(); reli++) {
+        uint32_t type = inputRelocations[reli].r_type & R_FORW_RELTYPEMASK;
+        if (type >= R_FORW_SYSFUNC) continue;          // resolved by the loader
+        uint32_t syms[2] = {inputRelocations[reli].r_sym, inputRelocations[reli].r_refsym};
+        for (uint32_t j = 0; j < 2; j++) {
+            symi = syms[j];
+            if (symi == 0 || symbolTarget[symi] || inputSymbols[symi].st_bind == STB_WEAK) continue;
+            err.submit(ERR_LINK_UNRESOLVED, inputName(inputSymbols[symi].st_name), symbolModuleName(symi));
+            inputSymbols[symi].st_bind = STB_WEAK;     // report only once
+        }
+    }
+}
+
+// Find or make output section for input section
+uint32_t CLinker::findOutSection(SLinkSection const & sec) {
+    uint32_t os;                                 // output section index
+    const uint64_t flagMask = SHF_EXEC | SHF_READ | SHF_WRITE | SHF_IP | SHF_DATAP | SHF_THREADP;
+    const char * name = inputName(sec.name);
+    for (os = 1; os < outSections.numEntries(); os++) {
+        SLinkOutSection & out = outSections[os];
+        if (out.type == sec.type && (out.flags & flagMask) == (sec.flags & flagMask) && strcmp(inputName(out.name), name) == 0) {
+            return os;
+        }
+    }
+    // make new output section
+    SLinkOutSection out;
+    memset(&out, 0, sizeof(out));
+    out.name = sec.name;
+    out.type = sec.type;
+    out.flags = sec.flags;
+    out.align = 1;
+    // determine group from addressing mode or access rights
+    if (sec.flags & SHF_THREADP) out.group = LINK_GROUP_THREADP;
+    else if (sec.flags & SHF_DATAP) out.group = LINK_GROUP_DATAP;
+    else if (sec.flags & SHF_IP) out.group = LINK_GROUP_IP;
+    else if (sec.flags & SHF_WRITE) out.group = LINK_GROUP_DATAP;
+    else out.group = LINK_GROUP_IP;
+    static const uint64_t groupFlags[LINK_GROUP_NUM] = {SHF_IP, SHF_DATAP, SHF_THREADP};
+    out.flags |= groupFlags[out.group];
+    // read-only data before code, initialized data before uninitialized data
+    out.order = ((sec.flags & SHF_EXEC) ? 1 : 0) | (sec.type == SHT_NOBITS ? 2 : 0);
+    return outSections.push(out);
+}
+
+// Join input sections into output sections and assign addresses
+void CLinker::layoutSections() {
+    uint32_t i;                                  // input section index
+    uint32_t os;                                 // output section index
+    for (i = 1; i < inputSections.numEntries(); i++) {
+        SLinkSection & sec = inputSections[i];
+        if (!(sec.flags & SHF_ALLOC)) continue;  // not loaded
+        if (sec.type != SHT_PROGBITS && sec.type != SHT_NOBITS) continue;
+        os = findOutSection(sec);
+        SLinkOutSection & out = outSections[os];
+        sec.outSection = os;
+        sec.address = (out.size + sec.align - 1) & ~(sec.align - 1);
+        out.size = sec.address + sec.size;
+        if (sec.align > out.align) out.align = sec.align;
+        // append to list of input sections
+        if (out.firstInput == 0) out.firstInput = i;
+        else inputSections[out.lastInput].next = i;
+        out.lastInput = i;
+    }
+    // make sections for constructor and destructor lists
+    for (uint32_t d = 0; d < 2; d++) {
+        uint32_t num = d ? destructors.numEntries() : constructors.numEntries();
+        if (num == 0) continue;
+        SLinkOutSection out;
+        memset(&out, 0, sizeof(out));
+        out.name = (uint32_t)inputStrings.pushString(d ? "fini_array" : "init_array");
+        out.type = d ? SHT_FINI_ARRAY : SHT_INIT_ARRAY;
+        out.flags = SHF_ALLOC | SHF_READ | SHF_IP;
+        out.align = 4;
+        out.size = num * 4;
+        out.group = LINK_GROUP_IP;
+        outSections.push(out);
+    }
+
+    // assign addresses. The groups are placed consecutively
+    for (os = 1; os < outSections.numEntries(); os++) {
+        SLinkOutSection & out = outSections[os];
+        if (out.align > groupAlign[out.group]) groupAlign[out.group] = out.align;
+    }
+    uint64_t address = 0;                        // address of group
+    for (uint32_t g = 0; g < LINK_GROUP_NUM; g++) {
+        if (groupAlign[g] < LINK_GROUP_ALIGN) groupAlign[g] = LINK_GROUP_ALIGN;
+        address = (address + groupAlign[g] - 1) & ~(groupAlign[g] - 1);
+        groupBase[g] = address;
+        uint64_t pos = 0;                        // address relative to group
+        for (uint32_t order = 0; order < 4; order++) {
+            for (os = 1; os < outSections.numEntries(); os++) {
+                SLinkOutSection & out = outSections[os];
+                if (out.group != g || out.order != order) continue;
+                pos = (pos + out.align - 1) & ~(out.align - 1);
+                out.address = pos;
+                pos += out.size;
+                if (out.type != SHT_NOBITS) groupFileSize[g] = pos;
+                outSectionOrder.push(os);
+            }
+        }
+        groupSize[g] = pos;
+        address += pos;
+    }
+
+    // reserve image of the initialized output sections. The contents are filled in by applyRelocations
+    for (uint32_t j = 0; j < outSectionOrder.numEntries(); j++) {
+        os = outSectionOrder[j];
+        SLinkOutSection & out = outSections[os];
+        if (out.type == SHT_NOBITS) continue;
+        out.imageOffset = image.push(0, out.size);
+        for (i = out.firstInput; i; i = inputSections[i].next) {
+            fillOrder.push(i);
+        }
+    }
+}
+
+// Make sections with constructors and destructors
+void CLinker::makeInitArrays() {
+    uint32_t os;                                 // output section index
+    for (os = 1; os < outSections.numEntries(); os++) {
+        SLinkOutSection & out = outSections[os];
+        if (out.type != SHT_INIT_ARRAY && out.type != SHT_FINI_ARRAY) continue;
+        CDynamicArray<SLinkInitRecord> & list = out.type == SHT_INIT_ARRAY ? constructors : destructors;
+        list.sort();                             // stable sort by priority
+        for (uint32_t i = 0; i < list.numEntries(); i++) {
+            uint64_t address = symbolAddress(list[i].symbol) - groupBase[LINK_GROUP_IP];
+            image.get<uint32_t>(out.imageOffset + i * 4) = (uint32_t)(address >> 2);
+        }
+    }
+}
+
+// Make relocationOrder: relocation indexes sorted by input section
+void CLinker::sortRelocations() {
+    uint32_t i;                                  // loop counter
+    uint32_t numSections = inputSections.numEntries();
+    uint32_t numRelocations = inputRelocations.numEntries();
+    // count relocations for each section
+    for (i = 0; i < numRelocations; i++) {
+        inputSections[inputRelocations[i].r_section].firstRelocation++;
+    }
+    // convert counts to start positions
+    uint32_t pos = 0;
+    for (i = 0; i < numSections; i++) {
+        uint32_t count = inputSections[i].firstRelocation;
+        inputSections[i].firstRelocation = pos;
+        pos += count;
+    }
+    // distribute relocation indexes
+    CDynamicArray<uint32_t> fill;                // number of relocations placed for each section
+    fill.setNum(numSections);
+    relocationOrder.setNum(numRelocations);
+    for (i = 0; i < numRelocations; i++) {
+        uint32_t sec = inputRelocations[i].r_section;
+        relocationOrder[inputSections[sec].firstRelocation + fill[sec]++] = i;
+    }
+}
+
+// Copy input sections to image and apply relocations. 
+// Each input section is copied and relocated in one pass by one of the threads
+void CLinker::applyRelocations() {
+    uint32_t numFill = fillOrder.numEntries();   // number of sections to fill
+    if (numFill == 0) return;
+    CMetaBuffer<SLinkFillResult> results;        // loader relocations and errors for each section
+    results.setSize(numFill);
+    std::atomic<uint32_t> nextSection(0);        // next entry in fillOrder
+    uint32_t numThreads = cmd.threads;
+    if (numThreads > numFill) numThreads = numFill;
+    if (numThreads < 1) numThreads = 1;
+    CMetaBuffer<std::thread> threads;
+    if (numThreads > 1) threads.setSize(numThreads - 1);
+    for (uint32_t t = 1; t < numThreads; t++) {
+        threads[t-1] = std::thread(&CLinker::fillSections, this, &nextSection, &results);
+    }
+    fillSections(&nextSection, &results);
+    for (uint32_t t = 1; t < numThreads; t++) threads[t-1].join();
+
+    // Collect loader relocations and report errors in address order
+    for (uint32_t f = 0; f < numFill; f++) {
+        SLinkFillResult & result = results[f];
+        for (uint32_t r = 0; r < result.loaderRelocations.numEntries(); r++) {
+            loaderRelocations.push(result.loaderRelocations[r]);
+        }
+        for (uint32_t p = 0; p < result.problems.numEntries(); p++) {
+            SLinkProblem & problem = result.problems[p];
+            ElfFWC_Rela2 & rel = inputRelocations[problem.relocation];
+            const char * moduleName = modules[inputSections[rel.r_section].module].fileName;
+            switch (problem.errorNum) {
+            case ERR_LINK_RELOCATION_TYPE:
+                err.submit(problem.errorNum, rel.r_type, moduleName);  break;
+            case ERR_LINK_MISALIGNED: case ERR_LINK_OVERFLOW:
+                err.submit(problem.errorNum, inputName(inputSymbols[rel.r_sym].st_name), moduleName);  break;
+            default:
+                err.submit(problem.errorNum);
+            }
+        }
+    }
+}
+
+// Thread function for applyRelocations. Fill sections until there are no more
+void CLinker::fillSections(std::atomic<uint32_t> * nextSection, CMetaBuffer<SLinkFillResult> * results) {
+    uint32_t f;                                  // index into fillOrder
+    uint32_t num = fillOrder.numEntries();
+    while ((f = (*nextSection)++) < num) {
+        fillSection(fillOrder[f], (*results)[f]);
+    }
+}
+
+// Copy one input section to image and apply its relocations.
+// Writes only to the part of the image that belongs to this section
+void CLinker::fillSection(uint32_t i, SLinkFillResult & result) {
+    SLinkSection & sec = inputSections[i];
+    uint32_t os = sec.outSection;
+    if (sec.size) {
+        memcpy(image.buf() + outSections[os].imageOffset + sec.address, inputData.buf() + sec.offset, (size_t)sec.size);
+    }
+    uint32_t end = i + 1 < inputSections.numEntries() ? inputSections[i + 1].firstRelocation : relocationOrder.numEntries();
+    for (uint32_t r = sec.firstRelocation; r < end; r++) {
+        uint32_t reli = relocationOrder[r];
+        relocate(reli, os, sec.address + inputRelocations[reli].r_offset, result);
+    }
+}
+
+// Absolute address of symbol
+uint64_t CLinker::symbolAddress(uint32_t symi) {
+    ElfFWC_Sym & sym = inputSymbols[symi];
+    if (sym.st_shndx == 0) return 0;             // unresolved weak symbol
+    if (sym.st_shndx == SHN_ABS) return sym.st_value;
+    SLinkSection & sec = inputSections[sym.st_shndx];
+    if (sec.outSection == 0) return sym.st_value;
+    SLinkOutSection & out = outSections[sec.outSection];
+    return groupBase[out.group] + out.address + sec.address + sym.st_value;
+}
+
+// Apply one relocation. offset is the position of the relocated field relative to the output section.
+// May be called from multiple threads. Errors are stored in result
+void CLinker::relocate(uint32_t reli, uint32_t os, uint64_t offset, SLinkFillResult & result) {
+    ElfFWC_Rela2 const & rel = inputRelocations[reli];
+    SLinkOutSection & out = outSections[os];
+    uint32_t type = rel.r_type & R_FORW_RELTYPEMASK;
+    uint32_t size = rel.r_type & R_FORW_RELSIZEMASK;
+    uint32_t scale = rel.r_type & R_FORW_RELSCALEMASK;
+    SLinkProblem problem = {0, reli};
+
+    if (type >= R_FORW_SYSFUNC) {
+        // system function ids, stack size, and register use are resolved by the loader.
+        // keep the relocation in the executable file
+        ElfFWC_Rela2 rel2 = rel;
+        rel2.r_section = os;
+        rel2.r_offset = offset;
+        result.loaderRelocations.push(rel2);
+        return;
+    }
+
+    // size of field
+    uint32_t fieldSize;
+    switch (size) {
+    case R_FORW_8:
+        fieldSize = 1;  break;
+    case R_FORW_16: case R_FORW_32LO: case R_FORW_32HI:
+        fieldSize = 2;  break;
+    case R_FORW_24: case R_FORW_32: case R_FORW_64LO: case R_FORW_64HI:
+        fieldSize = 4;  break;
+    case R_FORW_64:
+        fieldSize = 8;  break;
+    default:
+        problem.errorNum = ERR_LINK_RELOCATION_TYPE;
+        result.problems.push(problem);
+        return;
+    }
+    // the field must be inside the input section. Written so that a huge r_offset cannot wrap around
+    SLinkSection const & sec = inputSections[rel.r_section];
+    if (out.type == SHT_NOBITS || rel.r_offset > sec.size || fieldSize > sec.size - rel.r_offset) {
+        problem.errorNum = ERR_ELF_INDEX_RANGE;
+        result.problems.push(problem);
+        return;
+    }
+    int8_t * field = image.buf() + out.imageOffset + offset;
+    uint64_t position = groupBase[out.group] + out.address + offset;  // address of field
+
+    // calculate value
+    int64_t value = (int64_t)symbolAddress(symbolTarget[rel.r_sym]) + rel.r_addend;
+    bool isSigned = true;
+    switch (type) {
+    case R_FORW_ABS:
+        isSigned = false;  break;
+    case R_FORW_SELFREL:
+        value -= position;  break;
+    case R_FORW_CONST:
+        value -= groupBase[LINK_GROUP_IP];  break;
+    case R_FORW_DATAP:
+        value -= groupBase[LINK_GROUP_DATAP];  break;
+    case R_FORW_THREADP:
+        value -= groupBase[LINK_GROUP_THREADP];  break;
+    case R_FORW_REFP:
+        value -= symbolAddress(symbolTarget[rel.r_refsym]);  break;
+    default:
+        problem.errorNum = ERR_LINK_RELOCATION_TYPE;
+        result.problems.push(problem);
+        return;
+    }
+    if (scale) {
+        if (value & (((int64_t)1 << scale) - 1)) {
+            problem.errorNum = ERR_LINK_MISALIGNED;
+            result.problems.push(problem);
+        }
+        value >>= scale;
+    }
+
+    // insert value
+    bool fits = true;
+    switch (size) {
+    case R_FORW_8:
+        fits = fitsInBits(value, 8, isSigned);
+        *field = (int8_t)value;
+        break;
+    case R_FORW_16:
+        fits = fitsInBits(value, 16, isSigned);
+        *(int16_t*)field = (int16_t)value;
+        break;
+    case R_FORW_24:                              // upper 8 bits of 32-bit word are preserved
+        fits = fitsInBits(value, 24, isSigned);
+        *(uint32_t*)field = (*(uint32_t*)field & 0xFF000000) | ((uint32_t)value & 0x00FFFFFF);
+        break;
+    case R_FORW_32:
+        fits = fitsInBits(value, 32, isSigned);
+        *(int32_t*)field = (int32_t)value;
+        break;
+    case R_FORW_32LO:
+        fits = fitsInBits(value, 32, isSigned);
+        *(uint16_t*)field = (uint16_t)value;
+        break;
+    case R_FORW_32HI:
+        fits = fitsInBits(value, 32, isSigned);
+        *(uint16_t*)field = (uint16_t)(value >> 16);
+        break;
+    case R_FORW_64:
+        *(int64_t*)field = value;
+        break;
+    case R_FORW_64LO:
+        *(uint32_t*)field = (uint32_t)value;
+        break;
+    case R_FORW_64HI:
+        *(uint32_t*)field = (uint32_t)(value >> 32);
+        break;
+    }
+    if (!fits) {
+        problem.errorNum = ERR_LINK_OVERFLOW;
+        result.problems.push(problem);
+    }
+}
+
+// Add symbol to output file and return new index
+uint32_t CLinker::outputSymbol(uint32_t symi) {
+    if (outSymbolIndex[symi]) return outSymbolIndex[symi];
+    ElfFWC_Sym sym = inputSymbols[symi];
+    if (sym.st_shndx && sym.st_shndx != SHN_ABS) {
+        SLinkSection & sec = inputSections[sym.st_shndx];
+        sym.st_shndx = outSections[sec.outSection].elfIndex;
+        sym.st_value += sec.address;
+    }
+    if (symi == entrySymbol) sym.st_other |= STV_MAIN;
+    outSymbolIndex[symi] = addSymbol(sym, inputStrings);
+    return outSymbolIndex[symi];
+}
+
+// Put sections, symbols, and program headers into output containers
+void CLinker::makeOutput() {
+    uint32_t i;                                  // loop counter
+    CMemoryBuffer noData;                        // data for uninitialized sections
+
+    // sections in address order
+    for (i = 0; i < outSectionOrder.numEntries(); i++) {
+        SLinkOutSection & out = outSections[outSectionOrder[i]];
+        Elf64_Shdr header;
+        memset(&header, 0, sizeof(header));
+        header.sh_name = out.name;
+        header.sh_type = out.type;
+        header.sh_flags = out.flags;
+        header.sh_addr = out.address;
+        header.sh_size = out.size;
+        header.sh_addralign = out.align;
+        if (out.type == SHT_NOBITS) {
+            out.elfIndex = addSection(header, inputStrings, noData);
+        }
+        else {
+            header.sh_offset = out.imageOffset;
+            out.elfIndex = addSection(header, inputStrings, image);
+        }
+    }
+
+    // symbols. Symbols in sections that are not loaded are dropped
+    outSymbolIndex.setNum(inputSymbols.numEntries());
+    ElfFWC_Sym nullSymbol;
+    memset(&nullSymbol, 0, sizeof(nullSymbol));
+    addSymbol(nullSymbol, inputStrings);         // symbol 0 is empty
+    for (i = 0; i < inputSymbols.numEntries(); i++) {
+        ElfFWC_Sym & sym = inputSymbols[i];
+        if (sym.st_shndx == 0 || sym.st_name == 0) continue;
+        if (sym.st_type == STT_SECTION || sym.st_type == STT_FILE) continue;
+        if (sym.st_shndx != SHN_ABS && inputSections[sym.st_shndx].outSection == 0) continue;
+        outputSymbol(i);
+    }
+
+    // relocations resolved by the loader
+    for (i = 0; i < loaderRelocations.numEntries(); i++) {
+        ElfFWC_Rela2 rel = loaderRelocations[i];
+        rel.r_section = outSections[rel.r_section].elfIndex;
+        if (rel.r_sym) {                         // 0 means no symbol
+            if (symbolTarget[rel.r_sym]) rel.r_sym = symbolTarget[rel.r_sym];
+            rel.r_sym = outputSymbol(rel.r_sym);
+        }
+        if (rel.r_refsym) {
+            if (symbolTarget[rel.r_refsym]) rel.r_refsym = symbolTarget[rel.r_refsym];
+            rel.r_refsym = outputSymbol(rel.r_refsym);
+        }
+        addRelocation(rel);
+    }
+
+    // program headers. One for each group
+    static const uint32_t groupFlags[LINK_GROUP_NUM] = {
+        SHF_IP | PF_R | PF_X, SHF_DATAP | PF_R | PF_W, SHF_THREADP | PF_R | PF_W};
+    for (uint32_t g = 0; g < LINK_GROUP_NUM; g++) {
+        if (groupSize[g] == 0) continue;
+        Elf64_Phdr pHeader;
+        memset(&pHeader, 0, sizeof(pHeader));
+        pHeader.p_type = PT_LOAD;
+        pHeader.p_flags = groupFlags[g];
+        pHeader.p_vaddr = pHeader.p_paddr = groupBase[g];
+        pHeader.p_filesz = groupFileSize[g];
+        pHeader.p_memsz = groupSize[g];
+        pHeader.p_align = groupAlign[g];
+        addProgHeader(pHeader);
+    }
+
+    join(ET_EXEC);                               // make executable file
+    if (entrySymbol) {
+        get<Elf64_Ehdr>(0).e_entry = symbolAddress(entrySymbol);
+    }
+    else {
+        err.submit(ERR_LINK_NO_ENTRY);
+    }
+}
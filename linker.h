@@ -0,0 +1,163 @@
+/****************************    linker.h    **********************************
+* Author:        Agner Fog
+* Date created:  2017-11-14
+* Last modified: 2017-11-14
+* Version:       1.00
+* Project:       Binary tools for ForwardCom instruction set
+* Module:        linker.h
+* Description:
+* Header file for linker
+*
+* Copyright 2017 GNU General Public License http://www.gnu.org/licenses
+*****************************************************************************/
+#pragma once
+
+/* Memory layout of executable file made by the linker:
+
+The sections are joined into three groups, each described by a program header:
+IP group:      read-only data sections followed by code sections. Addressed relative to IP.
+               The group begins at address 0.
+DATAP group:   initialized data sections followed by uninitialized data sections.
+               The datap register points to the begin of this group.
+THREADP group: thread-local data. The threadp register points to the begin of this group.
+
+Input sections with the same name and attributes are joined into one output section.
+sh_addr of an output section is the address relative to the begin of its group.
+Symbol values are relative to the begin of the output section, as in object files.
+Constructors and destructors (symbols with STV_CTOR and STV_DTOR) are listed in the
+read-only sections "init_array" and "fini_array" as 32-bit IP addresses divided by 4,
+sorted by priority.
+*/
+
+// Section group numbers
+const uint32_t LINK_GROUP_IP      = 0;     // const and code
+const uint32_t LINK_GROUP_DATAP   = 1;     // data and bss
+const uint32_t LINK_GROUP_THREADP = 2;     // thread-local data
+const uint32_t LINK_GROUP_NUM     = 3;     // number of groups
+
+const uint32_t LINK_GROUP_ALIGN = 8;       // minimum alignment of group begin
+
+// Input object file
+struct SLinkModule {
+    const char * fileName;                 // name of object file
+    uint32_t firstSection;                 // index of section 0 of this module in inputSections
+    uint32_t numSections;                  // number of sections, including empty section 0
+    uint32_t firstSymbol;                  // index of symbol 0 of this module in inputSymbols
+    uint32_t numSymbols;                   // number of symbols
+};
+
+// Input section
+struct SLinkSection {
+    uint32_t name;                         // name, offset into inputStrings
+    uint32_t type;                         // sh_type
+    uint64_t flags;                        // sh_flags
+    uint64_t offset;                       // offset of data in inputData
+    uint64_t size;                         // size of section
+    uint64_t align;                        // alignment
+    uint32_t module;                       // module index
+    uint32_t outSection;                   // output section index. 0 if section is not loaded
+    uint32_t next;                         // next input section in same output section
+    uint32_t firstRelocation;              // index of first relocation in relocationOrder
+    uint64_t address;                      // offset relative to begin of output section
+};
+
+// Output section
+struct SLinkOutSection {
+    uint32_t name;                         // name, offset into inputStrings
+    uint32_t type;                         // sh_type
+    uint64_t flags;                        // sh_flags
+    uint64_t align;                        // alignment
+    uint64_t size;                         // size of section
+    uint64_t address;                      // address relative to begin of group
+    uint64_t imageOffset;                  // offset of section data in image
+    uint32_t group;                        // LINK_GROUP_IP, LINK_GROUP_DATAP, or LINK_GROUP_THREADP
+    uint32_t order;                        // sort key for section order within group
+    uint32_t firstInput;                   // first input section
+    uint32_t lastInput;                    // last input section
+    uint32_t elfIndex;                     // section index in output file
+};
+
+// Entry in hash table of public symbols
+struct SLinkHashEntry {
+    uint32_t hash;                         // hash value of name
+    uint32_t symbol;                       // index into inputSymbols. 0 if vacant
+};
+
+// Constructor or destructor record, sorted by priority
+struct SLinkInitRecord {
+    uint32_t priority;                     // priority from st_reguse1
+    uint32_t symbol;                       // index into inputSymbols
+};
+
+static inline bool operator < (SLinkInitRecord const & a, SLinkInitRecord const & b) {
+    return a.priority < b.priority;
+}
+
+// Error found while relocating. Reported after all threads have finished
+struct SLinkProblem {
+    uint32_t errorNum;                     // error code
+    uint32_t relocation;                   // index into inputRelocations
+};
+
+// Result of filling one input section into the image. Kept for each section
+// so that the output does not depend on the timing of the threads
+struct SLinkFillResult {
+    CDynamicArray<ElfFWC_Rela2> loaderRelocations; // relocations to be resolved by the loader
+    CDynamicArray<SLinkProblem> problems;          // errors to report
+};
+
+// Linker class. The executable file is built in the CELF containers
+class CLinker : public CELF {
+public:
+    CLinker();                                   // Constructor
+    void go();                                   // Do the linking
+protected:
+    CDynamicArray<SLinkModule> modules;          // List of input object files
+    CDynamicArray<SLinkSection> inputSections;   // Sections of all modules
+    CDynamicArray<ElfFWC_Sym> inputSymbols;      // Symbols of all modules. st_shndx is index into inputSections
+    CDynamicArray<ElfFWC_Rela2> inputRelocations;// Relocations of all modules. r_section is index into inputSections
+    CDynamicArray<uint32_t> relocationOrder;     // Relocation indexes ordered by input section
+    CMemoryBuffer inputStrings;                  // Symbol names and section names of all modules
+    CMemoryBuffer inputData;                     // Section data of all modules
+    CDynamicArray<SLinkHashEntry> symbolHash;    // Hash table of public symbols
+    CDynamicArray<uint32_t> symbolTarget;        // Defining symbol for each symbol. 0 if unresolved
+    CDynamicArray<SLinkOutSection> outSections;  // Output sections
+    CDynamicArray<uint32_t> outSectionOrder;     // Output sections in address order
+    CDynamicArray<uint32_t> fillOrder;           // Initialized input sections in address order
+    CDynamicArray<ElfFWC_Rela2> loaderRelocations;// Relocations to be resolved by the loader. r_section is output section
+    CDynamicArray<uint32_t> outSymbolIndex;      // Symbol index in output file for each input symbol
+    CDynamicArray<SLinkInitRecord> constructors; // Symbols with STV_CTOR
+    CDynamicArray<SLinkInitRecord> destructors;  // Symbols with STV_DTOR
+    CMemoryBuffer image;                         // Contents of output sections
+    CMetaBuffer<CLibrary> libraries;             // Libraries to search for unresolved symbols
+    uint32_t numLibraries;                       // Number of libraries
+    uint32_t hashedSymbols;                      // Number of input symbols that have been entered into symbolHash
+    uint32_t numPublicSymbols;                   // Number of entries in symbolHash
+    uint64_t groupBase[LINK_GROUP_NUM];          // Address of each section group
+    uint64_t groupSize[LINK_GROUP_NUM];          // Size of each group in memory
+    uint64_t groupFileSize[LINK_GROUP_NUM];      // Size of initialized part of each group
+    uint64_t groupAlign[LINK_GROUP_NUM];         // Alignment of each group
+    uint32_t entrySymbol;                        // Symbol for entry point
+    void addModule(CELF & module);               // Add object file to the input lists
+    void makeSymbolTable();                      // Make hash table of public symbols
+    void addPublicSymbols();                     // Enter public symbols of new modules into hash table
+    void searchLibraries();                      // Load library members that define unresolved symbols
+    uint32_t findSymbol(const char * name, uint32_t hash); // Find public symbol in hash table
+    void resolveSymbols();                       // Find the definition of each external symbol
+    void layoutSections();                       // Join input sections into output sections and assign addresses
+    uint32_t findOutSection(SLinkSection const & sec); // Find or make output section for input section
+    void makeInitArrays();                       // Make sections with constructors and destructors
+    void sortRelocations();                      // Make relocationOrder
+    void applyRelocations();                     // Copy sections to image and apply relocations
+    void fillSections(std::atomic<uint32_t> * nextSection, CMetaBuffer<SLinkFillResult> * results); // Thread function for applyRelocations
+    void fillSection(uint32_t sec, SLinkFillResult & result); // Copy one input section to image and relocate it
+    void relocate(uint32_t reli, uint32_t outSec, uint64_t offset, SLinkFillResult & result); // Apply one relocation
+    uint64_t symbolAddress(uint32_t symi);       // Absolute address of symbol
+    void makeOutput();                           // Put sections, symbols, and program headers into output containers
+    uint32_t outputSymbol(uint32_t symi);        // Add symbol to output file and return new index
+    const char * inputName(uint32_t nameOffset); // Get symbol name or section name
+    const char * symbolModuleName(uint32_t symi);// Get name of module that contains symbol
+};
+
+// Hash function for symbol names
+uint32_t linkNameHash(const char * name);
@@ -96,6 +96,8 @@ int main(int argc, char * argv[]) {
     maincvt.go();
     // Do everything the command line says
 
+    cmd.reportStatistics();             // Report statistics if verbose option
+
     if (cmd.verbose) printf("\n");      // End with newline
     return err.getWorstError();         // Return with error code
 }
@@ -107,6 +109,14 @@ CConverter::CConverter() {
 
 void CConverter::go() {
     // Do whatever the command line parameters say
+    if (cmd.job == CMDL_JOB_ILIST) {
+        // Instruction list is read by compileInstructionList
+        compileInstructionList();
+        return;
+    }
+    if (cmd.job == CMDL_JOB_LINK && cmd.linkFiles.numEntries() == 0) {
+        err.submit(ERR_LINK_NO_INPUT);  return;
+    }
     fileName = cmd.inputFile;           // Get input file name from command line
                                         // Ignore nonexisting filename when building library
     int IgnoreError = (cmd.fileOptions & CMDL_FILE_IN_IF_EXISTS) && !cmd.outputFile;
@@ -160,12 +170,21 @@ void CConverter::go() {
         break;
 
     case CMDL_JOB_LINK:
+        // link
+        link();
+        if (err.number()) return;  // Return if error
         break;
 
     case CMDL_JOB_LIB:
+        // library
+        lib();
+        if (err.number()) return;  // Return if error
         break;
 
     case CMDL_JOB_EMU:
+        // emulate
+        emulate();
+        if (err.number()) return;  // Return if error
         break;
 
     default:
@@ -202,6 +221,40 @@ void CConverter::assemble() {
     ass.go();                          // run
 } 
 
+void CConverter::link() {
+    // Link object files into executable file
+    CLinker linker;
+    if (err.number()) return;
+    *this >> linker;                   // Give it the first object file
+    linker.go();                       // run
+}
+
+void CConverter::lib() {
+    // Build or modify function library
+    CLibrary library;
+    if (err.number()) return;
+    *this >> library;                  // Give it my buffer. Empty if making a new library
+    library.go();                      // run
+}
+
+void CConverter::emulate() {
+    // Run executable file in emulator
+    CEmulator emulator;
+    if (err.number()) return;
+    *this >> emulator;                 // Give it my buffer
+    emulator.go();                     // run
+}
+
+void CConverter::compileInstructionList() {
+    // Make C++ source code for the built-in instruction list from instruction list file
+    CCSVFile instructionListFile(cmd.inputFile);
+    instructionListFile.parse();                 // Read and interpret instruction list file
+    if (err.number()) return;                    // Return if error
+    if (cmd.outputFile == 0) cmd.outputFile = "instruction_table.cpp"; // Default output file name
+    if (cmd.verbose) printf("\nInput file: %s, output file: %s", cmd.inputFile, cmd.outputFile);
+    instructionListFile.writeTables(cmd.outputFile);
+}
+
 void CConverter::disassemble() {
     // Disassemble ELF file
     // Make instance of converter, 64 bit template
@@ -30,6 +30,28 @@
 #include <stdlib.h>
 #include <ctype.h>
 #include <time.h>
+#include <atomic>                                // for multithreaded disassembly
+#include <thread>
+
+// SSE2 is used for fast scanning of assembly source. It is available on all x86-64 platforms
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FWC_SSE2
+#endif
+
+// AVX2 is used by the emulator for vector instructions if enabled by the compiler (-mavx2 or /arch:AVX2)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define FWC_AVX2
+#endif
+
+// Input files are memory mapped on systems that support mmap
+#if !defined(_WIN32) && !defined(__WINDOWS__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define FWC_MMAP
+#endif
 
 #include "maindef.h"
 #include "error.h"
@@ -39,3 +61,6 @@
 #include "converters.h"
 #include "disassem.h"
 #include "assem.h"
+#include "library.h"
+#include "linker.h"
+#include "emulator.h"
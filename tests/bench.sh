@@ -0,0 +1,153 @@
+#!/bin/sh
+# Benchmarks for ForwardCom binary tools 'forw'
+# Usage: tests/bench.sh [path to forw] [benchmark names]
+# The input files are generated in a temporary directory. Each time is the best of three runs.
+# Give the path of another version of forw to compare with it.
+# Benchmarks:
+# sort: 200000 public symbols with names in random order. The assembler sorts them by name
+#       and the disassembler sorts them by address
+# tokenizer: 18 MB of code lines with names, keywords, instruction names, and registers
+# disasm: object file with 1M instructions, 100000 public function symbols, and 100000
+#       relocations, disassembled with one and with four threads
+# vector: emulated for-in loop over 16 KB arrays, repeated 20000 times, with the element loops
+#       of -emu-s and the SIMD kernels of -emu, for float, int32, int16, and double
+# library: library with 2000 members and 20000 public names. One member is replaced ten times
+#       in place, which includes the full rewrites when the unused space gets too big
+
+forw=${1:-./forw}
+case "$forw" in */*) forw=$(cd "$(dirname "$forw")" && pwd)/$(basename "$forw");; esac
+[ $# -gt 0 ] && shift
+benchmarks=${*:-sort tokenizer disasm vector library}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+# Print the best wall time in seconds of three runs of a command
+best() {
+    b=""
+    for run in 1 2 3; do
+        t0=$(date +%s%N)
+        "$@" >/dev/null 2>&1 || { echo "FAILED: $*" >&2; exit 1; }
+        t1=$(date +%s%N)
+        t=$((t1 - t0))
+        if [ -z "$b" ] || [ $t -lt $b ]; then b=$t; fi
+    done
+    awk "BEGIN {printf \"%.3f\", $b / 1e9}"
+}
+
+for bench in $benchmarks; do
+    case $bench in
+    sort)
+        awk 'BEGIN {
+            print "data section read write datap"
+            for (i = 0; i < 200000; i++) {
+                name = sprintf("d%08x", (i * 2654435761) % 4294967296)
+                printf "%s: int64 %d\npublic %s\n", name, i, name
+            }
+            print "data end" }' > "$tmp/sort.as"
+        ta=$(best "$forw" -ass "$tmp/sort.as" "$tmp/sort.ob") || exit 1
+        td=$(best "$forw" -dis "$tmp/sort.ob" "$tmp/sort.das") || exit 1
+        echo "sort: 200000 symbols. assemble $ta s, disassemble $td s"
+        ;;
+    tokenizer)
+        awk 'BEGIN {
+            print "code section execute"
+            print "_main function public"
+            for (i = 0; i < 100000; i++) {
+                r = i % 28
+                printf "Label_%d:\n", i
+                printf "int64 r%d = add(r%d, r%d)\n", r, r + 1, r + 2
+                printf "int32 r%d = r%d ^ 0x%x\n", r + 1, r + 3, i
+                printf "float v%d = max(v%d, v%d)\n", r, r + 1, r + 2
+                printf "int64 R%d = Label_%d - Label_%d\n", r, i, i
+                printf "int64 sp -= 8\n"
+                printf "if (int64 r%d > %d) {jump Label_%d}\n", r, i, i
+            }
+            print "return"
+            print "_main end"
+            print "code end" }' > "$tmp/tokenizer.as"
+        size=$(wc -c < "$tmp/tokenizer.as")
+        t=$(best "$forw" -ass "$tmp/tokenizer.as" "$tmp/tokenizer.ob") || exit 1
+        echo "tokenizer: assemble $size bytes $t s, $(awk "BEGIN {printf \"%.1f\", $size / $t / 1e6}") MB/s"
+        ;;
+    disasm)
+        awk 'BEGIN {
+            print "data section read write datap"
+            print "dval: int64 0"
+            print "data end"
+            print "code section execute"
+            for (f = 0; f < 100000; f++) {
+                printf "_f%d function public\n", f
+                printf "int64 r0 += %d\n", f
+                printf "int64 r1 = r2 + r3\n"
+                printf "int64 r4 = [dval]\n"
+                printf "int32 r5 = r5 << 3\n"
+                printf "int64 r6 = r0 - r1\n"
+                printf "int64 r7 = r7 ^ 0x%x\n", f
+                printf "int64 r1 -= 1\n"
+                printf "if (int64 r1 != 0) {jump _f%d}\n", f
+                printf "call _f%d\n", (f * 7919) % 100000
+                printf "return\n"
+                printf "_f%d end\n", f
+            }
+            print "code end" }' > "$tmp/disasm.as"
+        "$forw" -ass "$tmp/disasm.as" "$tmp/disasm.ob" >/dev/null || { echo "disasm: FAILED to assemble"; exit 1; }
+        t1=$(best "$forw" -dis "$tmp/disasm.ob" "$tmp/disasm.das") || exit 1
+        t4=$(best "$forw" -dis -threads=4 "$tmp/disasm.ob" "$tmp/disasm.das") || exit 1
+        echo "disasm: 1M instructions. disassemble $t1 s, with 4 threads $t4 s"
+        ;;
+    vector)
+        for type in float int32 int16 double; do
+            awk -v type=$type 'BEGIN {
+                size = type == "int16" ? 2 : type == "double" ? 8 : 4
+                print "data section read write datap"
+                printf "%s a[%d]\n%s b[%d]\n", type, 16384 / size, type, 16384 / size
+                print "data end"
+                print "code section execute"
+                print "_main function public"
+                print "for (int64 r3 = 0; r3 < 20000; r3++) {"
+                print "int64 r1 = address([a+16384])"
+                print "int64 r4 = address([b+16384])"
+                print "int64 r2 = 16384"
+                printf "for (%s v1 in [r1-r2]) {\n", type
+                printf "%s v1 = [r1-r2, length=r2]\n", type
+                printf "%s v2 = [r4-r2, length=r2]\n", type
+                printf "%s v3 = v1 * v2\n", type
+                printf "%s v3 = v3 + v1\n", type
+                printf "%s v3 = max(v3, v2)\n", type
+                printf "%s [r1-r2, length=r2] = v3\n", type
+                print "}"
+                print "}"
+                print "int64 r0 = 0"
+                print "return"
+                print "_main end"
+                print "code end" }' > "$tmp/vector.as"
+            "$forw" -ass "$tmp/vector.as" "$tmp/vector.ob" >/dev/null && "$forw" -link "$tmp/vector.ex" "$tmp/vector.ob" >/dev/null \
+            || { echo "vector: FAILED to assemble and link"; exit 1; }
+            ts=$(best "$forw" -emu-s "$tmp/vector.ex") || exit 1
+            tv=$(best "$forw" -emu "$tmp/vector.ex") || exit 1
+            echo "vector $type: -emu-s $ts s, -emu $tv s"
+        done
+        ;;
+    library)
+        mkdir "$tmp/library"
+        for m in $(seq 1 2000); do
+            awk -v m=$m 'BEGIN {
+                print "code section execute"
+                for (k = 1; k <= 10; k++) printf "_f%d_%d function public\nint64 r0 += %d\nreturn\n_f%d_%d end\n", m, k, k, m, k
+                print "code end" }' > "$tmp/library/m$m.as"
+            "$forw" -ass "$tmp/library/m$m.as" "$tmp/library/m$m.ob" >/dev/null || { echo "library: FAILED to assemble"; exit 1; }
+        done
+        "$forw" -lib "$tmp/library.li" "$tmp"/library/m*.ob >/dev/null || { echo "library: FAILED to make library"; exit 1; }
+        t0=$(date +%s%N)
+        for run in 1 2 3 4 5 6 7 8 9 10; do
+            "$forw" -lib "$tmp/library.li" "$tmp/library/m5.ob" >/dev/null || { echo "library: FAILED to update"; exit 1; }
+        done
+        t1=$(date +%s%N)
+        tf=$(best "$forw" -lib "$tmp/library.li" -o "$tmp/library2.li" "$tmp/library/m5.ob") || exit 1
+        echo "library: 2000 members. update $(awk "BEGIN {printf \"%.4f\", ($t1 - $t0) / 1e10}") s, full rewrite $tf s"
+        ;;
+    *)
+        echo "unknown benchmark $bench"; exit 1
+        ;;
+    esac
+done
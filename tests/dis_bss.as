@@ -0,0 +1,23 @@
+// Disassembler test: large uninitialized section. It has a size, but no data in the object file
+// expected result: 7
+
+data section read write datap
+int64 seven = 7
+data end
+
+bss section read write datap uninitialized
+int64 scratch
+int64 big[2000000]
+bss end
+
+code section execute
+_main function public
+int64 r0 = [seven]
+int64 r1 = [scratch]
+int64 r0 += r1
+int64 r2 = address([big])
+int64 r1 = [r2+8*1999999]         // last element of big
+int64 r0 += r1
+return
+_main end
+code end
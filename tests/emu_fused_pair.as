@@ -0,0 +1,21 @@
+// Emulator test: micro-operations combined into superinstructions.
+// The first jump goes to the second operation of a combined pair, and the loop ends with
+// two arithmetic operations followed by compare with zero and conditional jump
+// expected result: 955
+
+code section execute
+_main function public
+int64 r0 = 0
+int64 r1 = 10
+int64 r2 = 0
+jump L2
+L1:
+int64 r0 += 100                   // skipped in the first iteration
+L2:
+int64 r2 += r1
+int64 r1 -= 1
+if (int64 r1 != 0) {jump L1}
+int64 r0 += r2                    // 9 * 100 + (10 + 9 + ... + 1)
+return
+_main end
+code end
@@ -0,0 +1,30 @@
+// Emulator test: scaled offset and scaled index of float and double memory operands.
+// The scale factor is the operand size, 4 for float and 8 for double
+// expected result: 4613937819321106432
+
+data section read write datap
+double d0 = 1.0
+double d1 = 2.0
+double d2 = 3.0
+double d3 = 0
+float f0 = 1.5
+float f1 = 2.5
+float f2 = 3.5
+float f3 = 0
+data end
+
+code section execute
+_main function public
+int64 r1 = address([d0])
+int64 r2 = 1
+double v1 = [r1+16, scalar]       // offset 16 is encoded as 2*8. Reads d2 = 3.0
+double [r1+r2*8, scalar] = v1     // writes d1
+int64 r3 = address([f0])
+float v2 = [r3+8, scalar]         // offset 8 is encoded as 2*4. Reads f2 = 3.5
+float [r3+r2*4, scalar] = v2      // writes f1
+int64 r0 = [d1]                   // bits of 3.0 = 0x4008000000000000
+int32 r4 = [f1]                   // bits of 3.5 = 0x40600000
+int64 r0 ^= r4
+return
+_main end
+code end
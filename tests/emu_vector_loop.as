@@ -0,0 +1,53 @@
+// Emulator test: vector loops in int32 and double. The array lengths are not a multiple of
+// the vector length, so the last part is a masked tail. The guard words after the arrays
+// must not change. -emu, -emu-s and -emu-n must give the same result
+// expected result: 4627730092099919953
+
+data section read write datap
+int32 ia[37] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37}
+int32 iguard = 0x5555
+double da[11] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0}
+double dguard = 7.0
+double dresult = 0
+data end
+
+code section execute
+_main function public
+// int32: 37 elements = 16 + 16 + 5. ia[i] = ia[i] * 3 + ia[i]
+int64 r1 = address([ia+37*4])
+int64 r2 = 37*4
+for (int32 v1 in [r1-r2]) {
+    int32 v1 = [r1-r2, length=r2]
+    int32 v2 = v1 * 3
+    int32 v1 = v2 + v1
+    int32 [r1-r2, length=r2] = v1
+}
+// double: 11 elements = 8 + 3. da[i] = da[i] * 0.5 + da[i]
+int64 r1 = address([da+11*8])
+int64 r2 = 11*8
+for (double v1 in [r1-r2]) {
+    double v1 = [r1-r2, length=r2]
+    double v2 = v1 * 0.5
+    double v1 = v2 + v1
+    double [r1-r2, length=r2] = v1
+}
+// sum of ia = 4 * (1 + 2 + ... + 37) = 2812
+int64 r0 = 0
+int64 r1 = address([ia])
+for (int64 r2 = 0; r2 < 37; r2++) {
+    int32 r3 = [r1+r2*4]
+    int64 r0 += r3
+}
+int32 r3 = [iguard]               // 0x5555 = 21845, unchanged
+int64 r0 += r3
+double v3 = [da+10*8, scalar]     // 11 * 1.5 = 16.5
+double v4 = [da, scalar]          // 1 * 1.5 = 1.5
+double v3 = v3 + v4
+double v4 = [dguard, scalar]      // 7.0, unchanged
+double v3 = v3 + v4               // 25.0 = 0x4039000000000000
+double [dresult, scalar] = v3
+int64 r3 = [dresult]
+int64 r0 ^= r3                    // 0x4039000000000000 ^ (2812 + 21845)
+return
+_main end
+code end
@@ -0,0 +1,14 @@
+// Library test: library members are linked only when they define a symbol that is needed.
+// lib_c.as needs lib_d.as. lib_e.as is not needed, and it would give a duplicate _main if linked
+// library: lib_c.as lib_d.as lib_e.as
+// expected result: 300045
+
+extern _libfunc: function
+
+code section execute
+_main function public
+int64 r0 = 5
+call _libfunc                     // (5 + 10) * 3 + 300000
+return
+_main end
+code end
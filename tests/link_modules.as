@@ -0,0 +1,16 @@
+// Linker test: calls between modules, data in another module, and a weak definition
+// that is overridden by a strong definition in a later module
+// modules: link_a.as link_b.as
+// expected result: 21007
+
+extern _add3: function, _getcount: function, _weakval: function
+
+code section execute
+_main function public
+int64 r0 = 4
+call _add3                        // 7
+call _getcount                    // + 1000
+call _weakval                     // + 20000 from link_b.as, not + 1 from link_a.as
+return
+_main end
+code end
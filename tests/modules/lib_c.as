@@ -0,0 +1,13 @@
+// Library member for tests/link_library.as
+
+extern _libhelper: function
+public _libfunc: function
+
+code section execute
+_libfunc function
+int64 r0 += 10
+call _libhelper
+int64 r0 += 300000
+return
+_libfunc end
+code end
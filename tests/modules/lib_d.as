@@ -0,0 +1,10 @@
+// Library member for tests/link_library.as. Needed by lib_c.as
+
+public _libhelper: function
+
+code section execute
+_libhelper function
+int64 r0 *= 3
+return
+_libhelper end
+code end
@@ -0,0 +1,15 @@
+// Library member for tests/link_library.as. Not needed. It gives a duplicate symbol if it is linked
+
+public _main: function, _libunused: function
+
+code section execute
+_main function
+int64 r0 = 0
+return
+_main end
+
+_libunused function
+int64 r0 = 1
+return
+_libunused end
+code end
@@ -0,0 +1,26 @@
+// Module for tests/link_modules.as. _weakval is weak here and strong in link_b.as
+
+public _add3: function, _getcount: function, _weakval: function
+public _weakval: weak
+
+data section read write datap
+int64 counter = 1000
+data end
+
+code section execute
+_add3 function
+int64 r0 += 3
+return
+_add3 end
+
+_getcount function                // add counter. Needs a datap relocation
+int64 r1 = [counter]
+int64 r0 += r1
+return
+_getcount end
+
+_weakval function
+int64 r0 += 1
+return
+_weakval end
+code end
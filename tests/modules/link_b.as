@@ -0,0 +1,10 @@
+// Module for tests/link_modules.as. Strong definition of _weakval
+
+public _weakval: function
+
+code section execute
+_weakval function
+int64 r0 += 20000
+return
+_weakval end
+code end
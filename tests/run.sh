@@ -0,0 +1,106 @@
+#!/bin/sh
+# Tests for ForwardCom binary tools 'forw'
+# Usage: tests/run.sh [path to forw]
+# Each tests/*.as file is assembled, linked, and emulated with -emu, -emu-s and -emu-n. The line
+# "// expected result: N" in the file gives the value that the program must return.
+# The line "// modules: a.as b.as" gives other source files in tests/modules that are
+# linked with it. The line "// library: c.as d.as" gives source files in tests/modules that are
+# put into a library, which is linked with it. The library listing must name all members.
+# Linking with -threads=4 must give the same executable file.
+# The object file is also disassembled, and the disassembly must assemble again.
+# Disassembly with -threads=4 must give the same text.
+# A library is updated in place, and the extracted members must be byte-identical to the
+# object files that were put into it.
+
+forw=${1:-./forw}
+case "$forw" in */*) forw=$(cd "$(dirname "$forw")" && pwd)/$(basename "$forw");; esac
+dir=$(dirname "$0")
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+modes="-emu -emu-s -emu-n"
+failed=0
+for src in "$dir"/*.as; do
+    name=$(basename "$src" .as)
+    expected=$(sed -n 's|^// expected result: *\([-0-9]*\).*|\1|p' "$src")
+    modules=$(sed -n 's|^// modules: *||p' "$src")
+    objects="$tmp/$name.ob"
+    ok=1
+    for module in $modules; do
+        "$forw" -ass "$dir/modules/$module" "$tmp/${module%.as}.ob" >/dev/null || ok=0
+        objects="$objects $tmp/${module%.as}.ob"
+    done
+    members=""
+    for module in $(sed -n 's|^// library: *||p' "$src"); do
+        "$forw" -ass "$dir/modules/$module" "$tmp/${module%.as}.ob" >/dev/null || ok=0
+        members="$members $tmp/${module%.as}.ob"
+    done
+    if [ -n "$members" ]; then
+        "$forw" -lib "$tmp/$name.li" $members >/dev/null || ok=0
+        list=$("$forw" -lib "$tmp/$name.li" -l)
+        for member in $members; do
+            echo "$list" | grep -q "^$(basename "$member")," || { echo "$name: library listing has no $(basename "$member")"; ok=0; }
+        done
+        objects="$objects $tmp/$name.li"
+    fi
+    if [ $ok -eq 0 ] || ! "$forw" -ass "$src" "$tmp/$name.ob" >/dev/null || ! "$forw" -link "$tmp/$name.ex" $objects >/dev/null; then
+        echo "$name: FAILED to assemble or link"
+        failed=$((failed + 1))
+        continue
+    fi
+    if ! "$forw" -link -threads=4 "$tmp/$name.t4.ex" $objects >/dev/null || ! cmp -s "$tmp/$name.ex" "$tmp/$name.t4.ex"; then
+        echo "$name: FAILED, linking with -threads=4 gives a different file"
+        failed=$((failed + 1))
+    fi
+    if ! "$forw" -dis "$tmp/$name.ob" "$tmp/$name.das" >/dev/null || ! "$forw" -ass "$tmp/$name.das" "$tmp/$name.dis.ob" >/dev/null; then
+        echo "$name: FAILED to disassemble and assemble again"
+        failed=$((failed + 1))
+    fi
+    # the first two lines contain the file name and date
+    tail -n +3 "$tmp/$name.das" > "$tmp/$name.t1.text"
+    if ! "$forw" -dis -threads=4 "$tmp/$name.ob" "$tmp/$name.t4.das" >/dev/null \
+    || ! tail -n +3 "$tmp/$name.t4.das" | cmp -s - "$tmp/$name.t1.text"; then
+        echo "$name: FAILED, disassembling with -threads=4 gives a different text"
+        failed=$((failed + 1))
+    fi
+    for mode in $modes; do
+        result=$("$forw" $mode "$tmp/$name.ex" | sed -n 's/^Program returned \([-0-9]*\).*/\1/p')
+        if [ "$result" = "$expected" ]; then
+            echo "$name $mode: ok"
+        else
+            echo "$name $mode: FAILED, returned '$result', expected '$expected'"
+            failed=$((failed + 1))
+        fi
+    done
+done
+
+# Library update. Replace lib_d.ob with a different object file. The library must be updated
+# in place: the old file is unchanged after the 88 bytes header, and the update is appended
+lib="$tmp/update.li"
+libfailed=$failed
+mkdir "$tmp/new" "$tmp/extract"
+"$forw" -ass "$dir/modules/lib_e.as" "$tmp/new/lib_d.ob" >/dev/null
+for module in lib_c lib_d lib_e; do
+    "$forw" -ass "$dir/modules/$module.as" "$tmp/$module.ob" >/dev/null
+done
+"$forw" -lib "$lib" "$tmp/lib_c.ob" "$tmp/lib_d.ob" "$tmp/lib_e.ob" >/dev/null
+oldsize=$(wc -c < "$lib")
+tail -c +89 "$lib" > "$tmp/old.tail"
+if ! "$forw" -lib "$lib" -a "$tmp/new/lib_d.ob" >/dev/null || [ $(wc -c < "$lib") -le $oldsize ] \
+|| ! head -c $oldsize "$lib" | tail -c +89 | cmp -s - "$tmp/old.tail"; then
+    echo "library update: FAILED, not updated in place"
+    failed=$((failed + 1))
+fi
+if ! (cd "$tmp/extract" && "$forw" -lib "$lib" -x lib_c.ob -x lib_d.ob -x lib_e.ob >/dev/null) \
+|| ! cmp -s "$tmp/extract/lib_c.ob" "$tmp/lib_c.ob" || ! cmp -s "$tmp/extract/lib_d.ob" "$tmp/new/lib_d.ob" \
+|| ! cmp -s "$tmp/extract/lib_e.ob" "$tmp/lib_e.ob"; then
+    echo "library update: FAILED, extracted members differ"
+    failed=$((failed + 1))
+fi
+if ! "$forw" -lib "$lib" -d lib_e.ob >/dev/null || "$forw" -lib "$lib" -l | grep -q "^lib_e.ob,"; then
+    echo "library update: FAILED to delete member"
+    failed=$((failed + 1))
+fi
+[ $failed -eq $libfailed ] && echo "library update: ok"
+
+[ $failed -eq 0 ] || { echo "$failed test(s) failed"; exit 1; }
+echo "All tests passed"